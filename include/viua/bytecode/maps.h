@@ -30,6 +30,12 @@
 #include <viua/bytecode/operand_types.h>
 
 
+/*  Names of functions and blocks used by call-like instructions (and method names used by msg) are
+ *  encoded as references to module's symbol table.
+ *  Sizes of these operands are not included in OP_SIZES.
+ */
+const unsigned SYMBOL_OPERAND_SIZE = sizeof(OperandType) + sizeof(uint32_t);
+
 const std::map<std::string, unsigned> OP_SIZES = {
     { "nop",    sizeof(byte) },
 
@@ -28,6 +28,7 @@ enum OperandType: unsigned char {
     OT_ATOM,
     OT_PRIMITIVE_BYTE,
     OT_PRIMITIVE_INT,
+    OT_SYMBOL,
 };
 
 #endif
@@ -23,11 +23,11 @@
 #pragma once
 
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <tuple>
 #include <map>
-#include <regex>
 #include <viua/program.h>
 
 namespace assembler {
@@ -54,23 +54,56 @@ namespace assembler {
         std::map<std::string, std::vector<std::string> > getInvokables(const std::string& type, const std::vector<std::string>& lines);
     }
 
+    namespace cfg {
+        typedef std::vector<std::string>::size_type index_type;
+
+        struct instruction_t {
+            index_type line;
+            std::string opcode;
+            std::vector<std::string> operands;
+        };
+
+        struct node_t {
+            // instructions [begin, end) of the graph
+            index_type begin, end;
+            std::vector<index_type> successors;
+        };
+
+        struct graph_t {
+            // name is empty for instructions outside of functions and blocks
+            std::string name;
+            bool is_block;
+            std::vector<instruction_t> instructions;
+            std::map<std::string, index_type> marks;
+            std::map<std::string, std::string> names;
+            // entry node is the first one
+            std::vector<node_t> nodes;
+            // false if some jump targets are not instructions of the graph
+            bool complete;
+        };
+
+        std::vector<graph_t> build(const std::vector<std::string>&);
+        bool resolveJump(const graph_t&, const std::string&, index_type, index_type&);
+    }
+
     namespace verify {
         void functionCallsAreDefined(const std::vector<std::string>&, const std::vector<std::string>&, const std::vector<std::string>&);
 
-        void functionCallArities(const std::vector<std::string>&);
-        void msgArities(const std::vector<std::string>& lines);
+        void functionCallArities(const std::vector<cfg::graph_t>&);
+        void msgArities(const std::vector<cfg::graph_t>&);
 
         void functionNames(const std::vector<std::string>&);
         void functionsEndWithReturn(const std::vector<std::string>&);
 
-        void frameBalance(const std::vector<std::string>&, const std::map<unsigned long, unsigned long>&);
+        void frameBalance(const std::vector<cfg::graph_t>&, const std::map<unsigned long, unsigned long>&);
+        void tryFrameBalance(const std::vector<cfg::graph_t>&, const std::map<unsigned long, unsigned long>&);
 
-        void blockTries(const std::vector<std::string>&, const std::vector<std::string>&, const std::vector<std::string>&);
-        void blockCatches(const std::vector<std::string>&, const std::vector<std::string>&, const std::vector<std::string>&);
+        void blockTries(const std::vector<cfg::graph_t>&, const std::vector<std::string>&, const std::vector<std::string>&);
+        void blockCatches(const std::vector<cfg::graph_t>&, const std::vector<std::string>&, const std::vector<std::string>&);
 
         void callableCreations(const std::vector<std::string>&, const std::vector<std::string>&, const std::vector<std::string>&);
 
-        void ressInstructions(const std::vector<std::string>&, bool);
+        void ressInstructions(const std::vector<cfg::graph_t>&, bool);
 
         void functionBodiesAreNonempty(const std::vector<std::string>&);
         void blockBodiesAreNonempty(const std::vector<std::string>&);
@@ -78,18 +111,28 @@ namespace assembler {
         void blocksEndWithFinishingInstruction(const std::vector<std::string>&);
 
         void directives(const std::vector<std::string>&);
-        void instructions(const std::vector<std::string>&);
+        void instructions(const std::vector<cfg::graph_t>&);
+
+        void framesHaveOperands(const std::vector<cfg::graph_t>&);
+        void framesHaveNoGaps(const std::vector<cfg::graph_t>&, const std::map<unsigned long, unsigned long>&);
+
+        void jumpsAreInRange(const std::vector<cfg::graph_t>&);
 
-        void framesHaveOperands(const std::vector<std::string>&);
-        void framesHaveNoGaps(const std::vector<std::string>&, const std::map<unsigned long, unsigned long>&);
+        std::vector<std::pair<unsigned, std::string>> registersAreInitialised(const std::vector<cfg::graph_t>&);
+    }
+
+    namespace optimise {
+        std::vector<std::string> function(const std::vector<std::string>&);
+        std::vector<std::string> lines(const std::vector<std::string>&);
+        std::vector<std::string> inlineCalls(const std::vector<std::string>&, unsigned, std::vector<std::vector<std::string>::size_type>&);
+    }
 
-        void jumpsAreInRange(const std::vector<std::string>&);
+    namespace registers {
+        uint64_t count(const std::vector<std::string>&, const std::map<std::string, std::vector<std::string>>&);
     }
 
     namespace utils {
-        std::regex getFunctionNameRegex();
         bool isValidFunctionName(const std::string&);
-        std::smatch matchFunctionName(const std::string&);
         int getFunctionArity(const std::string&);
 
         namespace lines {
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <viua/bytecode/opcodes.h>
@@ -101,8 +102,8 @@ namespace cg {
         byte* openclose(byte*, int_op, int_op, int_op);
         byte* openclosecopy(byte*, int_op, int_op, int_op);
         byte* openclosemove(byte*, int_op, int_op, int_op);
-        byte* opclosure(byte*, int_op, const std::string&);
-        byte* opfunction(byte*, int_op, const std::string&);
+        byte* opclosure(byte*, int_op, uint32_t);
+        byte* opfunction(byte*, int_op, uint32_t);
         byte* opfcall(byte*, int_op, int_op);
 
         byte* opframe(byte*, int_op, int_op);
@@ -110,20 +111,20 @@ namespace cg {
         byte* oppamv(byte*, int_op, int_op);
         byte* oparg(byte*, int_op, int_op);
         byte* opargc(byte*, int_op);
-        byte* opcall(byte*, int_op, const std::string&);
-        byte* optailcall(byte*, const std::string&);
-        byte* opprocess(byte*, int_op, const std::string&);
+        byte* opcall(byte*, int_op, uint32_t);
+        byte* optailcall(byte*, uint32_t);
+        byte* opprocess(byte*, int_op, uint32_t);
         byte* opjoin(byte*, int_op, int_op);
         byte* opreceive(byte*, int_op);
-        byte* opwatchdog(byte*, const std::string&);
+        byte* opwatchdog(byte*, uint32_t);
 
         byte* opjump(byte*, uint64_t);
         byte* opbranch(byte*, int_op, uint64_t, uint64_t);
 
         byte* optry(byte*);
-        byte* opcatch(byte*, const std::string&, const std::string&);
+        byte* opcatch(byte*, const std::string&, uint32_t);
         byte* oppull(byte*, int_op);
-        byte* openter(byte*, const std::string&);
+        byte* openter(byte*, uint32_t);
         byte* opthrow(byte*, int_op);
         byte* opleave(byte*);
 
@@ -136,7 +137,7 @@ namespace cg {
         byte* opregister(byte*, int_op);
 
         byte* opnew(byte*, int_op, const std::string&);
-        byte* opmsg(byte*, int_op, const std::string&);
+        byte* opmsg(byte*, int_op, uint32_t);
         byte* opinsert(byte*, int_op, int_op, int_op);
         byte* opremove(byte*, int_op, int_op, int_op);
 
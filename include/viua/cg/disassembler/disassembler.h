@@ -23,8 +23,11 @@
 #pragma once
 
 #include <algorithm>
+#include <map>
 #include <string>
 #include <tuple>
+#include <vector>
+#include <viua/bytecode/bytetypedef.h>
 
 
 // Helper functions for checking if a container contains an item.
@@ -37,7 +40,8 @@ template<typename K, typename V> bool in(std::map<K, V> m, K key) {
 
 namespace disassembler {
     std::string intop(byte*);
-    std::tuple<std::string, unsigned> instruction(byte*);
+    std::string symbolop(byte*&, const std::vector<std::string>*);
+    std::tuple<std::string, unsigned> instruction(byte*, const std::vector<std::string>* symbols = nullptr);
 }
 
 
@@ -29,6 +29,7 @@
 #include <vector>
 #include <queue>
 #include <map>
+#include <memory>
 #include <tuple>
 #include <unordered_set>
 #include <utility>
@@ -38,19 +39,41 @@
 #include <thread>
 #include <condition_variable>
 #include <viua/process.h>
+#include <viua/cpu/reactor.h>
+#include <viua/cpu/symbols.h>
 
 
-class ForeignFunctionCallRequest {
+namespace viua {
+    namespace scheduler {
+        class Profiler;
+        class DispatchStatistics;
+        class AllocationProfiler;
+        class Tracer;
+        class PerfMap;
+    }
+}
+
+class ForeignFunctionCallRequest: public ForeignCallCompletion {
     Frame *frame;
     Process *caller_process;
     CPU *cpu;
 
+    void placeReturnValue();
+    void placeReturnValue(Type*);
+
     public:
         std::string functionName() const;
         void call(ForeignFunction*);
+        void call(AsyncForeignFunction*);
+        void callInline(ForeignFunction*);
+        void callTyped(const TypedForeignFunctionSpec&);
         void registerException(Type*);
         void wakeup();
 
+        void complete() override;
+        void fail(Type*) override;
+        ForeignIOReactor* reactor() override;
+
         ForeignFunctionCallRequest(Frame *fr, Process *cp, CPU *c): frame(fr), caller_process(cp), cpu(c) {}
         ~ForeignFunctionCallRequest() {
             delete frame;
@@ -58,7 +81,7 @@ class ForeignFunctionCallRequest {
 };
 
 
-void ff_call_processor(std::vector<ForeignFunctionCallRequest*> *requests, std::map<std::string, ForeignFunction*>* foreign_functions, std::mutex *ff_map_mtx, std::mutex *mtx, std::condition_variable *cv);
+void ff_call_processor(std::vector<ForeignFunctionCallRequest*> *requests, std::map<std::string, ForeignFunction*>* foreign_functions, std::map<std::string, AsyncForeignFunction*>* async_foreign_functions, std::mutex *ff_map_mtx, std::mutex *mtx, std::condition_variable *cv);
 
 
 class CPU {
@@ -72,17 +95,47 @@ class CPU {
     uint64_t bytecode_size;
     uint64_t executable_offset;
 
+    /*  Modules are executed in place from read-only mappings of their files.
+     *  When bytecode_image is set the bytecode pointer points into it and is not freed with delete[].
+     */
+    std::shared_ptr<MappedModule> bytecode_image;
+
     // Map of the typesystem currently existing inside the VM.
     std::map<std::string, Prototype*> typesystem;
 
     /*  Function and block names mapped to bytecode addresses.
+     *  Addresses are looked up in maps (filled by mapfunction() and mapblock()), and
+     *  in address tables of the executable.
      */
     std::map<std::string, uint64_t> function_addresses;
     std::map<std::string, uint64_t> block_addresses;
-
-    std::map<std::string, std::pair<std::string, byte*>> linked_functions;
-    std::map<std::string, std::pair<std::string, byte*>> linked_blocks;
-    std::map<std::string, std::pair<unsigned, byte*> > linked_modules;
+    AddressTable executable_functions;
+    AddressTable executable_blocks;
+    AddressTable executable_register_counts;
+    // table mapping bytecode to source lines (null if the executable has none)
+    std::shared_ptr<LineTable> executable_lines;
+    bool findLocalFunction(const std::string&, uint64_t&) const;
+    bool findLocalBlock(const std::string&, uint64_t&) const;
+
+    /*  Modules linked at runtime, in the order in which they were loaded.
+     *  Names are looked up in hashed address tables of the modules so linking a module
+     *  does not copy its functions and blocks into any map.
+     *  Modules loaded later shadow functions and blocks of modules loaded earlier.
+     */
+    std::vector<viua::cpu::LinkedModule> linked_modules;
+    uint64_t link_generation;
+    bool findLinkedFunction(const std::string&, std::pair<byte*, byte*>&) const;
+    bool findLinkedBlock(const std::string&, std::pair<byte*, byte*>&) const;
+
+    /*  Symbol tables of loaded modules.
+     *  Names are resolved into entry points when modules are loaded so that call-like instructions
+     *  referring to symbols do not have to look them up by name.
+     */
+    std::vector<std::string> executable_symbols;
+    std::vector<viua::cpu::PreparedSymbol> executable_prepared_symbols;
+    std::vector<std::unique_ptr<viua::cpu::ModuleSymbols>> module_symbols;
+    void registerModuleSymbols(byte*, uint64_t, const std::vector<std::string>&, const std::vector<viua::cpu::PreparedSymbol>& = {});
+    void resolveModuleSymbols(viua::cpu::ModuleSymbols&, const viua::cpu::LinkedModule&);
 
     /*  Slot for thrown objects (typically exceptions).
      *  Can be set by user code and the CPU.
@@ -98,11 +151,17 @@ class CPU {
      *  extension libraries written in C++.
      */
     std::map<std::string, ForeignFunction*> foreign_functions;
+    std::map<std::string, AsyncForeignFunction*> async_foreign_functions;
+    std::map<std::string, ForeignFunction*> nonblocking_foreign_functions;
+    std::map<std::string, TypedForeignFunctionSpec> typed_foreign_functions;
     std::mutex foreign_functions_mutex;
 
-    /** This is the mapping Viua uses to dispatch methods on pure-C++ classes.
+    /** This is the table Viua uses to dispatch methods on pure-C++ classes.
+     *  Methods are addressed by dense integer ids so that call sites need to
+     *  look their names up only once.
      */
-    std::map<std::string, ForeignMethod> foreign_methods;
+    std::vector<ForeignMethodMemberPointer> foreign_method_table;
+    std::map<std::string, int> foreign_method_ids;
 
     // Foreign function call requests are placed here to be executed later.
     std::vector<ForeignFunctionCallRequest*> foreign_call_queue;
@@ -113,6 +172,9 @@ class CPU {
 
     std::vector<void*> cxx_dynamic_lib_handles;
 
+    // Asynchronous foreign functions use this reactor to wait for file descriptors.
+    viua::cpu::Reactor io_reactor;
+
     public:
         /*  Methods dealing with dynamic library loading.
          */
@@ -122,6 +184,21 @@ class CPU {
         // debug and error reporting flags
         bool debug, errors;
 
+        /*  When linking lazily, symbols are not resolved when modules are linked but when they are first used.
+         */
+        bool lazy_linking;
+
+        // Processes are sampled by the profiler if it is set (it is not owned by the CPU).
+        viua::scheduler::Profiler* profiler;
+        // Dispatched instructions are counted if statistics are set (they are not owned by the CPU).
+        viua::scheduler::DispatchStatistics* statistics;
+        // Allocations of objects are profiled if the allocation profiler is set (it is not owned by the CPU).
+        viua::scheduler::AllocationProfiler* allocations;
+        // Scheduling events are recorded if the tracer is set (it is not owned by the CPU).
+        viua::scheduler::Tracer* tracer;
+        // Instructions are executed through perf trampolines if the perf map is set (it is not owned by the CPU).
+        viua::scheduler::PerfMap* perf_map;
+
         std::vector<std::string> commandline_arguments;
 
         /*  Public API of the CPU provides basic actions:
@@ -132,12 +209,20 @@ class CPU {
          *      * kick the CPU so it starts running,
          */
         CPU& load(byte*);
+        CPU& load(std::shared_ptr<MappedModule>, byte*);
         CPU& bytes(uint64_t);
+        CPU& symbols(const std::vector<std::string>&);
+        CPU& prepared(const std::vector<viua::cpu::PreparedSymbol>&);
 
         CPU& mapfunction(const std::string&, uint64_t);
         CPU& mapblock(const std::string&, uint64_t);
+        CPU& addresses(AddressTable, AddressTable, AddressTable = AddressTable());
+        CPU& lines(std::shared_ptr<LineTable>);
 
         CPU& registerExternalFunction(const std::string&, ForeignFunction*);
+        CPU& registerAsyncExternalFunction(const std::string&, AsyncForeignFunction*);
+        CPU& registerNonblockingExternalFunction(const std::string&, ForeignFunction*);
+        CPU& registerTypedExternalFunction(const TypedForeignFunctionSpec&);
         CPU& removeExternalFunction(std::string);
 
         /*  Methods dealing with typesystem related tasks.
@@ -150,6 +235,8 @@ class CPU {
         bool isNativeFunction(const std::string&) const;
         bool isForeignMethod(const std::string&) const;
         bool isForeignFunction(const std::string&) const;
+        bool isNonblockingForeignFunction(const std::string&) const;
+        bool isTypedForeignFunction(const std::string&) const;
 
         bool isBlock(const std::string&) const;
         bool isLocalBlock(const std::string&) const;
@@ -158,15 +245,25 @@ class CPU {
 
         std::string resolveMethodName(const std::string&, const std::string&) const;
         std::pair<byte*, byte*> getEntryPointOf(const std::string&) const;
+        viua::cpu::ModuleSymbols* moduleSymbolsAt(const byte*) const;
+        uint64_t linkGeneration() const;
+        void resolveSymbol(viua::cpu::Symbol&) const;
+        uint64_t registerCountOf(const std::string&, std::pair<byte*, byte*>) const;
+        bool sourceLineOf(const byte*, std::string&, uint64_t&) const;
 
         void registerPrototype(Prototype*);
 
         /// These two methods are used to inject pure-C++ classes into machine's typesystem.
         CPU& registerForeignPrototype(const std::string&, Prototype*);
-        CPU& registerForeignMethod(const std::string&, ForeignMethod);
+        CPU& registerForeignMethod(const std::string&, ForeignMethodMemberPointer);
+        int foreignMethodId(const std::string&) const;
 
         void requestForeignFunctionCall(Frame*, Process*);
-        void requestForeignMethodCall(const std::string&, Type*, Frame*, RegisterSet*, RegisterSet*, Process*);
+        void callNonblockingForeignFunction(Frame*, Process*);
+        void callTypedForeignFunction(Frame*, Process*);
+        ForeignIOReactor* reactor();
+
+        void callForeignMethod(int, Type*, Frame*, RegisterSet*, RegisterSet*, Process*);
 
         int run();
 
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <atomic>
 #include <string>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/cpu/registerset.h>
@@ -33,6 +35,13 @@ class Frame {
         RegisterSet* args;
         RegisterSet* regset;
 
+        /*  Size of local register set requested for the frame.
+         *  Frames requested by the `frame` instruction allocate their local register sets only when they are
+         *  used so that exactly as many registers as the called function needs can be allocated (if the number
+         *  is known).
+         */
+        long unsigned local_register_set_size;
+
         unsigned place_return_value_in;
         bool resolve_return_value_register;
 
@@ -41,15 +50,26 @@ class Frame {
         inline byte* ret_address() { return return_address; }
 
         void setLocalRegisterSet(RegisterSet*, bool receives_ownership = true);
+        void allocateLocalRegisterSet(long unsigned needed = 0);
+        void growLocalRegisterSet(long unsigned);
+
+        // allocations of frames are reported to hooks the same way as allocations of objects
+        static std::atomic<void (*)(void*, std::size_t)> allocation_hook;
+        static std::atomic<void (*)(void*, std::size_t)> deallocation_hook;
+        static void* operator new(std::size_t);
+        static void operator delete(void*, std::size_t);
 
-        Frame(byte* ra, long unsigned argsize, long unsigned regsize = 16):
+        Frame(byte* ra, long unsigned argsize, long unsigned regsize = 16, bool allocate_local_register_set = true):
             owns_local_register_set(true),
             return_address(ra),
             args(nullptr), regset(nullptr),
+            local_register_set_size(regsize),
             place_return_value_in(0), resolve_return_value_register(false)
         {
             args = new RegisterSet(argsize);
-            regset = new RegisterSet(regsize);
+            if (allocate_local_register_set) {
+                allocateLocalRegisterSet();
+            }
         }
         Frame(const Frame& that) {
             return_address = that.return_address;
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_CPU_REACTOR_H
+#define VIUA_CPU_REACTOR_H
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <functional>
+#include <viua/include/module.h>
+
+
+namespace viua {
+    namespace cpu {
+        class Reactor: public ForeignIOReactor {
+            /** Callbacks waiting for a file descriptor to become ready.
+             *  At most one callback may wait for each direction of a descriptor.
+             */
+            struct Waiters {
+                std::function<void()> on_readable;
+                std::function<void()> on_writable;
+                bool registered;
+
+                Waiters(): registered(false) {}
+            };
+
+            std::map<int, Waiters> waiting;
+            std::mutex waiting_mutex;
+
+            int epoll_fd;
+            int wakeup_fd;
+
+            // why the reactor could not be set up (empty if it was), await() refuses to park anything then
+            std::string failure;
+
+            // started lazily - most programs never wait for I/O
+            std::thread* loop_thread;
+
+            bool arm(int, Waiters&);
+            void loop();
+
+            public:
+                void await(int, Readiness, std::function<void()>) override;
+
+                Reactor();
+                ~Reactor();
+        };
+    }
+}
+
+
+#endif
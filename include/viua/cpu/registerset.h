@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <atomic>
 #include <viua/types/type.h>
 
 typedef unsigned char mask_t;
@@ -71,6 +73,12 @@ class RegisterSet {
 
         RegisterSet* copy();
 
+        // allocations of register sets are reported to hooks the same way as allocations of objects
+        static std::atomic<void (*)(void*, std::size_t)> allocation_hook;
+        static std::atomic<void (*)(void*, std::size_t)> deallocation_hook;
+        static void* operator new(std::size_t);
+        static void operator delete(void*, std::size_t);
+
         RegisterSet(registerset_size_type sz);
         ~RegisterSet();
 };
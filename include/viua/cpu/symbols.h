@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_CPU_SYMBOLS_H
+#define VIUA_CPU_SYMBOLS_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <viua/bytecode/bytetypedef.h>
+#include <viua/loader.h>
+
+
+namespace viua {
+    namespace cpu {
+        struct Symbol {
+            /** Entry in symbol table of a loaded module.
+             *
+             *  Entry points (paired with base address of the module they are in) are
+             *  resolved by the CPU when modules are loaded (or, when linking lazily, when
+             *  the symbol is first used), and are null if the name does not denote a
+             *  native function or block.
+             *  Link generation records the set of linked modules that was searched; an
+             *  unresolved symbol is searched for again only after another module is linked.
+             *  Number of local registers needed by the function is looked up when the symbol is
+             *  first used (zero means that it is not known).
+             */
+            static const uint64_t UNRESOLVED = UINT64_MAX;
+
+            std::string name;
+            std::pair<byte*, byte*> function;
+            std::pair<byte*, byte*> block;
+            uint64_t link_generation;
+            uint64_t registers;
+
+            Symbol(const std::string& n = ""): name(n), function(nullptr, nullptr), block(nullptr, nullptr), link_generation(UNRESOLVED), registers(UNRESOLVED) {}
+        };
+
+        struct PreparedSymbol {
+            /** Offsets of entry points of a symbol in bytecode of its own module,
+             *  computed ahead of time (e.g. stored in an image cache).
+             */
+            static const uint64_t NONE = UINT64_MAX;
+
+            uint64_t function;
+            uint64_t block;
+        };
+
+        struct ModuleSymbols {
+            /** Dense symbol table of a module, indexed by symbol operands in its bytecode.
+             */
+            byte* bytecode;
+            uint64_t size;
+            std::vector<Symbol> symbols;
+
+            bool contains(const byte* address) const {
+                return (address >= bytecode and address < (bytecode+size));
+            }
+
+            ModuleSymbols(byte* b, uint64_t s): bytecode(b), size(s) {}
+        };
+
+        struct LinkedModule {
+            /** Module linked at runtime.
+             *
+             *  Its bytecode is executed in place from the image, and its functions and blocks
+             *  are looked up in address tables stored in the image.
+             */
+            std::string name;
+            std::shared_ptr<MappedModule> image;
+            byte* bytecode;
+            uint64_t size;
+            AddressTable functions;
+            AddressTable blocks;
+            AddressTable register_counts;
+            // null if the module has no line table
+            std::shared_ptr<LineTable> lines;
+
+            LinkedModule(const std::string& n, std::shared_ptr<MappedModule> i, byte* b, uint64_t s, AddressTable f, AddressTable bl, AddressTable r = AddressTable(), std::shared_ptr<LineTable> ln = nullptr):
+                name(n), image(i), bytecode(b), size(s), functions(f), blocks(bl), register_counts(r), lines(ln) {}
+        };
+    }
+}
+
+
+#endif
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <functional>
@@ -58,6 +59,56 @@ typedef void (ForeignFunction)(
     CPU*            // VM CPU the calling process is running on
 );
 
+/** I/O reactor owned by the VM.
+ *  Asynchronous foreign functions use it to wait until a (non-blocking) file descriptor becomes ready without
+ *  occupying a thread for the whole time.
+ *  Callbacks are one-shot and are run on the reactor thread so they must not block; a callback that finds
+ *  the descriptor not ready after all (e.g. read() fails with EAGAIN) should simply await it again.
+ *  Errors and hangups are reported as readiness in both directions so that the next I/O call reports them.
+ */
+class ForeignIOReactor {
+    public:
+        enum Readiness {
+            READABLE,
+            WRITABLE,
+        };
+
+        virtual void await(int, Readiness, std::function<void()>) = 0;
+
+        virtual ~ForeignIOReactor() {}
+};
+
+/** Foreign functions that start an operation and finish it later (e.g. when a file descriptor becomes ready)
+ *  receive a completion handle as their last parameter.
+ *  The calling process stays suspended until the handle is completed or failed, and
+ *  the handle may be completed from any thread.
+ *  Completion handles are one-shot: after complete() or fail() is called the handle (and the call frame it was
+ *  issued for) is released by the VM and must not be touched again.
+ *
+ *  The interface is purely virtual because foreign modules cannot resolve symbols defined inside the VM binary.
+ */
+class ForeignCallCompletion {
+    public:
+        // finish the call; return value (if any) must already be placed in local register 0 of the call frame
+        virtual void complete() = 0;
+        // finish the call by throwing the object inside the calling process
+        virtual void fail(Type*) = 0;
+        // reactor that can be used to wait for I/O before completing the call
+        virtual ForeignIOReactor* reactor() = 0;
+
+        virtual ~ForeignCallCompletion() {}
+};
+
+// Asynchronous external functions must have this signature
+typedef void (AsyncForeignFunction)(
+    Frame*,
+    RegisterSet*,
+    RegisterSet*,
+    Process*,
+    CPU*,
+    ForeignCallCompletion*  // handle that must be completed (exactly once) to resume the calling process
+);
+
 /** Custom types for Viua VM can be written in C++ and loaded into the typesystem with minimal amount of bookkeeping.
  *  The only thing Viua needs to use a pure-C++ class is a string-name-to-member-function-pointer mapping as
  *  the machine must be able to somehow dispatch the methods.
@@ -74,10 +125,81 @@ typedef std::function<void(Type*, Frame*, RegisterSet*, RegisterSet*, Process*,
  *  Should a module fail to provide this function, it is deemed invalid and is rejected by the VM.
  *
  *  The "exports()" function returns an array of below structures.
+ *
+ *  Functions that never block (e.g. pure computations) should be marked as non-blocking.
+ *  The VM calls them directly on the scheduler thread running the calling process instead of
+ *  suspending the process and dispatching the call to an FFI scheduler, which is much cheaper.
  */
 struct ForeignFunctionSpec {
     const char* name;
     ForeignFunction* fpointer;
+    bool nonblocking = false;
+};
+
+/** Typed foreign functions do not deal with frames and boxed objects at all.
+ *  They declare types of their parameters and return value, and
+ *  the VM unboxes arguments from registers, calls the function with plain values, and
+ *  boxes the result.
+ *  Typed functions are always called directly on the scheduler thread (just like non-blocking functions) so
+ *  they must not block.
+ *
+ *  Values are converted as follows:
+ *
+ *      FOREIGN_INT64   <-> Integer; returning a value out of the range of Integer raises an exception
+ *      FOREIGN_DOUBLE  <-> Float (rounded to the precision of Float on return)
+ *      FOREIGN_STRING  <-> String; argument strings are views valid only for the duration of the call,
+ *                          returned strings are copied by the VM immediately after the call so they may
+ *                          point to static or thread-local storage
+ *      FOREIGN_BYTES   <-> Vector of Bytes (or String, as an argument); arguments are copied into buffers
+ *                          valid only for the duration of the call (strings are passed as views),
+ *                          returned bytes are copied into a new Vector immediately after the call
+ */
+enum ForeignValueType {
+    FOREIGN_VOID = 0,
+    FOREIGN_INT64,
+    FOREIGN_DOUBLE,
+    FOREIGN_STRING,
+    FOREIGN_BYTES,
+};
+
+union ForeignValue {
+    int64_t int64;
+    double float64;
+    struct {
+        const char* data;
+        uint64_t size;
+    } string;
+    struct {
+        const unsigned char* data;
+        uint64_t size;
+    } bytes;
+};
+
+const unsigned MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS = 8;
+
+typedef void (TypedForeignFunction)(
+    const ForeignValue*,    // arguments, in the order of declared parameter types
+    ForeignValue*           // return value (ignored if function returns FOREIGN_VOID)
+);
+
+/** External modules may also export the "async_exports()" function.
+ *  It is optional and returns an array of below structures, terminated by an entry with null name.
+ */
+struct AsyncForeignFunctionSpec {
+    const char* name;
+    AsyncForeignFunction* fpointer;
+};
+
+/** External modules may also export the "typed_exports()" function.
+ *  It is optional and returns an array of below structures, terminated by an entry with null name.
+ *  Parameter types are listed until the first FOREIGN_VOID, and
+ *  their number must match the arity in the name of the function.
+ */
+struct TypedForeignFunctionSpec {
+    const char* name;
+    TypedForeignFunction* fpointer;
+    ForeignValueType return_type = FOREIGN_VOID;
+    ForeignValueType parameters[MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS] = {};
 };
 
 
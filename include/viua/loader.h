@@ -24,53 +24,177 @@
 
 
 #include <cstdint>
-#include <fstream>
+#include <algorithm>
 #include <tuple>
 #include <string>
 #include <vector>
 #include <map>
+#include <utility>
+#include <memory>
+#include <mutex>
 #include <viua/machine.h>
 #include <viua/bytecode/bytetypedef.h>
 
 typedef std::tuple<std::vector<std::string>, std::map<std::string, uint64_t> > IdToAddressMapping;
 
-template<class T> void readinto(std::ifstream& in, T* object) {
-    in.read(reinterpret_cast<char*>(object), sizeof(T));
-}
+class MappedModule {
+    /** Read-only, private memory mapping of a compiled module.
+     *
+     *  Bytecode is executed in place from the mapping so the kernel can share
+     *  the pages of a module between all VM processes that load it.
+     */
+    byte* address;
+    uint64_t length;
+
+    public:
+    byte* data() const;
+    uint64_t size() const;
+
+    MappedModule(const std::string&);
+    ~MappedModule();
+
+    MappedModule(const MappedModule&) = delete;
+    MappedModule& operator=(const MappedModule&) = delete;
+};
+
+class AddressTable {
+    /** Open-addressing hash table mapping names of functions (or blocks) to their bytecode addresses.
+     *
+     *  Tables are precomputed by the assembler and queried in place, inside the mapping of a module,
+     *  so loading a module does not require building any maps.
+     *  Encoded table is laid out as follows (all numbers are uint64_t):
+     *
+     *      <slot count (power of two)> <entry count> (<hash> <name offset> <address>)... <names>
+     *
+     *  where name offset of an empty slot is EMPTY_SLOT, and names are null-terminated.
+     */
+    std::shared_ptr<std::vector<byte>> storage;
+    const byte* slots;
+    uint64_t slot_count;
+    uint64_t entry_count;
+    const char* names;
+    uint64_t names_size;
+
+    public:
+    static const uint64_t EMPTY_SLOT;
+
+    static uint64_t hash(const std::string&);
+    static std::vector<byte> encode(const std::vector<std::pair<std::string, uint64_t>>&);
+
+    bool find(const std::string&, uint64_t&) const;
+    bool find(const std::string&, uint64_t, uint64_t&) const;
+    uint64_t size() const;
+
+    AddressTable();
+    AddressTable(const byte*, uint64_t);
+    AddressTable(std::vector<byte>);
+};
+
+class LineTable {
+    /** Table mapping bytecode offsets to lines of the source file the bytecode was assembled from.
+     *
+     *  Tables are written by the assembler only when requested, after the bytecode, so that
+     *  pages holding them are not touched unless a line is looked up.
+     *  Encoded table is laid out as follows:
+     *
+     *      <source file name> (<offset delta> <line delta>)...
+     *
+     *  where the name is null-terminated, and deltas are differences from the previous entry encoded as
+     *  LEB128 numbers (line deltas are zigzag-encoded as lines may go back).
+     *  An entry covers bytecode from its offset to the offset of the next entry, and
+     *  line 0 marks bytecode that has no source line (e.g. the entry function, or statically linked functions).
+     *  Entries are decoded when the first line is looked up.
+     */
+    std::shared_ptr<MappedModule> image;
+    const byte* encoded;
+    uint64_t encoded_size;
+
+    std::once_flag decoded;
+    std::string source_file;
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> lines;
+
+    void decode();
+
+    public:
+    static std::vector<byte> encode(const std::string&, const std::vector<std::pair<uint64_t, uint64_t>>&);
+
+    const std::string& file();
+    uint64_t line(uint64_t);
+
+    LineTable(std::shared_ptr<MappedModule>, const byte*, uint64_t);
+};
 
 class Loader {
     std::string path;
 
+    std::shared_ptr<MappedModule> image;
+    uint64_t offset;
+    uint8_t format_revision;
+
     uint64_t size;
     byte* bytecode;
 
     std::vector<uint64_t> jumps;
 
+    std::vector<std::string> symbols;
+    std::vector<uint64_t> symbol_references;
+
     std::map<std::string, std::string> meta_information;
 
     std::vector<std::string> external_signatures;
     std::vector<std::string> external_signatures_block;
 
+    /*  Name/address lists are kept in the mapping and parsed into maps only when
+     *  somebody asks for them; running code uses address tables instead.
+     */
+    std::pair<char*, uint64_t> functions_map_section;
+    std::pair<char*, uint64_t> blocks_map_section;
+    bool address_maps_parsed;
+
     std::map<std::string, uint64_t> function_addresses;
     std::map<std::string, uint64_t> function_sizes;
     std::vector<std::string> functions;
     std::map<std::string, uint64_t> block_addresses;
     std::vector<std::string> blocks;
 
+    AddressTable function_table;
+    AddressTable block_table;
+    AddressTable register_count_table;
+
+    std::pair<byte*, uint64_t> line_table_section;
+
     IdToAddressMapping loadmap(char*, const uint64_t&);
+    void parseAddressMaps();
     void calculateFunctionSizes();
 
-    void loadMagicNumber(std::ifstream&);
-    void assumeBinaryType(std::ifstream&, ViuaBinaryType);
+    byte* take(uint64_t);
+    template<class T> T readvalue() {
+        T object;
+        byte* source = take(sizeof(T));
+        std::copy(source, source+sizeof(T), reinterpret_cast<byte*>(&object));
+        return object;
+    }
+    std::map<std::string, std::string> readStringMap();
+    std::vector<std::string> readStringList();
+
+    void open();
+
+    void loadMagicNumber();
+    void assumeBinaryType(ViuaBinaryType);
 
-    void loadMetaInformation(std::ifstream&);
+    void loadMetaInformation();
 
-    void loadExternalSignatures(std::ifstream&);
-    void loadExternalBlockSignatures(std::ifstream&);
-    void loadJumpTable(std::ifstream&);
-    void loadFunctionsMap(std::ifstream&);
-    void loadBlocksMap(std::ifstream&);
-    void loadBytecode(std::ifstream&);
+    void loadExternalSignatures();
+    void loadExternalBlockSignatures();
+    void loadJumpTable();
+    void loadSymbolReferences();
+    void loadSymbolTable();
+    void loadFunctionsMap();
+    void loadBlocksMap();
+    void loadAddressTables();
+    void loadBytecode();
+    void loadLineTable();
 
     public:
     Loader& load();
@@ -78,9 +202,15 @@ class Loader {
 
     uint64_t getBytecodeSize();
     byte* getBytecode();
+    byte* getMappedBytecode();
+    std::shared_ptr<MappedModule> getImage();
+    uint8_t getFormatRevision();
 
     std::vector<uint64_t> getJumps();
 
+    std::vector<std::string> getSymbols();
+    std::vector<uint64_t> getSymbolReferences();
+
     std::map<std::string, std::string> getMetaInformation();
 
     std::vector<std::string> getExternalSignatures();
@@ -93,10 +223,16 @@ class Loader {
     std::map<std::string, uint64_t> getBlockAddresses();
     std::vector<std::string> getBlocks();
 
-    Loader(std::string pth): path(pth), size(0), bytecode(nullptr) {}
-    ~Loader() {
-        delete[] bytecode;
-    }
+    AddressTable getFunctionTable();
+    AddressTable getBlockTable();
+    AddressTable getRegisterCountTable();
+    std::shared_ptr<LineTable> getLineTable();
+
+    Loader(std::string pth):
+        path(pth), image(nullptr), offset(0), format_revision(0), size(0), bytecode(nullptr),
+        functions_map_section(nullptr, 0), blocks_map_section(nullptr, 0), address_maps_parsed(false),
+        line_table_section(nullptr, 0)
+    {}
 };
 
 
@@ -23,9 +23,24 @@
 #pragma once
 
 
+#include <cstdint>
+
+
 extern const char *ENTRY_FUNCTION_NAME;
 extern const char *VIUA_MAGIC_NUMBER;
 
+/*  Revision of the bytecode file format is stored in the last byte of the magic number.
+ *  Revision 0 denotes files produced before the revision byte was introduced (the magic number
+ *  was then terminated by a null byte).
+ *
+ *  1: bytecode section starts at an aligned offset
+ *  2: names used by call-like instructions are stored in symbol table section, and referred to by index
+ *  3: function and block addresses are also stored in hash tables that the loader queries in place
+ *  4: numbers of local registers needed by functions are stored in a hash table after address tables
+ */
+extern const uint8_t VIUA_FORMAT_REVISION;
+extern const uint64_t VIUA_BYTECODE_SECTION_ALIGNMENT;
+
 typedef char ViuaBinaryType;
 
 extern const ViuaBinaryType VIUA_LINKABLE;
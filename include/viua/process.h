@@ -33,6 +33,7 @@
 #include <viua/cpu/registerset.h>
 #include <viua/cpu/frame.h>
 #include <viua/cpu/tryframe.h>
+#include <viua/cpu/symbols.h>
 #include <viua/include/module.h>
 
 
@@ -49,6 +50,9 @@ class HaltException : public std::runtime_error {
 namespace viua {
     namespace scheduler {
         class VirtualProcessScheduler;
+        class DispatchStatistics;
+        class AllocationProfiler;
+        class Tracer;
     }
 }
 
@@ -61,6 +65,8 @@ class Process {
 
     Process* parent_process;
     const std::string entry_function;
+    // assigned when the process is spawned, and never reused
+    const uint64_t process_id;
 
     // Global register set
     std::unique_ptr<RegisterSet> regset;
@@ -77,6 +83,13 @@ class Process {
 
     // Call stack
     byte* jump_base;
+
+    /*  Symbol table of the module that was executing when the last symbol operand was decoded, and
+     *  a scratch symbol for names embedded in bytecode produced by older assemblers.
+     */
+    viua::cpu::ModuleSymbols* current_module;
+    viua::cpu::Symbol inline_symbol;
+    const viua::cpu::Symbol& fetchSymbol(byte*&);
     std::vector<std::unique_ptr<Frame>> frames;
     std::unique_ptr<Frame> frame_new;
 
@@ -98,6 +111,16 @@ class Process {
     // FIXME: change unsigned to uint64_t
     uint64_t instruction_counter;
     byte* instruction_pointer;
+    // instruction that threw the active exception (stack traces show its source line)
+    byte* thrown_from;
+
+    // dispatched instructions are counted if statistics are gathered
+    viua::scheduler::DispatchStatistics* statistics;
+    unsigned previous_opcode;
+    // allocations are attributed to instructions if they are profiled
+    viua::scheduler::AllocationProfiler* allocations;
+    // scheduling events of the process are recorded if they are traced
+    viua::scheduler::Tracer* tracer;
 
     std::queue<std::unique_ptr<Type>> message_queue;
 
@@ -119,10 +142,11 @@ class Process {
     byte* adjustJumpBaseFor(const std::string&);
     // call native (i.e. written in Viua) function
     byte* callNative(byte*, const std::string&, const bool, const unsigned, const std::string&);
+    byte* callNativeAt(std::pair<byte*, byte*>, byte*, const std::string&, const bool, const unsigned, const uint64_t = 0);
     // call foreign (i.e. from a C++ extension) function
     byte* callForeign(byte*, const std::string&, const bool, const unsigned, const std::string&);
     // call foreign method (i.e. method of a pure-C++ class loaded into machine's typesystem)
-    byte* callForeignMethod(byte*, Type*, const std::string&, const bool, const unsigned, const std::string&);
+    byte* callForeignMethod(byte*, Type*, int, const std::string&, const bool, const unsigned);
 
     /*  Stack unwinding methods.
      */
@@ -267,6 +291,7 @@ class Process {
         bool suspended() const;
 
         Process* parent() const;
+        uint64_t id() const;
 
         void pass(std::unique_ptr<Type>);
 
@@ -287,8 +312,12 @@ class Process {
         byte* begin();
         uint64_t counter() const;
         auto executionAt() const -> decltype(instruction_pointer);
+        auto executionBase() const -> decltype(jump_base);
+        byte* thrownFrom() const;
+        bool sourceLineOf(const byte*, std::string&, uint64_t&) const;
 
         std::vector<Frame*> trace() const;
+        Frame* currentFrame() const;
 
         Process(std::unique_ptr<Frame>, viua::scheduler::VirtualProcessScheduler*, Process*);
         ~Process();
@@ -20,6 +20,7 @@
 #ifndef VIUA_PROGRAM_H
 #define VIUA_PROGRAM_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <tuple>
@@ -35,6 +36,19 @@ enum JUMPTYPE {
 };
 
 
+class SymbolTable {
+    /** Names of functions and blocks referenced by bytecode of a module.
+     *  Each name is stored once, and instructions refer to it by index.
+     */
+    std::vector<std::string> names;
+    std::map<std::string, uint32_t> indexes;
+
+    public:
+    uint32_t intern(const std::string&);
+    const std::vector<std::string>& symbols() const;
+};
+
+
 class Program {
     // byte array containing bytecode
     byte* program;
@@ -55,6 +69,13 @@ class Program {
     std::vector<byte*> branches;
     std::vector<byte*> branches_absolute;
 
+    /** Symbol operands must be stored so the linker can remap them when
+     *  the bytecode is linked into another module.
+     */
+    SymbolTable* symbols;
+    std::vector<byte*> symbol_references;
+    uint32_t symbol(const std::string&);
+
     // simple, whether to print debugging information or not
     bool debug;
     bool scream;
@@ -151,9 +172,9 @@ class Program {
     Program& opbranch     (int_op, uint64_t, enum JUMPTYPE, uint64_t, enum JUMPTYPE);
 
     Program& optry      ();
-    Program& opcatch    (std::string, std::string);
+    Program& opcatch    (std::string, const std::string&);
     Program& oppull       (int_op);
-    Program& openter    (std::string);
+    Program& openter    (const std::string&);
     Program& opthrow    (int_op);
     Program& opleave      ();
 
@@ -181,19 +202,21 @@ class Program {
     Program& calculateJumps(std::vector<std::tuple<uint64_t, uint64_t> >);
     std::vector<uint64_t> jumps();
     std::vector<uint64_t> jumpsAbsolute();
+    std::vector<uint64_t> symbolReferences();
 
     byte* bytecode();
     Program& fill(byte*);
 
     Program& setdebug(bool d = true);
     Program& setscream(bool d = true);
+    Program& setsymbols(SymbolTable*);
 
     uint64_t size();
     unsigned long instructionCount();
 
     static uint64_t countBytes(const std::vector<std::string>&);
 
-    Program(uint64_t bts = 2): bytes(bts), debug(false), scream(false) {
+    Program(uint64_t bts = 2): bytes(bts), symbols(nullptr), debug(false), scream(false) {
         program = new byte[bytes];
         /* Filling bytecode with zeroes (which are interpreted by CPU as NOP instructions) is a safe way
          * to prevent many hiccups.
@@ -201,7 +224,7 @@ class Program {
         for (decltype(bytes) i = 0; i < bytes; ++i) { program[i] = byte(0); }
         addr_ptr = program;
     }
-    Program(const Program& that): program(nullptr), bytes(that.bytes), addr_ptr(nullptr), branches({}) {
+    Program(const Program& that): program(nullptr), bytes(that.bytes), addr_ptr(nullptr), branches({}), symbols(that.symbols) {
         program = new byte[bytes];
         for (decltype(bytes) i = 0; i < bytes; ++i) {
             program[i] = that.program[i];
@@ -210,6 +233,9 @@ class Program {
         for (unsigned i = 0; i < that.branches.size(); ++i) {
             branches.push_back(program+(that.branches[i]-that.program));
         }
+        for (unsigned i = 0; i < that.symbol_references.size(); ++i) {
+            symbol_references.push_back(program+(that.symbol_references[i]-that.program));
+        }
     }
     ~Program() {
         delete[] program;
@@ -228,6 +254,11 @@ class Program {
             for (unsigned i = 0; i < that.branches.size(); ++i) {
                 branches.push_back(program+(that.branches[i]-that.program));
             }
+            symbols = that.symbols;
+            symbol_references.clear();
+            for (unsigned i = 0; i < that.symbol_references.size(); ++i) {
+                symbol_references.push_back(program+(that.symbol_references[i]-that.program));
+            }
         }
         return (*this);
     }
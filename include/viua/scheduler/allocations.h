@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_ALLOCATIONS_H
+#define VIUA_SCHEDULER_ALLOCATIONS_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <fstream>
+
+
+class Process;
+
+
+namespace viua {
+    namespace scheduler {
+        class AllocationProfiler {
+            /** Profiler of allocations of VM objects (i.e. objects derived from Type), frames, and register sets.
+             *
+             *  Allocations are attributed to the function and opcode that was executing when they were made.
+             *  Type of an object cannot be known when it is allocated (its constructor has not run yet) so
+             *  types of objects are resolved after the instruction that allocated them finishes; objects that
+             *  are freed by the same instruction that allocated them are counted as temporaries.
+             *  Frames and register sets are counted as "Frame" and "RegisterSet" types.
+             *
+             *  Only objects allocated by the VM itself are seen; objects allocated by native modules use
+             *  allocation functions of the modules.
+             */
+            struct allocation_t {
+                std::size_t size;
+                // empty until resolved
+                std::string type;
+                std::thread::id thread;
+            };
+            struct counts_t {
+                uint64_t allocations, frees, allocated_bytes, freed_bytes;
+            };
+
+            const std::string output_path;
+            const std::chrono::milliseconds interval;
+
+            std::mutex allocations_mutex;
+            std::unordered_map<const void*, allocation_t> live;
+            // allocations whose types are not resolved yet
+            std::vector<const void*> pending;
+            std::map<std::string, counts_t> types;
+            // allocations by function and opcode
+            std::map<std::tuple<std::string, unsigned>, counts_t> sites;
+
+            std::chrono::steady_clock::time_point started, last_snapshot;
+            std::ofstream snapshots;
+
+            static std::atomic<AllocationProfiler*> active;
+            // process (and its opcode) executing on the calling thread, set only for the duration of an instruction
+            static thread_local const Process* allocating_process;
+            static thread_local unsigned allocating_opcode;
+
+            // type is empty if it is not known yet
+            static void allocatedAs(void*, std::size_t, const std::string&);
+            static void allocated(void*, std::size_t);
+            static void allocatedFrame(void*, std::size_t);
+            static void allocatedRegisterSet(void*, std::size_t);
+            static void deallocated(void*, std::size_t);
+
+            void resolve(bool);
+            void snapshot();
+
+            public:
+
+            // opcode of allocations made outside of processes
+            static const unsigned NONE = 256;
+
+            void dispatching(const Process*, unsigned);
+            void dispatched();
+            static void resolvePending();
+
+            void snapshotIfDue();
+            bool write();
+
+            AllocationProfiler(const std::string&, unsigned);
+            ~AllocationProfiler();
+        };
+    }
+}
+
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_PERFMAP_H
+#define VIUA_SCHEDULER_PERFMAP_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <viua/bytecode/bytetypedef.h>
+
+
+class Frame;
+class Process;
+
+
+namespace viua {
+    namespace scheduler {
+        class PerfMap {
+            /** Support for attributing samples taken by Linux perf to Viua functions.
+             *
+             *  Samples taken while the VM executes bytecode land in the interpreter, so perf would attribute all
+             *  of them to the dispatch loop.
+             *  To make functions visible to perf every function gets its own copy of a tiny native trampoline, and
+             *  instructions of a function are executed through its trampoline.
+             *  Samples then contain the trampoline of the function that executes an instruction, and
+             *  addresses of trampolines are written (together with names of functions) to /tmp/perf-<pid>.map
+             *  which perf reads to symbolise addresses that do not belong to any loaded binary.
+             *  Only the innermost function has its trampoline on the native stack so samples are attributed to
+             *  functions, not to Viua call chains (callers of a function do not appear in its samples).
+             *
+             *  Trampolines are created when functions are first executed, and
+             *  are supported only on x86-64.
+             */
+            typedef byte* (*Tick)(Process*);
+            typedef byte* (*Trampoline)(Process*, Tick);
+
+            const std::string map_path;
+            std::ofstream map;
+
+            // executable pages that trampolines are copied to
+            std::vector<void*> pages;
+            unsigned used_in_last_page;
+
+            std::mutex trampolines_mutex;
+            std::unordered_map<std::string, Trampoline> trampolines;
+
+            // every scheduler thread executes its own processes so trampolines are cached per thread
+            static thread_local const Frame* cached_frame;
+            static thread_local std::string cached_function;
+            static thread_local Trampoline cached_trampoline;
+
+            // exceptions must not be thrown through trampolines because they have no unwinding information
+            static thread_local std::exception_ptr thrown;
+            static byte* tickProcess(Process*);
+
+            Trampoline trampolineFor(const std::string&);
+
+            public:
+
+            static bool supported();
+
+            const std::string& path() const;
+            bool good() const;
+            byte* tick(Process*);
+
+            PerfMap();
+            ~PerfMap();
+        };
+    }
+}
+
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_PROFILER_H
+#define VIUA_SCHEDULER_PROFILER_H
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <map>
+#include <tuple>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <viua/bytecode/opcodes.h>
+
+
+class Process;
+
+
+namespace viua {
+    namespace scheduler {
+        class Profiler {
+            /** Sampling profiler of Viua VM virtual processes.
+             *
+             *  A timer thread marks a sample as due every interval, and
+             *  the scheduler takes the sample before it executes the next instruction of a process.
+             *  Samples are aggregated as they are taken so memory used by the profiler does not grow
+             *  with the running time of the program.
+             */
+            const std::string output_path;
+            const unsigned interval;
+
+            std::atomic_bool sample_due;
+
+            bool stopping;
+            std::mutex timer_mutex;
+            std::condition_variable timer_condition;
+            std::thread timer;
+
+            uint64_t samples;
+
+            // call stacks (in folded format) to number of samples taken in them
+            std::map<std::string, uint64_t> stacks;
+            // functions to numbers of samples taken in them, and in functions they called
+            std::map<std::string, std::tuple<uint64_t, uint64_t>> functions;
+            std::map<OPCODE, uint64_t> opcodes;
+            // instructions (function, offset in bytecode of its module, and opcode) to number of samples taken at them
+            std::map<std::tuple<std::string, uint64_t, OPCODE>, uint64_t> instructions;
+            // source lines (file:line) to number of samples taken at instructions assembled from them
+            std::map<std::string, uint64_t> lines;
+
+            void tick();
+
+            public:
+
+            inline bool due() const {
+                return sample_due.load(std::memory_order_relaxed);
+            }
+            void sample(const Process*);
+
+            void stop();
+            bool write() const;
+
+            Profiler(const std::string&, unsigned);
+            ~Profiler();
+        };
+    }
+}
+
+
+#endif
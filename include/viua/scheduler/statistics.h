@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_STATISTICS_H
+#define VIUA_SCHEDULER_STATISTICS_H
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <atomic>
+#include <viua/bytecode/opcodes.h>
+
+
+namespace viua {
+    namespace scheduler {
+        class DispatchStatistics {
+            /** Counters of instructions executed by Viua VM virtual processes.
+             *
+             *  Every dispatched instruction is counted (together with the instruction that the same process
+             *  dispatched before it), and every function call is counted.
+             *  Timing every instruction would slow the VM down more than the instructions themselves take so
+             *  only one of every TIMING_INTERVAL dispatched instructions (on average) is timed, and
+             *  total time of every opcode is estimated from the timed ones.
+             *  Instructions are counted across quanta so that sampling rate does not depend on process priorities.
+             *  Distance between timed instructions varies so that loops whose length divides the interval
+             *  do not have the same instruction timed every time.
+             */
+            const std::string output_path;
+
+            uint64_t dispatched_instructions;
+            std::vector<uint64_t> opcodes;
+            // counts of opcode pairs, indexed by (previous opcode * 256 + opcode)
+            std::vector<uint64_t> pairs;
+            std::vector<uint64_t> timed_opcodes;
+            std::vector<uint64_t> timed_ticks;
+            std::unordered_map<std::string, uint64_t> calls;
+
+            uint64_t timings;
+            // instructions to dispatch before the next one is timed
+            uint64_t until_timed;
+
+            static std::atomic_bool dump_requested;
+
+            public:
+
+            // number of different opcodes, opcodes previous to the first instruction of a process are NONE
+            static const unsigned OPCODES = 256;
+            static const unsigned NONE = OPCODES;
+
+            static const unsigned TIMING_INTERVAL = 64;
+
+            static const char* clock_name();
+            static uint64_t clock();
+
+            inline void dispatched(unsigned previous, OPCODE opcode) {
+                ++dispatched_instructions;
+                ++opcodes[opcode];
+                if (previous != NONE) {
+                    ++pairs[(previous * OPCODES) + opcode];
+                }
+            }
+            inline bool timeNext() {
+                if (--until_timed) {
+                    return false;
+                }
+                // distances are spread over [TIMING_INTERVAL/2, TIMING_INTERVAL*3/2) and average to TIMING_INTERVAL
+                until_timed = ((TIMING_INTERVAL / 2) + ((++timings * 7919) % TIMING_INTERVAL));
+                return true;
+            }
+            void timed(OPCODE, uint64_t);
+            void called(const std::string&);
+
+            // dumps can be requested from signal handlers, and are written by the scheduler
+            static void requestDump();
+            bool dumpRequested();
+
+            bool write() const;
+
+            DispatchStatistics(const std::string&);
+        };
+    }
+}
+
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_TRACER_H
+#define VIUA_SCHEDULER_TRACER_H
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+
+
+class Process;
+
+
+namespace viua {
+    namespace scheduler {
+        class Tracer {
+            /** Tracer of events of Viua VM virtual processes, and threads that run them.
+             *
+             *  Events are recorded (with timestamps and ids of threads that recorded them) into a ring buffer of
+             *  fixed size so that tracing long-running programs uses constant memory, and
+             *  the most recent events are kept when the buffer fills up.
+             *  Events may be recorded by the scheduler and by foreign function call workers at the same time.
+             */
+            public:
+
+            enum class Event {
+                SPAWN,
+                QUANTUM,
+                SUSPEND,
+                WAKEUP,
+                FFI_REQUEST,
+                FFI_COMPLETE,
+                SEND,
+                RECEIVE,
+                EXIT,
+            };
+
+            private:
+
+            struct event_t {
+                Event kind;
+                unsigned thread;
+                // nanoseconds since the tracer was created
+                uint64_t timestamp;
+                // duration of quanta
+                uint64_t duration;
+                uint64_t process;
+                // parent process of spawned processes, instructions executed in quanta, and ids of foreign calls
+                uint64_t related;
+                // function names, and types of exceptions that terminated processes
+                std::string detail;
+            };
+
+            const std::string output_path;
+            const std::chrono::steady_clock::time_point started;
+
+            std::mutex events_mutex;
+            std::vector<event_t> events;
+            uint64_t recorded;
+
+            static std::atomic<unsigned> threads;
+            static thread_local unsigned thread_index;
+            static unsigned thread();
+
+            void record(Event, uint64_t, uint64_t, const std::string&, uint64_t, uint64_t = 0);
+
+            public:
+
+            uint64_t now() const;
+
+            void spawned(const Process*, const std::string&, const Process*);
+            void quantum(const Process*, const std::string&, uint64_t, uint64_t);
+            void suspended(const Process*);
+            void wokenUp(const Process*);
+            void foreignCallRequested(const Process*, const std::string&, const void*);
+            void foreignCallCompleted(const Process*, const std::string&, const void*);
+            void sent(const Process*);
+            void received(const Process*);
+            void exited(const Process*, const std::string&);
+
+            bool write();
+
+            Tracer(const std::string&, unsigned);
+        };
+    }
+}
+
+
+#endif
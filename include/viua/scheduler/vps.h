@@ -22,10 +22,12 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <memory>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/cpu/frame.h>
+#include <viua/cpu/symbols.h>
 
 
 class CPU;
@@ -34,10 +36,34 @@ class Process;
 
 namespace viua {
     namespace scheduler {
+        class Profiler;
+        class DispatchStatistics;
+        class AllocationProfiler;
+        class Tracer;
+        class PerfMap;
+    }
+}
+
+
+namespace viua {
+    namespace scheduler {
+        struct ForeignMethodCallSite {
+            // id of the method, or -1 if the call site does not call a foreign method
+            int method;
+            std::string name;
+            // link generation in which a negative result was cached
+            uint64_t link_generation;
+        };
+
         class VirtualProcessScheduler {
             /** Scheduler of Viua VM virtual processes.
              */
             CPU *attached_cpu;
+            Profiler *profiler;
+            DispatchStatistics *statistics;
+            AllocationProfiler *allocations;
+            Tracer *tracer;
+            PerfMap *perf_map;
 
             Process *main_process;
             std::vector<std::unique_ptr<Process>> processes;
@@ -48,6 +74,9 @@ namespace viua {
 
             int exit_code;
 
+            // call sites (addresses of function name operands) already resolved to foreign methods
+            std::unordered_map<const byte*, ForeignMethodCallSite> foreign_method_call_sites;
+
             void resurrectWatchdog();
 
             public:
@@ -62,6 +91,8 @@ namespace viua {
             bool isNativeFunction(const std::string&) const;
             bool isForeignMethod(const std::string&) const;
             bool isForeignFunction(const std::string&) const;
+            bool isNonblockingForeignFunction(const std::string&) const;
+            bool isTypedForeignFunction(const std::string&) const;
 
             bool isBlock(const std::string&) const;
             bool isLocalBlock(const std::string&) const;
@@ -70,11 +101,20 @@ namespace viua {
 
             std::string resolveMethodName(const std::string&, const std::string&) const;
             std::pair<byte*, byte*> getEntryPointOf(const std::string&) const;
+            viua::cpu::ModuleSymbols* moduleSymbolsAt(const byte*) const;
+            uint64_t linkGeneration() const;
+            void resolveSymbol(viua::cpu::Symbol&) const;
+            uint64_t registerCountOf(const std::string&, std::pair<byte*, byte*>) const;
+            bool sourceLineOf(const byte*, std::string&, uint64_t&) const;
 
             void registerPrototype(Prototype*);
 
             void requestForeignFunctionCall(Frame*, Process*) const;
-            void requestForeignMethodCall(const std::string&, Type*, Frame*, RegisterSet*, RegisterSet*, Process*);
+            void callNonblockingForeignFunction(Frame*, Process*) const;
+            void callTypedForeignFunction(Frame*, Process*) const;
+            int foreignMethodId(const std::string&) const;
+            const ForeignMethodCallSite* foreignMethodCallSite(const byte*, const std::string&);
+            void callForeignMethod(int, Type*, Frame*, RegisterSet*, RegisterSet*, Process*);
 
             void loadNativeLibrary(const std::string&);
             void loadForeignLibrary(const std::string&);
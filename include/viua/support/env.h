@@ -23,6 +23,7 @@
 #pragma once
 
 #include <sys/stat.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,7 @@ namespace support {
         std::string getvar(const std::string&);
 
         bool isfile(const std::string&);
+        bool identify(const std::string&, std::vector<uint64_t>&);
 
         namespace viua {
             std::string getmodpath(const std::string&, const std::string&, const std::vector<std::string>&);
@@ -69,6 +69,7 @@ namespace str {
     bool contains(const std::string&s, const char c);
 
     std::string enquote(const std::string&);
+    std::string jsonquote(const std::string&);
     std::string strdecode(const std::string&);
     std::string strencode(const std::string&);
 
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <atomic>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -85,6 +87,14 @@ class Type {
 
         virtual Type* copy() const = 0;
 
+        /*  Allocations and deallocations of objects are reported to hooks if they are set (e.g. by
+         *  allocation profiler).
+         */
+        static std::atomic<void (*)(void*, std::size_t)> allocation_hook;
+        static std::atomic<void (*)(void*, std::size_t)> deallocation_hook;
+        static void* operator new(std::size_t);
+        static void operator delete(void*, std::size_t);
+
         // We need to construct and destroy our basic object.
         Type() {}
         virtual ~Type();
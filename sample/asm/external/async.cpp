@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <thread>
+#include <chrono>
+#include <viua/types/type.h>
+#include <viua/types/exception.h>
+#include <viua/cpu/frame.h>
+#include <viua/cpu/registerset.h>
+#include <viua/include/module.h>
+using namespace std;
+
+
+extern "C" const ForeignFunctionSpec* exports();
+extern "C" const AsyncForeignFunctionSpec* async_exports();
+
+
+static void async_echo(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*, ForeignCallCompletion* completion) {
+    if (frame->args->at(0) == nullptr) {
+        throw new Exception("expected a value as first argument");
+    }
+
+    Type* value = frame->args->at(0)->copy();
+
+    // return immediately and finish the call from another thread
+    thread([frame, value, completion]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        frame->regset->set(0, value);
+        completion->complete();
+    }).detach();
+}
+
+static void async_fail(Frame*, RegisterSet*, RegisterSet*, Process*, CPU*, ForeignCallCompletion* completion) {
+    thread([completion]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        completion->fail(new Exception("OH NOES!"));
+    }).detach();
+}
+
+
+const ForeignFunctionSpec functions[] = {
+    { nullptr, nullptr },
+};
+
+const AsyncForeignFunctionSpec async_functions[] = {
+    { "async::echo/1", &async_echo },
+    { "async::fail/0", &async_fail },
+    { nullptr, nullptr },
+};
+
+extern "C" const ForeignFunctionSpec* exports() {
+    return functions;
+}
+
+extern "C" const AsyncForeignFunctionSpec* async_exports() {
+    return async_functions;
+}
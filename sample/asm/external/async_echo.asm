@@ -0,0 +1,32 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: async::echo/1
+
+.function: main/1
+    import "build/test/async"
+
+    -- the call returns only after the module completes it from its own thread
+    frame ^[(param 0 (strstore 1 "Hello World!"))]
+    call 2 async::echo/1
+    print 2
+
+    izero 0
+    return
+.end
@@ -45,7 +45,7 @@ static void math_sqrt(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*)
 
 
 const ForeignFunctionSpec functions[] = {
-    { "math::sqrt/1", &math_sqrt },
+    { "math::sqrt/1", &math_sqrt, true },
     { nullptr, nullptr },
 };
 
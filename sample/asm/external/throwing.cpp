@@ -38,6 +38,7 @@ static void throwing_oh_noes(Frame*, RegisterSet*, RegisterSet*, Process*, CPU*)
 
 const ForeignFunctionSpec functions[] = {
     { "throwing::oh_noes/0", &throwing_oh_noes },
+    { "throwing::oh_noes_nonblocking/0", &throwing_oh_noes, true },
     { nullptr, nullptr },
 };
 
@@ -0,0 +1,43 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: throwing::oh_noes_nonblocking/0
+
+.block: __try
+    -- non-blocking functions are called directly by the process so
+    -- the exception is thrown by the call instruction itself
+    frame 0
+    call 0 throwing::oh_noes_nonblocking/0
+    leave
+.end
+.block: __catch_Exception
+    print (pull 1)
+    leave
+.end
+
+.function: main/1
+    import "build/test/throwing"
+
+    try
+    catch "Exception" __catch_Exception
+    enter __try
+
+    izero 0
+    return
+.end
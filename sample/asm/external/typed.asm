@@ -0,0 +1,76 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: typed::add/2
+.signature: typed::hypot/2
+.signature: typed::length/1
+.signature: typed::upper/1
+.signature: typed::reverse/1
+
+.block: __try
+    -- arguments of wrong types are rejected before the function is called
+    frame ^[(param 0 (strstore 1 "40")) (param 1 (istore 2 2))]
+    call 3 typed::add/2
+    leave
+.end
+.block: __catch_Exception
+    print (pull 1)
+    leave
+.end
+
+.block: __try_overflow
+    -- results that do not fit in Integer are not truncated
+    frame ^[(param 0 (istore 1 2147483647)) (param 1 (istore 2 1))]
+    call 3 typed::add/2
+    leave
+.end
+
+.function: main/1
+    import "build/test/typed"
+
+    frame ^[(param 0 (istore 1 40)) (param 1 (istore 2 2))]
+    print (call 3 typed::add/2)
+
+    frame ^[(param 0 (fstore 1 3.0)) (param 1 (fstore 2 4.0))]
+    print (call 3 typed::hypot/2)
+
+    frame ^[(param 0 (strstore 1 "Hello World!"))]
+    print (call 3 typed::length/1)
+
+    frame ^[(param 0 1)]
+    print (call 3 typed::upper/1)
+
+    vec 1
+    vpush 1 (bstore 2 72)
+    vpush 1 (bstore 2 105)
+    vpush 1 (bstore 2 33)
+    frame ^[(param 0 1)]
+    print (call 3 typed::reverse/1)
+
+    try
+    catch "Exception" __catch_Exception
+    enter __try
+
+    try
+    catch "Exception" __catch_Exception
+    enter __try_overflow
+
+    izero 0
+    return
+.end
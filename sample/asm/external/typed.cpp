@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <string>
+#include <viua/include/module.h>
+using namespace std;
+
+
+extern "C" const ForeignFunctionSpec* exports();
+extern "C" const TypedForeignFunctionSpec* typed_exports();
+
+
+static void typed_add(const ForeignValue* arguments, ForeignValue* result) {
+    result->int64 = (arguments[0].int64 + arguments[1].int64);
+}
+
+static void typed_hypot(const ForeignValue* arguments, ForeignValue* result) {
+    result->float64 = hypot(arguments[0].float64, arguments[1].float64);
+}
+
+static void typed_length(const ForeignValue* arguments, ForeignValue* result) {
+    result->int64 = static_cast<int64_t>(arguments[0].string.size);
+}
+
+static void typed_upper(const ForeignValue* arguments, ForeignValue* result) {
+    // the VM copies returned string right after the call
+    static thread_local string buffer;
+    buffer.assign(arguments[0].string.data, arguments[0].string.size);
+    for (auto& c : buffer) {
+        c = static_cast<char>(toupper(c));
+    }
+    result->string.data = buffer.data();
+    result->string.size = buffer.size();
+}
+
+static void typed_reverse(const ForeignValue* arguments, ForeignValue* result) {
+    static thread_local basic_string<unsigned char> buffer;
+    buffer.assign(arguments[0].bytes.data, arguments[0].bytes.size);
+    reverse(buffer.begin(), buffer.end());
+    result->bytes.data = buffer.data();
+    result->bytes.size = buffer.size();
+}
+
+
+const ForeignFunctionSpec functions[] = {
+    { nullptr, nullptr },
+};
+
+const TypedForeignFunctionSpec typed_functions[] = {
+    { "typed::add/2", &typed_add, FOREIGN_INT64, { FOREIGN_INT64, FOREIGN_INT64 } },
+    { "typed::hypot/2", &typed_hypot, FOREIGN_DOUBLE, { FOREIGN_DOUBLE, FOREIGN_DOUBLE } },
+    { "typed::length/1", &typed_length, FOREIGN_INT64, { FOREIGN_STRING } },
+    { "typed::upper/1", &typed_upper, FOREIGN_STRING, { FOREIGN_STRING } },
+    { "typed::reverse/1", &typed_reverse, FOREIGN_BYTES, { FOREIGN_BYTES } },
+    { nullptr, nullptr },
+};
+
+extern "C" const ForeignFunctionSpec* exports() {
+    return functions;
+}
+
+extern "C" const TypedForeignFunctionSpec* typed_exports() {
+    return typed_functions;
+}
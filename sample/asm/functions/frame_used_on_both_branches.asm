@@ -0,0 +1,38 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: print_it/1
+    print (arg 1 0)
+    return
+.end
+
+.function: main/1
+    ; the frame is spawned once and used on whichever path is taken
+    frame ^[(param 0 (istore 1 42))]
+    branch (istore 2 1) +1 other
+    jump call_it
+    .mark: other
+    call print_it/1
+    jump done
+    .mark: call_it
+    call print_it/1
+    .mark: done
+    izero 0
+    return
+.end
@@ -0,0 +1,63 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; functions get only as many registers as they need, counting
+; registers used by blocks they enter (functions packing vectors get as many
+; registers as their frames request)
+
+.block: uses_high_register
+    istore 20 42
+    print 20
+    leave
+.end
+
+.function: enters_block/0
+    try
+    enter uses_high_register
+    return
+.end
+
+.function: uses_named_register/0
+    .name: 12 answer
+    istore answer 69
+    print answer
+    return
+.end
+
+.function: packs_vector/0
+    istore 1 1
+    istore 2 2
+    vec 0 1 2
+    print 0
+    return
+.end
+
+.function: main/1
+    frame 0 32
+    call 0 enters_block/0
+
+    frame 0 32
+    call 0 uses_named_register/0
+
+    frame 0 32
+    call 0 packs_vector/0
+
+    izero 0
+    return
+.end
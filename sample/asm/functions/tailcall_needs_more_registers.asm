@@ -0,0 +1,40 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; tail called function runs in register set of its caller, which
+; is grown if the called function needs more registers
+
+.function: needs_eleven_registers/0
+    istore 10 42
+    print 10
+    return
+.end
+
+.function: tail_calls/0
+    istore 1 1
+    frame 0 0
+    tailcall needs_eleven_registers/0
+.end
+
+.function: main/0
+    frame 0 2
+    call 0 tail_calls/0
+    izero 0
+    return
+.end
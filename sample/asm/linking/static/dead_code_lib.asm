@@ -0,0 +1,53 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; functions not reachable from the program linking this module
+; must not be written to its bytecode
+
+.function: dead::unused/0
+    print (strstore 1 "unused")
+    return
+.end
+
+.function: dead::print/1
+    print (arg 1 0)
+    return
+.end
+
+.function: dead::countdown/1
+    arg 1 0
+    izero 2
+    function 3 dead::print/1
+
+    .mark: loop
+    branch (ilte 4 1 2) end
+    frame ^[(param 0 1)]
+    fcall 0 3
+    idec 1
+    jump loop
+
+    .mark: end
+    return
+.end
+
+.function: dead::also_unused/0
+    frame 0
+    call dead::unused/0
+    return
+.end
@@ -0,0 +1,37 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: printer::print/1
+
+.function: worker/0
+    frame ^[(param 0 (receive 1))]
+    call printer::print/1
+    return
+.end
+
+.function: main/0
+    import "build/test/printer"
+    frame 0
+    process 1 worker/0
+    frame ^[(param 0 1) (param 1 (strstore 2 "traced World"))]
+    msg 0 pass/2
+    join 0 1
+    izero 0
+    return
+.end
@@ -0,0 +1,39 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    ; the condition is known so the branch becomes a jump and
+    ; code that is not reachable any more is removed
+    branch (ilt 1 (istore 1 2) (istore 2 1)) less greater_or_equal
+
+    .mark: less
+    print (strstore 3 "less")
+    jump end
+
+    .mark: greater_or_equal
+    jump print_greater_or_equal
+
+    .mark: print_greater_or_equal
+    print (strstore 3 "greater or equal")
+    jump end
+
+    .mark: end
+    izero 0
+    return
+.end
@@ -0,0 +1,34 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    ; (40 + 2) is computed by the assembler
+    iadd 3 (istore 1 40) (istore 2 2)
+
+    ; this store is overwritten before being read
+    istore 4 100
+    istore 4 7
+    imul 5 3 4
+
+    ; copy is read in place of the copied register so it is not needed
+    copy 6 5
+    print 6
+    izero 0
+    return
+.end
@@ -0,0 +1,47 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: square/1
+    arg 1 0
+    imul 0 1 1
+    return
+.end
+
+.function: add/2
+    arg 1 0
+    arg 2 1
+    iadd 0 1 2
+    return
+.end
+
+.function: main/1
+    istore 1 6
+
+    ; calls to small leaf functions are replaced with their bodies
+    frame ^[(param 0 1)]
+    call 2 square/1
+
+    frame ^[(param 0 2) (param 1 1)]
+    call 3 add/2
+
+    print 3
+
+    izero 0
+    return
+.end
@@ -0,0 +1,42 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: counter/1
+    ; values of registers are not known in loops so nothing is folded
+    arg 1 0
+    izero 2
+
+    .mark: loop
+    branch (ilt 3 2 1) body end
+
+    .mark: body
+    print 2
+    iinc 2
+    jump loop
+
+    .mark: end
+    return
+.end
+
+.function: main/1
+    frame ^[(param 0 (istore 1 3))]
+    call counter/1
+    izero 0
+    return
+.end
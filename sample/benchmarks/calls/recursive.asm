@@ -0,0 +1,42 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: fibonacci/1
+    arg 1 0
+    branch (ilt 2 1 (istore 3 2)) +1 recurse
+    move 0 1
+    return
+
+    .mark: recurse
+    frame ^[(param 0 (isub 4 1 (istore 5 1)))]
+    call 6 fibonacci/1
+    frame ^[(param 0 (isub 4 1 (istore 5 2)))]
+    call 7 fibonacci/1
+    iadd 0 6 7
+    return
+.end
+
+.function: main/1
+    -- about twenty thousand recursive calls
+    frame ^[(param 0 (istore 1 20))]
+    call 2 fibonacci/1
+
+    izero 0
+    return
+.end
@@ -0,0 +1,45 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: adder/1
+    ; expects register 1 to be an enclosed integer
+    arg 2 0
+    iadd 0 2 1
+    return
+.end
+
+.function: main/1
+    -- one hundred thousand calls to a closure
+    closure 2 adder/1
+    enclose 2 1 (istore 1 3)
+
+    istore 3 0
+    istore 4 100000
+
+    .mark: loop
+    branch (ilt 5 3 4) +1 done
+    frame ^[(param 0 3)]
+    fcall 6 2
+    iinc 3
+    jump loop
+
+    .mark: done
+    izero 0
+    return
+.end
@@ -0,0 +1,42 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <viua/types/type.h>
+#include <viua/cpu/frame.h>
+#include <viua/cpu/registerset.h>
+#include <viua/include/module.h>
+using namespace std;
+
+
+extern "C" const ForeignFunctionSpec* exports();
+
+
+static void benchmark_nop(Frame*, RegisterSet*, RegisterSet*, Process*, CPU*) {
+}
+
+
+const ForeignFunctionSpec functions[] = {
+    { "benchmark::nop/0", &benchmark_nop },
+    { "benchmark::nop_nonblocking/0", &benchmark_nop, true },
+    { nullptr, nullptr },
+};
+
+extern "C" const ForeignFunctionSpec* exports() {
+    return functions;
+}
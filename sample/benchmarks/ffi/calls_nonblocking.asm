@@ -0,0 +1,39 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: benchmark::nop_nonblocking/0
+
+.function: main/1
+    import "build/test/benchmark"
+
+    -- one million calls to a foreign function that does nothing
+    istore 1 0
+    istore 2 1000000
+
+    .mark: loop
+    branch (ilt 3 1 2) +1 done
+    frame 0
+    call 0 benchmark::nop_nonblocking/0
+    iinc 1
+    jump loop
+
+    .mark: done
+    izero 0
+    return
+.end
@@ -0,0 +1,61 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::functional::map/2
+.signature: std::functional::filter/2
+
+.function: square/1
+    arg 1 0
+    imul 0 1 1
+    return
+.end
+
+.function: is_small/1
+    arg 1 0
+    ilt 0 1 (istore 2 25000000)
+    return
+.end
+
+.function: main/1
+    link std::functional
+
+    -- map and filter over a vector of twenty thousand integers
+    vec 1
+    istore 2 0
+    istore 3 20000
+
+    .mark: fill
+    branch (ilt 4 2 3) +1 filled
+    vpush 1 (copy 5 2)
+    iinc 2
+    jump fill
+
+    .mark: filled
+    function 6 square/1
+    function 7 is_small/1
+
+    frame ^[(param 0 6) (param 1 1)]
+    call 8 std::functional::map/2
+
+    frame ^[(param 0 7) (param 1 8)]
+    call 9 std::functional::filter/2
+
+    izero 0
+    return
+.end
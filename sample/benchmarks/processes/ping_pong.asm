@@ -0,0 +1,77 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: ponger/0
+    ; the first message is the process to reply to
+    receive 1
+
+    istore 2 0
+    istore 3 5000
+
+    .mark: loop
+    branch (ilt 4 2 3) +1 done
+    frame ^[(param 0 1) (param 1 (receive 5))]
+    msg 0 pass/2
+    iinc 2
+    jump loop
+
+    .mark: done
+    ; the process to reply to may not have been joined yet, and
+    ; frames must not be dropped with joinable processes in their registers
+    delete 1
+    return
+.end
+
+.function: pinger/1
+    arg 1 0
+
+    istore 2 0
+    istore 3 5000
+
+    .mark: loop
+    branch (ilt 4 2 3) +1 done
+    frame ^[(param 0 1) (param 1 2)]
+    msg 0 pass/2
+    receive 5
+    iinc 2
+    jump loop
+
+    .mark: done
+    return
+.end
+
+.function: main/1
+    -- five thousand messages sent back and forth between two processes
+    frame 0
+    process 1 ponger/0
+    ; the ponger is detached because the pinger holds a copy of it
+    frame ^[(param 0 1)]
+    msg 0 detach/1
+
+    frame ^[(param 0 1)]
+    process 2 pinger/1
+
+    frame ^[(param 0 1) (param 1 2)]
+    msg 0 pass/2
+
+    join 0 2
+
+    izero 0
+    return
+.end
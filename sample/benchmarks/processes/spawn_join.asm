@@ -0,0 +1,41 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: worker/0
+    izero 0
+    return
+.end
+
+.function: main/1
+    -- two thousand processes spawned and joined one after another
+    istore 1 0
+    istore 2 2000
+
+    .mark: loop
+    branch (ilt 3 1 2) +1 done
+    frame 0
+    process 4 worker/0
+    join 0 4
+    iinc 1
+    jump loop
+
+    .mark: done
+    izero 0
+    return
+.end
@@ -0,0 +1,38 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    -- five thousand strings formatted with positional parameters
+    vpush (vpush (vec 1) (strstore 2 "formatted")) (strstore 2 "World")
+    strstore 6 "Hello, #{0} #{1}!"
+
+    istore 3 0
+    istore 4 5000
+
+    .mark: loop
+    branch (ilt 5 3 4) +1 done
+    frame ^[(param 0 6) (param 1 1)]
+    msg 7 format/
+    iinc 3
+    jump loop
+
+    .mark: done
+    izero 0
+    return
+.end
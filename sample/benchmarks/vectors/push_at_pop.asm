@@ -0,0 +1,55 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    -- one hundred thousand integers pushed, read, and popped
+    vec 1
+    istore 2 0
+    istore 3 100000
+
+    .mark: push
+    branch (ilt 4 2 3) +1 pushed
+    vpush 1 (copy 5 2)
+    iinc 2
+    jump push
+
+    .mark: pushed
+    izero 2
+
+    .mark: read
+    branch (ilt 4 2 3) +1 read_all
+    vat 6 1 @2
+    ; vat creates references so the register is emptied instead of being overwritten
+    empty 6
+    iinc 2
+    jump read
+
+    .mark: read_all
+    izero 2
+
+    .mark: pop
+    branch (ilt 4 2 3) +1 done
+    vpop 6 1
+    iinc 2
+    jump pop
+
+    .mark: done
+    izero 0
+    return
+.end
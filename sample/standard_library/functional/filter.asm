@@ -0,0 +1,44 @@
+;
+;   Copyright (C) 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: is_even/1
+    arg 1 0
+    ; integers are even if they are equal to themselves divided by two, and multiplied by two
+    imul 2 (idiv 2 1 (istore 3 2)) 3
+    ieq 0 1 2
+    return
+.end
+
+.signature: std::functional::filter/2
+
+.function: main/1
+    link std::functional
+
+    vpush (vec 1) (istore 2 1)
+    vpush 1 (istore 2 2)
+    vpush 1 (istore 2 3)
+    vpush 1 (istore 2 4)
+    vpush 1 (istore 2 5)
+
+    frame ^[(param 0 (function 3 is_even/1)) (param 1 1)]
+    print (call 4 std::functional::filter/2)
+
+    izero 0
+    return
+.end
@@ -0,0 +1,57 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::io::pipe/0
+.signature: std::io::read/2
+.signature: std::io::write/2
+.signature: std::io::close/1
+
+.function: reader/1
+    -- the pipe is empty so this process is parked until
+    -- the writer puts something in it
+    frame ^[(param 0 (arg 1 0)) (param 1 (istore 2 64))]
+    print (call 3 std::io::read/2)
+
+    frame ^[(param 0 1)]
+    call 0 std::io::close/1
+
+    return
+.end
+
+.function: main/1
+    import "io"
+
+    -- pipe/0 returns a vector of two non-blocking descriptors: [read end, write end]
+    frame 0
+    call 1 std::io::pipe/0
+
+    frame ^[(param 0 (vat 2 1 0))]
+    process 3 reader/1
+
+    frame ^[(param 0 (vat 4 1 1)) (param 1 (strstore 5 "Hello World!"))]
+    call 0 std::io::write/2
+
+    frame ^[(param 0 4)]
+    call 0 std::io::close/1
+
+    join 0 3
+
+    izero 0
+    return
+.end
@@ -0,0 +1,78 @@
+;
+;   Copyright (C) 2015, 2016 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::io::unix_listen/1
+.signature: std::io::unix_connect/1
+.signature: std::io::accept/1
+.signature: std::io::read/2
+.signature: std::io::write/2
+.signature: std::io::close/1
+
+.function: serve_one/1
+    -- accepting parks the process until a client connects
+    .name: 2 client
+    frame ^[(param 0 (arg 1 0))]
+    call client std::io::accept/1
+
+    -- echo whatever the client sent
+    frame ^[(param 0 client) (param 1 (istore 3 64))]
+    call 4 std::io::read/2
+
+    frame ^[(param 0 client) (param 1 4)]
+    call 0 std::io::write/2
+
+    frame ^[(param 0 client)]
+    call 0 std::io::close/1
+
+    return
+.end
+
+.function: main/1
+    import "io"
+
+    -- socket names beginning with "@" live in the abstract namespace so
+    -- no file is left behind
+    .name: 1 server
+    frame ^[(param 0 (strstore 2 "@viua-std-io-echo-test"))]
+    call server std::io::unix_listen/1
+
+    frame ^[(param 0 server)]
+    process 3 serve_one/1
+
+    .name: 4 connection
+    frame ^[(param 0 (strstore 2 "@viua-std-io-echo-test"))]
+    call connection std::io::unix_connect/1
+
+    frame ^[(param 0 connection) (param 1 (strstore 5 "Hello World!"))]
+    call 0 std::io::write/2
+
+    frame ^[(param 0 connection) (param 1 (istore 6 64))]
+    print (call 7 std::io::read/2)
+
+    frame ^[(param 0 connection)]
+    call 0 std::io::close/1
+
+    join 0 3
+
+    frame ^[(param 0 server)]
+    call 0 std::io::close/1
+
+    izero 0
+    return
+.end
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <iterator>
+#include <utility>
+#include <viua/support/string.h>
+#include <viua/cg/assembler/assembler.h>
+using namespace std;
+
+
+/*  Control flow graphs are built once from the expanded source, and are shared by verification passes
+ *  so that the source is split into instructions and operands only once.
+ *
+ *  Every function and block gets its own graph.
+ *  Instructions outside of functions and blocks are put into anonymous graphs (one for every stretch of
+ *  such instructions) so that they are verified, too.
+ *  Instructions are indexed the same way they are during bytecode generation: directives, comments, and
+ *  empty lines are not instructions.
+ *
+ *  Graphs are built for any input, even one that is not well-formed; verification passes that run
+ *  before the graph is built report malformed functions and blocks.
+ */
+
+using assembler::cfg::index_type;
+
+namespace {
+    // instructions after which control does not continue to the next instruction
+    const set<string> TERMINATORS = { "jump", "return", "tailcall", "halt", "leave", "throw", };
+
+    vector<string> split(const string& line, string::size_type i) {
+        /** Splits a line into whitespace-separated tokens, keeping quoted strings in single tokens.
+         */
+        vector<string> tokens;
+        while (i < line.size()) {
+            if (line[i] == ' ' or line[i] == '\t' or line[i] == '\r' or line[i] == '\n') {
+                ++i;
+            } else if (line[i] == '"' or line[i] == '\'') {
+                tokens.push_back(str::extract(line.substr(i)));
+                i += tokens.back().size();
+            } else {
+                auto end = line.find_first_of(" \t\r\n", i);
+                if (end == string::npos) {
+                    end = line.size();
+                }
+                tokens.push_back(line.substr(i, (end-i)));
+                i = end;
+            }
+        }
+        return tokens;
+    }
+
+    vector<string> jumpOperands(const assembler::cfg::instruction_t& instruction) {
+        if (instruction.opcode == "jump") {
+            return instruction.operands;
+        }
+        // first operand of a branch is the register with condition
+        return vector<string>(instruction.operands.begin()+(instruction.operands.empty() ? 0 : 1), instruction.operands.end());
+    }
+
+    void link(assembler::cfg::graph_t& graph) {
+        const auto& instructions = graph.instructions;
+        graph.complete = true;
+        if (instructions.empty()) {
+            return;
+        }
+
+        vector<bool> leaders(instructions.size(), false);
+        leaders[0] = true;
+        for (index_type i = 0; i < instructions.size(); ++i) {
+            const auto& opcode = instructions[i].opcode;
+            if (opcode == "jump" or opcode == "branch") {
+                auto targets = jumpOperands(instructions[i]);
+                if (targets.empty()) {
+                    graph.complete = false;
+                }
+                for (const auto& each : targets) {
+                    index_type target = 0;
+                    if (assembler::cfg::resolveJump(graph, each, i, target)) {
+                        leaders[target] = true;
+                    } else {
+                        graph.complete = false;
+                    }
+                }
+            }
+            if ((opcode == "branch" or TERMINATORS.count(opcode)) and (i+1) < instructions.size()) {
+                leaders[i+1] = true;
+            }
+        }
+
+        vector<index_type> node_of(instructions.size());
+        for (index_type i = 0; i < instructions.size(); ++i) {
+            if (leaders[i]) {
+                assembler::cfg::node_t node;
+                node.begin = i;
+                graph.nodes.push_back(node);
+            }
+            graph.nodes.back().end = (i+1);
+            node_of[i] = (graph.nodes.size()-1);
+        }
+
+        for (index_type n = 0; n < graph.nodes.size(); ++n) {
+            auto& node = graph.nodes[n];
+            index_type last = (node.end-1);
+            const auto& instruction = instructions[last];
+            index_type target = 0;
+
+            if (instruction.opcode == "jump" or instruction.opcode == "branch") {
+                auto targets = jumpOperands(instruction);
+                for (const auto& each : targets) {
+                    if (assembler::cfg::resolveJump(graph, each, last, target)) {
+                        node.successors.push_back(node_of[target]);
+                    }
+                }
+                // short form of branch falls through to the next instruction when the condition is false
+                if (instruction.opcode == "branch" and targets.size() == 1 and node.end < instructions.size()) {
+                    node.successors.push_back(node_of[node.end]);
+                }
+            } else if (TERMINATORS.count(instruction.opcode) == 0 and (n+1) < graph.nodes.size()) {
+                node.successors.push_back(n+1);
+            }
+        }
+    }
+}
+
+bool assembler::cfg::resolveJump(const graph_t& graph, const string& jump, index_type instruction, index_type& target) {
+    /** Resolves target of a jump to an index of instruction in the graph.
+     *
+     *  Returns false if the jump does not target an instruction of the graph: if it is an absolute
+     *  jump (their targets are byte offsets), a jump to undefined marker, or a jump out of range.
+     */
+    int64_t resolved = 0;
+    if (jump.empty() or jump.size() > 18) {
+        return false;
+    } else if (str::isnum(jump, false)) {
+        resolved = stoll(jump);
+    } else if ((jump[0] == '+' or jump[0] == '-') and str::isnum(jump.substr(1), false)) {
+        resolved = (static_cast<int64_t>(instruction) + stoll(jump));
+    } else if (jump[0] == '.' or str::ishex(jump)) {
+        return false;
+    } else if (graph.marks.count(jump)) {
+        resolved = static_cast<int64_t>(graph.marks.at(jump));
+    } else {
+        return false;
+    }
+
+    if (resolved < 0 or resolved >= static_cast<int64_t>(graph.instructions.size())) {
+        return false;
+    }
+    target = static_cast<index_type>(resolved);
+    return true;
+}
+
+vector<assembler::cfg::graph_t> assembler::cfg::build(const vector<string>& lines) {
+    /** Builds control flow graphs of all functions and blocks in expanded source.
+     */
+    vector<graph_t> graphs;
+    bool open = false;
+
+    for (index_type i = 0; i < lines.size(); ++i) {
+        auto begin = lines[i].find_first_not_of(" \t\r\n");
+        if (begin == string::npos or lines[i][begin] == ';' or lines[i].compare(begin, 2, "--") == 0) {
+            continue;
+        }
+
+        vector<string> tokens = split(lines[i], begin);
+        const string& opcode = tokens.front();
+
+        if (opcode == ".function:" or opcode == ".block:") {
+            graphs.emplace_back();
+            graphs.back().name = (tokens.size() > 1 ? tokens[1] : "");
+            graphs.back().is_block = (opcode == ".block:");
+            open = true;
+            continue;
+        } else if (opcode == ".end") {
+            open = false;
+            continue;
+        } else if (opcode[0] == '.' and opcode != ".mark:" and opcode != ".name:") {
+            continue;
+        }
+
+        if (not open) {
+            graphs.emplace_back();
+            graphs.back().is_block = false;
+            open = true;
+        }
+        graph_t& graph = graphs.back();
+
+        if (opcode == ".mark:") {
+            graph.marks[(tokens.size() > 1 ? tokens[1] : "")] = graph.instructions.size();
+        } else if (opcode == ".name:") {
+            if (tokens.size() > 2) {
+                graph.names[tokens[2]] = tokens[1];
+            }
+        } else {
+            graph.instructions.emplace_back();
+            instruction_t& instruction = graph.instructions.back();
+            instruction.line = i;
+            instruction.opcode = std::move(tokens.front());
+            instruction.operands.assign(make_move_iterator(tokens.begin()+1), make_move_iterator(tokens.end()));
+        }
+    }
+
+    for (auto& each : graphs) {
+        link(each);
+    }
+
+    return graphs;
+}
@@ -0,0 +1,1035 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+#include <climits>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <viua/support/string.h>
+#include <viua/cg/assembler/assembler.h>
+using namespace std;
+
+
+/*  Optimiser works on the expanded source of a single function.
+ *
+ *  Every line of a function is turned into an instruction with its operands split,
+ *  and instructions that the optimiser understands are annotated with registers they use and define.
+ *  Optimised function has exactly as many lines as the original one (removed instructions are replaced
+ *  with empty lines) so that line numbers in error reports stay valid.
+ *
+ *  Registers may hold references and writing to a register holding a reference writes through it.
+ *  Registers that may ever hold one ("tainted" registers) are any registers touched by instructions
+ *  the optimiser does not understand, registers used before they are defined (e.g. registers enclosed
+ *  by closures), and registers exchanging values with them.
+ *  Stores to tainted registers are never removed, and writing any of them invalidates what is known
+ *  about all of them.
+ */
+
+namespace {
+    enum class Kind {
+        RAW,            // empty line, comment, or directive other than mark
+        MARK,
+        INSTRUCTION,
+    };
+
+    struct Value {
+        bool known;
+        bool is_boolean;
+        int64_t value;
+
+        Value(): known(false), is_boolean(false), value(0) {}
+        Value(bool b, int64_t v): known(true), is_boolean(b), value(v) {}
+    };
+
+    struct Line {
+        Kind kind;
+        string indent;
+        string text;
+        string opcode;
+        vector<string> operands;
+        bool removed;
+        bool rewritten;
+
+        string str() const {
+            if (removed) {
+                return "";
+            }
+            if (not rewritten) {
+                // operands are not split with string literals in mind so only rewritten lines are rebuilt from them
+                return text;
+            }
+            return (indent + opcode + (operands.empty() ? "" : (" " + str::join(" ", operands))));
+        }
+
+        void rewrite(const string& op, const vector<string>& ops) {
+            opcode = op;
+            operands = ops;
+            rewritten = true;
+        }
+    };
+
+    const set<string> ARITHMETIC = { "iadd", "isub", "imul", "idiv", };
+    const set<string> COMPARISONS = { "ilt", "ilte", "igt", "igte", "ieq", };
+    const set<string> TERMINATORS = { "jump", "return", "halt", "throw", "tailcall", };
+
+    // instructions that make functions (and registers) escape in ways this optimiser does not follow
+    const set<string> DISQUALIFYING = { "ress", "closure", "enclose", "enclosecopy", "enclosemove", };
+
+    bool isRegister(const string& s) {
+        return (str::isnum(s, false) and s.size() < 10);
+    }
+    bool isTarget(const string& s) {
+        return (not s.empty() and (isalpha(s[0]) or s[0] == '_'));
+    }
+    unsigned toRegister(const string& s) {
+        return static_cast<unsigned>(stoul(s));
+    }
+
+    bool understood(const Line& line) {
+        const auto& op = line.opcode;
+        const auto& operands = line.operands;
+        if (op == "istore") {
+            return (operands.size() == 2 and isRegister(operands[0]) and str::isnum(operands[1]) and operands[1].size() < 10);
+        } else if (op == "izero" or op == "iinc" or op == "idec" or op == "print" or op == "echo") {
+            return (operands.size() == 1 and isRegister(operands[0]));
+        } else if (ARITHMETIC.count(op) or COMPARISONS.count(op)) {
+            return (operands.size() == 3 and isRegister(operands[0]) and isRegister(operands[1]) and isRegister(operands[2]));
+        } else if (op == "copy" or op == "move") {
+            return (operands.size() == 2 and isRegister(operands[0]) and isRegister(operands[1]));
+        } else if (op == "branch") {
+            return ((operands.size() == 2 or operands.size() == 3) and isRegister(operands[0]));
+        } else if (op == "jump" or op == "return" or op == "nop") {
+            return true;
+        }
+        return false;
+    }
+
+    vector<unsigned> uses(const Line& line) {
+        const auto& op = line.opcode;
+        const auto& operands = line.operands;
+        if (ARITHMETIC.count(op) or COMPARISONS.count(op)) {
+            return { toRegister(operands[1]), toRegister(operands[2]) };
+        } else if (op == "copy" or op == "move") {
+            return { toRegister(operands[1]) };
+        } else if (op == "iinc" or op == "idec" or op == "print" or op == "echo" or op == "branch") {
+            return { toRegister(operands[0]) };
+        } else if (op == "return") {
+            return { 0 };
+        }
+        return {};
+    }
+
+    vector<unsigned> definitions(const Line& line) {
+        const auto& op = line.opcode;
+        const auto& operands = line.operands;
+        if (op == "istore" or op == "izero" or op == "iinc" or op == "idec" or op == "copy" or ARITHMETIC.count(op) or COMPARISONS.count(op)) {
+            return { toRegister(operands[0]) };
+        } else if (op == "move") {
+            // source register is emptied by the move
+            return { toRegister(operands[0]), toRegister(operands[1]) };
+        }
+        return {};
+    }
+
+    Value evaluate(const string& op, int64_t a, int64_t b) {
+        /** Returns result of an integer instruction, or unknown value if it would not be well-defined.
+         */
+        int64_t result = 0;
+        if (op == "iadd") {
+            result = (a + b);
+        } else if (op == "isub") {
+            result = (a - b);
+        } else if (op == "imul") {
+            result = (a * b);
+        } else if (op == "idiv") {
+            if (b == 0) {
+                return Value();
+            }
+            result = (a / b);
+        } else if (op == "ilt") {
+            return Value(true, (a < b));
+        } else if (op == "ilte") {
+            return Value(true, (a <= b));
+        } else if (op == "igt") {
+            return Value(true, (a > b));
+        } else if (op == "igte") {
+            return Value(true, (a >= b));
+        } else if (op == "ieq") {
+            return Value(true, (a == b));
+        }
+        if (result < INT_MIN or result > INT_MAX) {
+            return Value();
+        }
+        return Value(false, result);
+    }
+
+    vector<Line> parse(const vector<string>& lines) {
+        vector<Line> parsed;
+        for (const auto& each : lines) {
+            Line line;
+            line.text = each;
+            line.removed = false;
+            line.rewritten = false;
+
+            string stripped = str::lstrip(each);
+            line.indent = each.substr(0, (each.size() - stripped.size()));
+            if (stripped.empty() or stripped[0] == ';' or str::startswith(stripped, "--")) {
+                line.kind = Kind::RAW;
+            } else if (assembler::utils::lines::is_mark(stripped)) {
+                line.kind = Kind::MARK;
+                line.opcode = str::lstrip(str::sub(stripped, str::chunk(stripped).size()));
+            } else if (assembler::utils::lines::is_directive(stripped)) {
+                line.kind = Kind::RAW;
+                line.opcode = str::chunk(stripped);
+            } else {
+                line.kind = Kind::INSTRUCTION;
+                line.opcode = str::chunk(stripped);
+                istringstream operands(str::sub(stripped, line.opcode.size()));
+                string operand;
+                while (operands >> operand) {
+                    line.operands.push_back(operand);
+                }
+            }
+            parsed.push_back(line);
+        }
+        return parsed;
+    }
+
+    bool optimisable(const vector<Line>& lines) {
+        /** Checks whether function uses only features the optimiser can reason about.
+         *
+         *  Named and indirect register operands, register set switching, closures, and jumps to
+         *  anything but marks (relative and absolute jumps would be broken by removing instructions)
+         *  make the optimiser leave the function alone.
+         */
+        for (const auto& line : lines) {
+            if (line.kind == Kind::RAW and line.opcode == ".name:") {
+                return false;
+            }
+            if (line.kind != Kind::INSTRUCTION) {
+                continue;
+            }
+            if (DISQUALIFYING.count(line.opcode)) {
+                return false;
+            }
+            for (const auto& operand : line.operands) {
+                if (operand[0] == '@' or operand[0] == '*') {
+                    return false;
+                }
+            }
+            if (line.opcode == "jump" and (line.operands.size() != 1 or not isTarget(line.operands[0]))) {
+                return false;
+            }
+            if (line.opcode == "branch") {
+                for (decltype(line.operands)::size_type i = 1; i < line.operands.size(); ++i) {
+                    if (not isTarget(line.operands[i])) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    set<unsigned> findTaintedRegisters(const vector<Line>& lines) {
+        set<unsigned> tainted;
+        set<unsigned> defined;
+        vector<pair<unsigned, unsigned>> exchanges;
+
+        for (const auto& line : lines) {
+            if (line.kind != Kind::INSTRUCTION) {
+                continue;
+            }
+            if (not understood(line)) {
+                for (const auto& operand : line.operands) {
+                    if (isRegister(operand)) {
+                        tainted.insert(toRegister(operand));
+                    }
+                }
+                continue;
+            }
+            for (auto each : uses(line)) {
+                if (not defined.count(each) and not (line.opcode == "return" and each == 0)) {
+                    tainted.insert(each);
+                }
+            }
+            for (auto each : definitions(line)) {
+                defined.insert(each);
+            }
+            if (line.opcode == "copy" or line.opcode == "move") {
+                exchanges.emplace_back(toRegister(line.operands[0]), toRegister(line.operands[1]));
+            }
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (const auto& each : exchanges) {
+                if (tainted.count(each.first) != tainted.count(each.second)) {
+                    tainted.insert(each.first);
+                    tainted.insert(each.second);
+                    changed = true;
+                }
+            }
+        }
+
+        return tainted;
+    }
+
+    map<string, vector<Line>::size_type> findMarks(const vector<Line>& lines) {
+        /** Maps marks to indexes of instructions they point to.
+         */
+        map<string, vector<Line>::size_type> marks;
+        vector<string> preceding_marks;
+        for (vector<Line>::size_type i = 0; i < lines.size(); ++i) {
+            if (lines[i].removed or lines[i].kind == Kind::RAW) {
+                continue;
+            }
+            if (lines[i].kind == Kind::MARK) {
+                preceding_marks.push_back(lines[i].opcode);
+                continue;
+            }
+            for (const auto& each : preceding_marks) {
+                marks[each] = i;
+            }
+            preceding_marks.clear();
+        }
+        return marks;
+    }
+
+    bool foldConstants(vector<Line>& lines, const set<unsigned>& tainted, vector<bool>& nothrow) {
+        /** Constant folding, copy propagation, and branch folding.
+         *
+         *  Values of registers, registers known to be non-empty, and copies are tracked within basic blocks.
+         *  Instructions that cannot throw (e.g. because registers they read are known to be non-empty and
+         *  hold values of correct types) are recorded in `nothrow`.
+         */
+        bool changed = false;
+        map<unsigned, Value> known;
+        set<unsigned> nonempty;
+        map<unsigned, unsigned> copies;
+        nothrow.assign(lines.size(), false);
+
+        auto clear = [&known, &nonempty, &copies]() {
+            known.clear();
+            nonempty.clear();
+            copies.clear();
+        };
+        auto forget = [&known, &copies, &tainted](unsigned r) {
+            if (tainted.count(r)) {
+                for (auto each : tainted) { known.erase(each); }
+            }
+            known.erase(r);
+            copies.erase(r);
+            for (auto each = copies.begin(); each != copies.end();) {
+                each = ((each->second == r) ? copies.erase(each) : ++each);
+            }
+        };
+        auto value = [&known](unsigned r) -> Value {
+            return (known.count(r) ? known.at(r) : Value());
+        };
+
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            Line& line = lines[i];
+            if (line.removed or line.kind == Kind::RAW) {
+                continue;
+            }
+            if (line.kind == Kind::MARK or not understood(line)) {
+                clear();
+                continue;
+            }
+
+            const auto& op = line.opcode;
+
+            // read copied registers instead of their copies so the copies may become dead
+            // moves and increments modify registers they read so they must keep their operands
+            if (op != "move" and op != "iinc" and op != "idec" and op != "return") {
+                auto operands = line.operands;
+                bool reads_first = (op == "print" or op == "echo" or op == "branch");
+                auto last = (op == "branch" ? 1 : operands.size());
+                for (decltype(last) j = (reads_first ? 0 : 1); j < last; ++j) {
+                    if (isRegister(operands[j]) and copies.count(toRegister(operands[j]))) {
+                        operands[j] = to_string(copies.at(toRegister(operands[j])));
+                    }
+                }
+                if (operands != line.operands) {
+                    line.rewrite(op, operands);
+                    changed = true;
+                }
+            }
+
+            bool safe = true;
+            Value result;
+            for (auto each : uses(line)) {
+                if (not nonempty.count(each) and op != "return") {
+                    safe = false;
+                }
+            }
+
+            if (ARITHMETIC.count(op) or COMPARISONS.count(op)) {
+                Value a = value(toRegister(line.operands[1]));
+                Value b = value(toRegister(line.operands[2]));
+                if (a.known and b.known and not a.is_boolean and not b.is_boolean) {
+                    result = evaluate(op, a.value, b.value);
+                }
+                safe = result.known;
+                if (result.known and not result.is_boolean) {
+                    line.rewrite("istore", { line.operands[0], to_string(result.value) });
+                    changed = true;
+                }
+            } else if (op == "istore") {
+                result = Value(false, stoll(line.operands[1]));
+            } else if (op == "izero") {
+                result = Value(false, 0);
+            } else if (op == "iinc" or op == "idec") {
+                Value a = value(toRegister(line.operands[0]));
+                if (a.known and not a.is_boolean) {
+                    result = evaluate((op == "iinc" ? "iadd" : "isub"), a.value, 1);
+                }
+                safe = result.known;
+            } else if (op == "copy" or op == "move") {
+                result = value(toRegister(line.operands[1]));
+            } else if (op == "branch") {
+                Value condition = value(toRegister(line.operands[0]));
+                if (condition.known) {
+                    if (condition.value) {
+                        line.rewrite("jump", { line.operands[1] });
+                    } else if (line.operands.size() == 3) {
+                        line.rewrite("jump", { line.operands[2] });
+                    } else {
+                        line.removed = true;
+                    }
+                    changed = true;
+                }
+            }
+            nothrow[i] = safe;
+
+            if (op == "branch" or op == "jump" or op == "return") {
+                clear();
+                continue;
+            }
+
+            // registers read by an instruction that did not throw are not empty
+            for (auto each : uses(line)) {
+                nonempty.insert(each);
+            }
+
+            auto defined = definitions(line);
+            for (auto each : defined) {
+                forget(each);
+            }
+            if (op == "move") {
+                nonempty.erase(defined[1]);
+            }
+            if (defined.empty()) {
+                continue;
+            }
+
+            unsigned target = defined[0];
+            nonempty.insert(target);
+            if (result.known) {
+                known[target] = result;
+            }
+            if (op == "copy") {
+                unsigned source = toRegister(line.operands[1]);
+                if (source != target and not tainted.count(source) and not tainted.count(target)) {
+                    copies[target] = source;
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    bool eliminateDeadStores(vector<Line>& lines, const set<unsigned>& tainted, const vector<bool>& nothrow, bool has_catchers) {
+        /** Removes stores to registers that are not read afterwards.
+         *
+         *  Liveness of registers is computed over the control flow graph of the function.
+         *  Instructions the optimiser does not understand are assumed to read all their operands.
+         *  Blocks run in the frame of the function so entering a block reads every register, and
+         *  so does every instruction that could throw if the function has catchers.
+         */
+        auto marks = findMarks(lines);
+
+        vector<decltype(lines.size())> instructions;
+        set<unsigned> all_registers = { 0 };
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            if (lines[i].kind != Kind::INSTRUCTION or lines[i].removed) {
+                continue;
+            }
+            instructions.push_back(i);
+            for (const auto& operand : lines[i].operands) {
+                if (isRegister(operand)) {
+                    all_registers.insert(toRegister(operand));
+                }
+            }
+        }
+
+        auto count = instructions.size();
+        map<decltype(lines.size()), decltype(count)> positions;
+        for (decltype(count) k = 0; k < count; ++k) {
+            positions[instructions[k]] = k;
+        }
+
+        vector<vector<decltype(count)>> successors(count);
+        vector<set<unsigned>> used(count), defined(count);
+        for (decltype(count) k = 0; k < count; ++k) {
+            const Line& line = lines[instructions[k]];
+            auto target = [&marks, &positions](const string& mark, vector<decltype(count)>& to) {
+                if (marks.count(mark) and positions.count(marks.at(mark))) {
+                    to.push_back(positions.at(marks.at(mark)));
+                }
+            };
+            if (line.opcode == "jump") {
+                target(line.operands[0], successors[k]);
+            } else if (line.opcode == "branch") {
+                target(line.operands[1], successors[k]);
+                if (line.operands.size() == 3) {
+                    target(line.operands[2], successors[k]);
+                } else if ((k+1) < count) {
+                    successors[k].push_back(k+1);
+                }
+            } else if (not TERMINATORS.count(line.opcode) and (k+1) < count) {
+                successors[k].push_back(k+1);
+            }
+
+            if (line.opcode == "enter" or (has_catchers and not nothrow[instructions[k]])) {
+                used[k] = all_registers;
+            } else if (not understood(line)) {
+                for (const auto& operand : line.operands) {
+                    if (isRegister(operand)) {
+                        used[k].insert(toRegister(operand));
+                    }
+                }
+            } else {
+                auto u = uses(line);
+                used[k].insert(u.begin(), u.end());
+                auto d = definitions(line);
+                defined[k].insert(d.begin(), d.end());
+            }
+        }
+
+        vector<set<unsigned>> live_in(count), live_out(count);
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto k = count; k > 0; --k) {
+                auto i = (k-1);
+                set<unsigned> out;
+                for (auto each : successors[i]) {
+                    out.insert(live_in[each].begin(), live_in[each].end());
+                }
+                set<unsigned> in = used[i];
+                for (auto each : out) {
+                    if (not defined[i].count(each)) {
+                        in.insert(each);
+                    }
+                }
+                if (in != live_in[i] or out != live_out[i]) {
+                    live_in[i] = in;
+                    live_out[i] = out;
+                    changed = true;
+                }
+            }
+        }
+
+        bool removed = false;
+        for (decltype(count) k = 0; k < count; ++k) {
+            Line& line = lines[instructions[k]];
+            const auto& op = line.opcode;
+            bool removable = (op == "istore" or op == "izero" or op == "copy" or op == "iinc" or op == "idec" or COMPARISONS.count(op));
+            if (not removable or not nothrow[instructions[k]]) {
+                continue;
+            }
+            unsigned target = toRegister(line.operands[0]);
+            if (tainted.count(target) or live_out[k].count(target)) {
+                continue;
+            }
+            line.removed = true;
+            removed = true;
+        }
+        return removed;
+    }
+
+    bool removeUnreachableCode(vector<Line>& lines) {
+        /** Removes instructions that follow unconditional transfers of control and are not jumped to.
+         *  Last instruction of a function is always kept.
+         */
+        set<string> referenced;
+        decltype(lines.size()) last = lines.size();
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            if (lines[i].kind != Kind::INSTRUCTION or lines[i].removed) {
+                continue;
+            }
+            last = i;
+            if (lines[i].opcode == "jump" or lines[i].opcode == "branch") {
+                referenced.insert((lines[i].operands.begin() + (lines[i].opcode == "branch" ? 1 : 0)), lines[i].operands.end());
+            }
+        }
+
+        bool changed = false;
+        bool reachable = true;
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            Line& line = lines[i];
+            if (line.removed or line.kind == Kind::RAW) {
+                continue;
+            }
+            if (line.kind == Kind::MARK) {
+                reachable = (reachable or referenced.count(line.opcode));
+                continue;
+            }
+            if (not reachable and i != last) {
+                line.removed = true;
+                changed = true;
+                continue;
+            }
+            if (TERMINATORS.count(line.opcode)) {
+                reachable = false;
+            }
+        }
+        return changed;
+    }
+
+    bool threadJumps(vector<Line>& lines) {
+        /** Redirects jumps to jumps to their final targets, and removes jumps to the next instruction.
+         */
+        auto marks = findMarks(lines);
+
+        auto resolve = [&lines, &marks](const string& mark) -> string {
+            string target = mark;
+            set<string> seen = { target };
+            while (marks.count(target)) {
+                const Line& line = lines[marks.at(target)];
+                if (line.opcode != "jump" or line.operands.size() != 1 or seen.count(line.operands[0])) {
+                    break;
+                }
+                target = line.operands[0];
+                seen.insert(target);
+            }
+            return target;
+        };
+
+        bool changed = false;
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            Line& line = lines[i];
+            if (line.removed or line.kind != Kind::INSTRUCTION) {
+                continue;
+            }
+            if (line.opcode != "jump" and line.opcode != "branch") {
+                continue;
+            }
+            for (decltype(line.operands.size()) j = (line.opcode == "branch" ? 1 : 0); j < line.operands.size(); ++j) {
+                // jumps must not be redirected to themselves
+                string target = resolve(line.operands[j]);
+                if (target != line.operands[j] and marks.count(target) and marks.at(target) != i) {
+                    auto operands = line.operands;
+                    operands[j] = target;
+                    line.rewrite(line.opcode, operands);
+                    changed = true;
+                }
+            }
+            if (line.opcode == "jump" and marks.count(line.operands[0])) {
+                bool jumps_to_next = true;
+                for (auto k = (i+1); k < marks.at(line.operands[0]); ++k) {
+                    if (lines[k].kind == Kind::INSTRUCTION and not lines[k].removed) {
+                        jumps_to_next = false;
+                        break;
+                    }
+                }
+                if (jumps_to_next and marks.at(line.operands[0]) > i) {
+                    line.removed = true;
+                    changed = true;
+                }
+            }
+        }
+        return changed;
+    }
+
+
+    /*  Inlining.
+     *
+     *  Calls to small leaf functions that are defined in the same module are replaced with bodies of the
+     *  functions.
+     *  Registers of inlined function are moved past registers used by the caller (and blocks it enters), and
+     *  parameters are copied (or moved) directly from registers they were passed from into registers they are read into.
+     *  Only straight-line functions (without jumps and branches) that read only registers they have
+     *  written before, and use only instructions that cannot create references, processes or frames are inlined;
+     *  the same registers can then be reused by every inlined call in a function.
+     */
+    const set<string> INLINABLE = { "istore", "izero", "iinc", "idec", "iadd", "isub", "imul", "idiv", "ilt", "ilte", "igt", "igte", "ieq", "copy", "move", "not", "print", "echo", "nop", "arg", "return", };
+
+    struct Inlinable {
+        vector<Line> instructions;
+        unsigned registers;
+        map<unsigned, unsigned> argument_reads;
+        bool sets_return_value;
+    };
+
+    bool inlinable(const vector<string>& body, unsigned threshold, Inlinable& inlined) {
+        vector<Line> lines = parse(body);
+        if (not optimisable(lines)) {
+            return false;
+        }
+
+        inlined = Inlinable();
+        set<unsigned> defined;
+        unsigned size = 0;
+        for (const auto& line : lines) {
+            if (line.kind == Kind::RAW) {
+                continue;
+            }
+            if (line.kind == Kind::MARK or not INLINABLE.count(line.opcode)) {
+                return false;
+            }
+            if (not inlined.instructions.empty() and inlined.instructions.back().opcode == "return") {
+                return false;
+            }
+
+            const auto& op = line.opcode;
+            const auto& operands = line.operands;
+            vector<unsigned> read;
+            vector<unsigned> written;
+            if (op == "arg") {
+                if (operands.size() != 2 or not isRegister(operands[0]) or not isRegister(operands[1])) {
+                    return false;
+                }
+                ++inlined.argument_reads[toRegister(operands[1])];
+                written = { toRegister(operands[0]) };
+            } else if (op == "not") {
+                if (operands.size() != 1 or not isRegister(operands[0])) {
+                    return false;
+                }
+                read = written = { toRegister(operands[0]) };
+            } else if (op == "return") {
+                inlined.sets_return_value = defined.count(0);
+            } else {
+                if (not understood(line)) {
+                    return false;
+                }
+                read = uses(line);
+                written = definitions(line);
+                if (op == "move") {
+                    written.resize(1);
+                }
+            }
+
+            for (auto each : read) {
+                if (not defined.count(each)) {
+                    return false;
+                }
+            }
+            if (op == "move") {
+                defined.erase(toRegister(operands[1]));
+            }
+            for (auto each : written) {
+                defined.insert(each);
+            }
+            for (decltype(operands.size()) i = 0; i < operands.size(); ++i) {
+                bool is_register = not ((op == "arg" or op == "istore") and i == 1);
+                if (is_register) {
+                    inlined.registers = max(inlined.registers, (toRegister(operands[i]) + 1));
+                }
+            }
+
+            if (op != "nop" and op != "return") {
+                ++size;
+            }
+            inlined.instructions.push_back(line);
+        }
+
+        return (not inlined.instructions.empty() and inlined.instructions.back().opcode == "return" and size <= threshold);
+    }
+
+    struct CallSite {
+        vector<Line>::size_type frame;
+        vector<Line>::size_type call;
+        unsigned arguments;
+        unsigned return_register;
+        string function;
+        map<unsigned, pair<unsigned, bool>> parameters;     // slot -> (source register, moved)
+    };
+
+    bool findCallSite(const vector<Line>& lines, vector<Line>::size_type frame, CallSite& site) {
+        /** Matches a `frame`, `param`s and `pamv`s, and `call` sequence starting at given line.
+         */
+        const Line& frame_line = lines[frame];
+        if (frame_line.kind != Kind::INSTRUCTION or frame_line.opcode != "frame" or frame_line.operands.empty() or frame_line.operands.size() > 2) {
+            return false;
+        }
+        for (const auto& each : frame_line.operands) {
+            if (not isRegister(each)) {
+                return false;
+            }
+        }
+
+        site = CallSite();
+        site.frame = frame;
+        site.arguments = toRegister(frame_line.operands[0]);
+        set<unsigned> sources;
+        for (auto i = (frame+1); i < lines.size(); ++i) {
+            const Line& line = lines[i];
+            if (line.kind == Kind::RAW) {
+                continue;
+            }
+            if (line.kind == Kind::MARK) {
+                return false;
+            }
+            const auto& operands = line.operands;
+            if (line.opcode == "param" or line.opcode == "pamv") {
+                if (operands.size() != 2 or not isRegister(operands[0]) or not isRegister(operands[1])) {
+                    return false;
+                }
+                unsigned slot = toRegister(operands[0]);
+                unsigned source = toRegister(operands[1]);
+                if (slot >= site.arguments or site.parameters.count(slot) or sources.count(source)) {
+                    return false;
+                }
+                sources.insert(source);
+                site.parameters[slot] = { source, (line.opcode == "pamv") };
+                continue;
+            }
+            if (line.opcode == "call" and operands.size() == 2 and isRegister(operands[0])) {
+                site.call = i;
+                site.return_register = toRegister(operands[0]);
+                site.function = operands[1];
+                return true;
+            }
+            return false;
+        }
+        return false;
+    }
+
+    bool inlinableAt(const CallSite& site, const Inlinable& inlined) {
+        if (site.return_register != 0 and not inlined.sets_return_value) {
+            return false;
+        }
+        for (const auto& each : inlined.argument_reads) {
+            if (not site.parameters.count(each.first)) {
+                return false;
+            }
+            if (site.parameters.at(each.first).second and each.second != 1) {
+                return false;
+            }
+        }
+        for (const auto& each : site.parameters) {
+            // pass-by-move parameters must be used
+            if (each.second.second and not inlined.argument_reads.count(each.first)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    vector<string> inlineAt(const CallSite& site, const Inlinable& inlined, unsigned base, const string& indent) {
+        auto remap = [base](const string& r) -> string {
+            return to_string(base + toRegister(r));
+        };
+
+        vector<string> body;
+        for (const auto& line : inlined.instructions) {
+            const auto& op = line.opcode;
+            const auto& operands = line.operands;
+            if (op == "nop") {
+                continue;
+            } else if (op == "arg") {
+                auto parameter = site.parameters.at(toRegister(operands[1]));
+                body.push_back(indent + (parameter.second ? "move " : "copy ") + remap(operands[0]) + " " + to_string(parameter.first));
+            } else if (op == "return") {
+                // `return` places returned object the same way `move` does unless the object it replaces is
+                // also held in another register, and only enclosing (which makes functions unoptimisable) does that
+                if (site.return_register != 0) {
+                    body.push_back(indent + "move " + to_string(site.return_register) + " " + remap("0"));
+                }
+            } else {
+                string text = (indent + op);
+                for (decltype(operands.size()) i = 0; i < operands.size(); ++i) {
+                    text += (" " + ((op == "istore" and i == 1) ? operands[i] : remap(operands[i])));
+                }
+                body.push_back(text);
+            }
+        }
+        return body;
+    }
+}
+
+
+vector<string> assembler::optimise::function(const vector<string>& body) {
+    vector<Line> lines = parse(body);
+    if (not optimisable(lines)) {
+        return body;
+    }
+
+    set<unsigned> tainted = findTaintedRegisters(lines);
+    bool has_catchers = any_of(lines.begin(), lines.end(), [](const Line& line) -> bool {
+        return (line.kind == Kind::INSTRUCTION and line.opcode == "try");
+    });
+
+    // passes enable each other (e.g. folded branches leave unreachable code behind) so
+    // they are repeated until nothing changes
+    const unsigned MAX_ROUNDS = 8;
+    vector<bool> nothrow;
+    for (unsigned round = 0; round < MAX_ROUNDS; ++round) {
+        bool changed = false;
+        changed = (foldConstants(lines, tainted, nothrow) or changed);
+        changed = (eliminateDeadStores(lines, tainted, nothrow, has_catchers) or changed);
+        changed = (removeUnreachableCode(lines) or changed);
+        changed = (threadJumps(lines) or changed);
+        if (not changed) {
+            break;
+        }
+    }
+
+    vector<string> optimised;
+    for (const auto& each : lines) {
+        optimised.push_back(each.str());
+    }
+    return optimised;
+}
+
+vector<string> assembler::optimise::lines(const vector<string>& expanded_lines) {
+    // functions used to create closures run with registers enclosed from elsewhere
+    set<string> closures;
+    for (const auto& each : expanded_lines) {
+        vector<string> chunks = str::chunks(str::lstrip(each));
+        if (chunks.size() == 3 and chunks[0] == "closure") {
+            closures.insert(chunks[2]);
+        }
+    }
+
+    vector<string> optimised;
+    for (decltype(expanded_lines.size()) i = 0; i < expanded_lines.size(); ++i) {
+        string line = str::lstrip(expanded_lines[i]);
+        optimised.push_back(expanded_lines[i]);
+        if (not assembler::utils::lines::is_function(line)) {
+            continue;
+        }
+
+        string name = str::lstrip(str::sub(line, str::chunk(line).size()));
+        vector<string> body;
+        auto j = (i+1);
+        while (j < expanded_lines.size() and not assembler::utils::lines::is_end(str::lstrip(expanded_lines[j]))) {
+            body.push_back(expanded_lines[j]);
+            ++j;
+        }
+
+        if (not closures.count(name)) {
+            body = assembler::optimise::function(body);
+        }
+        optimised.insert(optimised.end(), body.begin(), body.end());
+        i = (j-1);
+    }
+
+    return optimised;
+}
+
+vector<string> assembler::optimise::inlineCalls(const vector<string>& expanded_lines, unsigned threshold, vector<vector<string>::size_type>& origins) {
+    /** Inlines calls to small leaf functions.
+     *
+     *  Functions with at most `threshold` instructions are inlined.
+     *  Origins are filled with indexes of lines in the original source that each of the returned lines comes from.
+     */
+    map<string, vector<string>> function_bodies;
+    map<string, vector<string>> block_bodies;
+    map<string, pair<vector<string>::size_type, vector<string>::size_type>> function_ranges;
+    set<string> closures;
+    for (decltype(expanded_lines.size()) i = 0; i < expanded_lines.size(); ++i) {
+        string line = str::lstrip(expanded_lines[i]);
+        vector<string> chunks = str::chunks(line);
+        if (chunks.size() == 3 and chunks[0] == "closure") {
+            closures.insert(chunks[2]);
+        }
+        bool is_function = assembler::utils::lines::is_function(line);
+        if (not (is_function or assembler::utils::lines::is_block(line))) {
+            continue;
+        }
+
+        string name = str::lstrip(str::sub(line, str::chunk(line).size()));
+        vector<string> body;
+        auto j = (i+1);
+        while (j < expanded_lines.size() and not assembler::utils::lines::is_end(str::lstrip(expanded_lines[j]))) {
+            body.push_back(expanded_lines[j]);
+            ++j;
+        }
+        if (is_function) {
+            function_bodies[name] = body;
+            function_ranges[name] = { (i+1), j };
+        } else {
+            block_bodies[name] = body;
+        }
+    }
+
+    map<string, Inlinable> inlinables;
+    for (const auto& each : function_bodies) {
+        Inlinable inlined;
+        if (threshold and inlinable(each.second, threshold, inlined)) {
+            inlinables[each.first] = inlined;
+        }
+    }
+
+    // inlined calls are kept for each line that begins a call sequence, with the lines replacing it
+    map<vector<string>::size_type, pair<vector<string>::size_type, vector<string>>> replacements;
+    for (const auto& each : function_bodies) {
+        if (inlinables.empty() or closures.count(each.first)) {
+            continue;
+        }
+        vector<Line> lines = parse(each.second);
+        if (not optimisable(lines)) {
+            continue;
+        }
+        unsigned base = static_cast<unsigned>(assembler::registers::count(each.second, block_bodies));
+        if (base == 0) {
+            continue;
+        }
+
+        auto offset = function_ranges.at(each.first).first;
+        for (decltype(lines.size()) i = 0; i < lines.size(); ++i) {
+            CallSite site;
+            if (not findCallSite(lines, i, site) or not inlinables.count(site.function)) {
+                continue;
+            }
+            const Inlinable& inlined = inlinables.at(site.function);
+            if (not inlinableAt(site, inlined)) {
+                continue;
+            }
+            replacements[offset + site.frame] = { (offset + site.call), inlineAt(site, inlined, base, lines[site.call].indent) };
+            i = site.call;
+        }
+    }
+
+    vector<string> inlined_lines;
+    origins.clear();
+    for (decltype(expanded_lines.size()) i = 0; i < expanded_lines.size(); ++i) {
+        if (not replacements.count(i)) {
+            inlined_lines.push_back(expanded_lines[i]);
+            origins.push_back(i);
+            continue;
+        }
+        const auto& replacement = replacements.at(i);
+        for (const auto& each : replacement.second) {
+            inlined_lines.push_back(each);
+            origins.push_back(replacement.first);
+        }
+        i = replacement.first;
+    }
+    return inlined_lines;
+}
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <set>
+#include <viua/support/string.h>
+#include <viua/cg/assembler/assembler.h>
+using namespace std;
+
+
+/*  Number of local registers a function needs is one more than the highest register index
+ *  it can access.
+ *  Blocks are executed in the frame of the function that entered them (and so are catchers), so
+ *  register indexes used by blocks a function enters count as used by the function.
+ *
+ *  The count is only an upper bound of indexes that are spelled out in the source.
+ *  It is not computed for functions accessing registers in ways that are not visible in the source:
+ *  indirect register operands, packing ranges of registers into vectors (packing is bounded by size
+ *  of register set requested by the frame), closures (register sets of closures are as big as register
+ *  set of the function that created them), and blocks that are not defined in the assembled module.
+ *
+ *  Functions containing tail calls are also skipped: tail-called function reuses register set of the
+ *  caller (and grows it if it needs more registers than the caller has).
+ */
+
+namespace {
+    const uint64_t UNKNOWN = 0;
+
+    bool isRegisterIndex(const string& s) {
+        return (str::isnum(s, false) and s.size() < 10);
+    }
+
+    uint64_t highestRegisterIndex(const vector<string>&, const map<string, vector<string>>&, set<string>&, bool&);
+
+    uint64_t highestRegisterIndexOfBlock(const string& name, const map<string, vector<string>>& blocks, set<string>& visited, bool& known) {
+        if (visited.count(name)) {
+            return 0;
+        }
+        visited.insert(name);
+        if (blocks.count(name) == 0) {
+            known = false;
+            return 0;
+        }
+        return highestRegisterIndex(blocks.at(name), blocks, visited, known);
+    }
+
+    uint64_t highestRegisterIndex(const vector<string>& body, const map<string, vector<string>>& blocks, set<string>& visited, bool& known) {
+        uint64_t highest = 0;
+        for (const auto& each : body) {
+            string line = str::lstrip(each);
+            if (line.empty() or line[0] == ';' or str::startswith(line, "--")) {
+                continue;
+            }
+            string opcode = str::chunk(line);
+            if (opcode[0] == '.' and opcode != ".name:") {
+                continue;
+            }
+
+            vector<string> operands;
+            istringstream in(str::sub(line, opcode.size()));
+            string operand;
+            while (in >> operand) {
+                operands.push_back(operand);
+            }
+
+            if (opcode == "tailcall" or opcode == "closure" or (opcode == "vec" and operands.size() == 3)) {
+                known = false;
+                return 0;
+            }
+            for (const auto& op : operands) {
+                if (op[0] == '@' or op[0] == '*') {
+                    known = false;
+                    return 0;
+                }
+            }
+
+            // operands that are not register indexes (e.g. literals, parameter slots, and jump targets) are dropped
+            if (opcode == "frame" or opcode == "jump") {
+                operands.clear();
+            } else if ((opcode == "enter" or opcode == "catch") and not operands.empty()) {
+                uint64_t in_block = highestRegisterIndexOfBlock(operands.back(), blocks, visited, known);
+                if (not known) {
+                    return 0;
+                }
+                highest = max(highest, in_block);
+                operands.clear();
+            } else if ((opcode == "param" or opcode == "pamv") and not operands.empty()) {
+                operands.erase(operands.begin());
+            } else if ((opcode == "arg" or opcode == "istore" or opcode == "fstore") and operands.size() > 1) {
+                operands.erase(operands.begin()+1);
+            } else if (opcode == "branch" and operands.size() > 1) {
+                operands.resize(1);
+            }
+
+            for (const auto& op : operands) {
+                if (isRegisterIndex(op)) {
+                    highest = max<uint64_t>(highest, stoull(op));
+                }
+            }
+        }
+        return highest;
+    }
+}
+
+uint64_t assembler::registers::count(const vector<string>& body, const map<string, vector<string>>& blocks) {
+    /** Returns number of local registers a function needs, or zero if it cannot be determined.
+     */
+    set<string> visited;
+    bool known = true;
+    uint64_t highest = highestRegisterIndex(body, blocks, visited, known);
+    return (known ? (highest + 1) : UNKNOWN);
+}
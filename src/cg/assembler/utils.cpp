@@ -18,34 +18,66 @@
  */
 
 #include <string>
-#include <regex>
 #include <viua/support/string.h>
 #include <viua/cg/assembler/assembler.h>
 using namespace std;
 
 
-regex assembler::utils::getFunctionNameRegex() {
-    return regex{"(?:::)?[a-zA-Z_][a-zA-Z0-9_]*(?:::[a-zA-Z_][a-zA-Z0-9_]*)*(?:(/[0-9]*)?)?"};
-}
+namespace {
+    bool isIdentifierStart(const char c) {
+        return ((c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or c == '_');
+    }
+    bool isIdentifierPart(const char c) {
+        return (isIdentifierStart(c) or (c >= '0' and c <= '9'));
+    }
 
-bool assembler::utils::isValidFunctionName(const string& function_name) {
-    return regex_match(function_name, getFunctionNameRegex());
+    string::size_type matchFunctionName(const string& function_name) {
+        /*  Matches function name without the regex engine.
+         *  Regex equivalent: `(?:::)?[a-zA-Z_][a-zA-Z0-9_]*(?:::[a-zA-Z_][a-zA-Z0-9_]*)*(?:(/[0-9]*)?)?`
+         *
+         *  Returns index of the '/' separating name from arity (or size of the name if
+         *  it has no arity), or string::npos if the name is not valid.
+         */
+        string::size_type i = 0;
+        const auto size = function_name.size();
+        if (function_name.compare(0, 2, "::") == 0) {
+            i = 2;
+        }
+        while (true) {
+            if (i == size or not isIdentifierStart(function_name[i])) {
+                return string::npos;
+            }
+            while (i < size and isIdentifierPart(function_name[i])) {
+                ++i;
+            }
+            if (function_name.compare(i, 2, "::") != 0) {
+                break;
+            }
+            i += 2;
+        }
+        if (i == size) {
+            return i;
+        }
+        if (function_name[i] != '/' or function_name.find_first_not_of("0123456789", i+1) != string::npos) {
+            return string::npos;
+        }
+        return i;
+    }
 }
 
-smatch assembler::utils::matchFunctionName(const string& function_name) {
-    smatch parts;
-    regex_match(function_name, parts, getFunctionNameRegex());
-    return parts;
+bool assembler::utils::isValidFunctionName(const string& function_name) {
+    return (matchFunctionName(function_name) != string::npos);
 }
 
 int assembler::utils::getFunctionArity(const string& function_name) {
     int arity = -1;
-    auto parts = matchFunctionName(function_name);
-    auto sz = parts[1].str().size();
-    if (sz > 1) {
-        ssub_match a = parts[1];
-        arity = stoi(a.str().substr(1)); // cut of the '/' before converting to integer
-    } else if (sz == 1) {
+    auto slash = matchFunctionName(function_name);
+    if (slash == string::npos or slash == function_name.size()) {
+        return arity;
+    }
+    if ((function_name.size() - slash) > 1) {
+        arity = stoi(function_name.substr(slash+1)); // cut of the '/' before converting to integer
+    } else {
         arity = -2;
     }
     return arity;
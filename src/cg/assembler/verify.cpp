@@ -17,14 +17,15 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <sstream>
 #include <vector>
 #include <tuple>
 #include <map>
+#include <set>
 #include <algorithm>
-#include <regex>
 #include <viua/support/string.h>
 #include <viua/bytecode/maps.h>
 #include <viua/cg/assembler/assembler.h>
@@ -33,11 +34,166 @@ using namespace std;
 
 
 using ErrorReport = pair<unsigned, string>;
+using assembler::cfg::graph_t;
+using assembler::cfg::instruction_t;
+using assembler::cfg::index_type;
+
+
+/*  Checks of single instructions iterate over instructions of control flow graphs built once for the
+ *  whole source.
+ *  Checks of frames, and try frames are dataflow analyses over the graphs so that they follow jumps
+ *  instead of source order.
+ *  Checks of the structure of functions and blocks (their names, bodies, and how they end) work on lines
+ *  because control flow graphs are only built for functions and blocks that are well-formed.
+ */
+
+namespace {
+    template<typename State, typename Transfer, typename Check> void walk(const graph_t& graph, const State& entry, Transfer transfer, Check check) {
+        /** Runs a forward dataflow analysis over the graph, and
+         *  then calls check for every instruction in source order with the state before it.
+         *
+         *  States meeting at a node must be equal to be known, if they differ state at the node
+         *  becomes unknown (i.e. default-constructed).
+         *  Unreachable code, and all code of graphs with jumps that could not be resolved, gets the state
+         *  code preceding it in the source leaves so that it is checked as if control fell into it.
+         *  In graphs with unresolved jumps code that control cannot fall into may be a target of such a
+         *  jump so its state is unknown.
+         */
+        vector<State> states(graph.nodes.size());
+        vector<bool> reached(graph.nodes.size(), false);
+
+        if (graph.complete and not graph.nodes.empty()) {
+            states[0] = entry;
+            reached[0] = true;
+            vector<index_type> pending = { 0 };
+            while (not pending.empty()) {
+                index_type n = pending.back();
+                pending.pop_back();
+                if (graph.nodes[n].successors.empty()) {
+                    continue;
+                }
+
+                State state = states[n];
+                for (index_type i = graph.nodes[n].begin; i < graph.nodes[n].end; ++i) {
+                    transfer(graph.instructions[i], state);
+                }
+                for (auto each : graph.nodes[n].successors) {
+                    if (not reached[each]) {
+                        reached[each] = true;
+                        states[each] = state;
+                        pending.push_back(each);
+                    } else if (states[each].known and not (states[each] == state)) {
+                        states[each] = State();
+                        pending.push_back(each);
+                    }
+                }
+            }
+        }
+
+        State state = entry;
+        for (index_type n = 0; n < graph.nodes.size(); ++n) {
+            if (reached[n]) {
+                state = states[n];
+            } else if (n > 0 and not graph.complete) {
+                const auto& successors = graph.nodes[n-1].successors;
+                if (find(successors.begin(), successors.end(), n) == successors.end()) {
+                    state = State();
+                }
+            }
+            for (index_type i = graph.nodes[n].begin; i < graph.nodes[n].end; ++i) {
+                check(graph.instructions[i], state);
+                transfer(graph.instructions[i], state);
+            }
+        }
+    }
+
+    bool isIndex(const string& s) {
+        return (str::isnum(s, false) and s.size() < 10);
+    }
+
+    bool consumesFrame(const string& opcode) {
+        return (opcode == "call" or opcode == "tailcall" or opcode == "process" or opcode == "watchdog" or opcode == "fcall" or opcode == "msg");
+    }
+
+    struct frame_t {
+        bool known;
+        bool spawned;
+        index_type line;
+        // -1 if the number of parameters cannot be statically determined
+        long parameters;
+        // first passes to parameter slots (as line indexes plus one, zero for empty slots)
+        vector<index_type> passes;
+
+        bool operator==(const frame_t& that) const {
+            if (not (known and that.known)) {
+                return (known == that.known);
+            }
+            return (spawned == that.spawned and line == that.line and parameters == that.parameters and passes == that.passes);
+        }
+
+        frame_t(bool k = false): known(k), spawned(false), line(0), parameters(-1) {}
+    };
+
+    void spawnFrames(const instruction_t& instruction, frame_t& frame) {
+        if (instruction.opcode == "frame") {
+            frame = frame_t(true);
+            frame.spawned = true;
+            frame.line = instruction.line;
+            if (not instruction.operands.empty() and isIndex(instruction.operands[0])) {
+                frame.parameters = stol(instruction.operands[0]);
+                frame.passes.resize(static_cast<index_type>(frame.parameters), 0);
+            }
+        } else if (instruction.opcode == "param" or instruction.opcode == "pamv") {
+            if (frame.known and frame.spawned and not instruction.operands.empty() and isIndex(instruction.operands[0])) {
+                index_type slot = stoul(instruction.operands[0]);
+                if (slot < frame.passes.size() and frame.passes[slot] == 0) {
+                    frame.passes[slot] = (instruction.line+1);
+                }
+            }
+        } else if (consumesFrame(instruction.opcode) and not (frame.known and not frame.spawned)) {
+            frame = frame_t(true);
+        }
+    }
+
+    long parametersOf(const frame_t& frame) {
+        return ((frame.known and frame.spawned) ? frame.parameters : -1);
+    }
+
+    struct try_frame_t {
+        bool known;
+        bool pending;
+        index_type line;
+
+        bool operator==(const try_frame_t& that) const {
+            if (not (known and that.known)) {
+                return (known == that.known);
+            }
+            return (pending == that.pending and line == that.line);
+        }
+
+        try_frame_t(bool k = false): known(k), pending(false), line(0) {}
+    };
+
+    void spawnTryFrames(const instruction_t& instruction, try_frame_t& frame) {
+        if (instruction.opcode == "try") {
+            frame = try_frame_t(true);
+            frame.pending = true;
+            frame.line = instruction.line;
+        } else if (instruction.opcode == "enter") {
+            frame = try_frame_t(true);
+        }
+    }
+}
 
 
 void assembler::verify::functionCallsAreDefined(const vector<string>& lines, const vector<string>& function_names, const vector<string>& function_signatures) {
     ostringstream report("");
     string line;
+
+    // a function is defined if its body or its signature is known
+    set<string> defined_functions(function_names.begin(), function_names.end());
+    defined_functions.insert(function_signatures.begin(), function_signatures.end());
+
     for (unsigned i = 0; i < lines.size(); ++i) {
         line = str::lstrip(lines[i]);
         if (not (str::startswith(line, "call") or str::startswith(line, "process") or str::startswith(line, "watchdog"))) {
@@ -54,135 +210,98 @@ void assembler::verify::functionCallsAreDefined(const vector<string>& lines, con
         // if it is not given - second operand is empty, and function name must be taken from first operand
         string& check_function = (function.size() ? function : return_register);
 
-        bool is_undefined = (find(function_names.begin(), function_names.end(), check_function) == function_names.end());
-        // if function is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(function_signatures.begin(), function_signatures.end(), check_function) == function_signatures.end());
-        }
-
-        if (is_undefined) {
+        if (defined_functions.count(check_function) == 0) {
             report << ((instr_name == "call" or instr_name == "tailcall") ? "call to" : instr_name == "process" ? "process from" : "watchdog from") << " undefined function " << check_function;
             throw ErrorReport(i, report.str());
         }
     }
 }
 
-void assembler::verify::functionCallArities(const vector<string>& lines) {
-    ostringstream report("");
-    string line;
-    int frame_parameters_count = 0;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not (str::startswith(line, "call") or str::startswith(line, "process") or str::startswith(line, "watchdog") or str::startswith(line, "frame"))) {
-            continue;
-        }
-
-        string instr_name = str::chunk(line);
-        line = str::lstrip(line.substr(instr_name.size()));
-
-        if (instr_name == "frame") {
-            line = str::chunk(line);
-            if (str::isnum(line)) {
-                frame_parameters_count = stoi(str::chunk(line));
-            } else {
-                frame_parameters_count = -1;
+void assembler::verify::functionCallArities(const vector<graph_t>& graphs) {
+    for (const auto& graph : graphs) {
+        walk(graph, frame_t(true), spawnFrames, [](const instruction_t& instruction, const frame_t& frame) {
+            if (not (instruction.opcode == "call" or instruction.opcode == "process" or instruction.opcode == "watchdog")) {
+                return;
             }
-            continue;
-        }
 
-        string function_name = str::chunk(line);
-        line = str::lstrip(line.substr(function_name.size()));
-        if (line.size()) {
-            function_name = str::chunk(line);
-        }
+            ostringstream report("");
+            string function_name = (instruction.operands.size() > 1 ? instruction.operands[1] : instruction.operands.empty() ? "" : instruction.operands[0]);
+            long frame_parameters_count = parametersOf(frame);
 
-        if (not assembler::utils::isValidFunctionName(function_name)) {
-            report << "'" << function_name << "' is not a valid function name";
-            throw ErrorReport(i, report.str());
-        }
+            if (not assembler::utils::isValidFunctionName(function_name)) {
+                report << "'" << function_name << "' is not a valid function name";
+                throw ErrorReport(instruction.line, report.str());
+            }
 
-        int arity = assembler::utils::getFunctionArity(function_name);
+            int arity = assembler::utils::getFunctionArity(function_name);
 
-        if (arity == -1) {
-            report << "call to function with undefined arity ";
-            if (frame_parameters_count >= 0) {
-                report << "as " << function_name << (arity == -1 ? "/" : "") << frame_parameters_count;
-            } else {
-                report << ": " << function_name;
+            if (arity == -1) {
+                report << "call to function with undefined arity ";
+                if (frame_parameters_count >= 0) {
+                    report << "as " << function_name << (arity == -1 ? "/" : "") << frame_parameters_count;
+                } else {
+                    report << ": " << function_name;
+                }
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (frame_parameters_count == -1) {
+                // frame paramters count could not be statically determined, deffer the check until runtime
+                return;
             }
-            throw ErrorReport(i, report.str());
-        }
-        if (frame_parameters_count == -1) {
-            // frame paramters count could not be statically determined, deffer the check until runtime
-            continue;
-        }
 
-        if (arity > 0 and arity != frame_parameters_count) {
-            report << "invalid number of parameters in call to function " << function_name << ": expected " << arity << " got " << frame_parameters_count;
-            throw ErrorReport(i, report.str());
-        }
+            if (arity > 0 and arity != frame_parameters_count) {
+                report << "invalid number of parameters in call to function " << function_name << ": expected " << arity << " got " << frame_parameters_count;
+                throw ErrorReport(instruction.line, report.str());
+            }
+        });
     }
 }
 
-void assembler::verify::msgArities(const vector<string>& lines) {
-    ostringstream report("");
-    string line;
-    int frame_parameters_count = 0;
-
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not (str::startswith(line, "msg") or str::startswith(line, "frame"))) {
-            continue;
-        }
-
-        string instr_name = str::chunk(line);
-        line = str::lstrip(line.substr(instr_name.size()));
-
-        if (instr_name == "frame") {
-            line = str::chunk(line);
-            if (str::isnum(line)) {
-                frame_parameters_count = stoi(str::chunk(line));
-            } else {
-                frame_parameters_count = -1;
+void assembler::verify::msgArities(const vector<graph_t>& graphs) {
+    for (const auto& graph : graphs) {
+        walk(graph, frame_t(true), spawnFrames, [](const instruction_t& instruction, const frame_t& frame) {
+            if (instruction.opcode != "msg") {
+                return;
             }
-            continue;
-        }
 
-        string function_name = str::chunk(line);
-        if (str::isnum(function_name)) {
-            function_name = str::chunk(str::lstrip(line.substr(function_name.size())));
-        }
+            ostringstream report("");
+            string function_name = (instruction.operands.empty() ? "" : instruction.operands[0]);
+            if (str::isnum(function_name) and instruction.operands.size() > 1) {
+                function_name = instruction.operands[1];
+            }
+            long frame_parameters_count = parametersOf(frame);
 
-        if (not assembler::utils::isValidFunctionName(function_name)) {
-            report << "'" << function_name << "' is not a valid function name";
-            throw ErrorReport(i, report.str());
-        }
+            if (not assembler::utils::isValidFunctionName(function_name)) {
+                report << "'" << function_name << "' is not a valid function name";
+                throw ErrorReport(instruction.line, report.str());
+            }
 
-        if (frame_parameters_count == 0) {
-            report << "invalid number of parameters in dynamic dispatch of " << function_name << ": expected at least 1, got 0";
-            throw ErrorReport(i, report.str());
-        }
+            if (frame_parameters_count == 0) {
+                report << "invalid number of parameters in dynamic dispatch of " << function_name << ": expected at least 1, got 0";
+                throw ErrorReport(instruction.line, report.str());
+            }
 
-        int arity = assembler::utils::getFunctionArity(function_name);
+            int arity = assembler::utils::getFunctionArity(function_name);
 
-        if (arity == -1) {
-            report << "dynamic dispatch call with undefined arity ";
-            if (frame_parameters_count >= 0) {
-                report << "as " << function_name << (arity == -1 ? "/" : "") << frame_parameters_count;
-            } else {
-                report << ": " << function_name;
+            if (arity == -1) {
+                report << "dynamic dispatch call with undefined arity ";
+                if (frame_parameters_count >= 0) {
+                    report << "as " << function_name << (arity == -1 ? "/" : "") << frame_parameters_count;
+                } else {
+                    report << ": " << function_name;
+                }
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (frame_parameters_count == -1) {
+                // frame paramters count could not be statically determined, deffer the check until runtime
+                return;
             }
-            throw ErrorReport(i, report.str());
-        }
-        if (frame_parameters_count == -1) {
-            // frame paramters count could not be statically determined, deffer the check until runtime
-            continue;
-        }
 
-        if (arity > 0 and arity != frame_parameters_count) {
-            report << "invalid number of parameters in dynamic dispatch of " << function_name << ": expected " << arity << " got " << frame_parameters_count;
-            throw ErrorReport(i, report.str());
-        }
+            if (arity > 0 and arity != frame_parameters_count) {
+                report << "invalid number of parameters in dynamic dispatch of " << function_name << ": expected " << arity << " got " << frame_parameters_count;
+                throw ErrorReport(instruction.line, report.str());
+            }
+        });
     }
 }
 
@@ -239,98 +358,99 @@ void assembler::verify::functionsEndWithReturn(const std::vector<std::string>& l
     }
 }
 
-void assembler::verify::frameBalance(const vector<string>& lines, const map<unsigned long, unsigned long>& expanded_lines_to_source_lines) {
-    ostringstream report("");
-    string line;
-    string instruction;
-
-    int balance = 0;
-    long unsigned previous_frame_spawnline = 0;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (line.size() == 0) { continue; }
-
-        line = str::lstrip(line);
-        instruction = str::chunk(line);
-        if (not (instruction == "call" or instruction == "tailcall" or instruction == "process" or instruction == "watchdog" or instruction == "fcall" or instruction == "frame" or instruction == "msg" or instruction == "return")) {
-            continue;
-        }
+void assembler::verify::frameBalance(const vector<graph_t>& graphs, const map<unsigned long, unsigned long>& expanded_lines_to_source_lines) {
+    for (const auto& graph : graphs) {
+        walk(graph, frame_t(true), spawnFrames, [&expanded_lines_to_source_lines](const instruction_t& instruction, const frame_t& frame) {
+            const string& instr = instruction.opcode;
+            if (not (frame.known and (consumesFrame(instr) or instr == "frame" or instr == "return"))) {
+                return;
+            }
 
-        if (instruction == "call" or instruction == "tailcall" or instruction == "process" or instruction == "fcall" or instruction == "msg" or instruction == "watchdog") {
-            --balance;
-        }
-        if (instruction == "frame") {
-            ++balance;
-        }
+            ostringstream report("");
+            if (consumesFrame(instr) and not frame.spawned) {
+                report << "call with '" << instr << "' without a frame";
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (instr == "frame" and frame.spawned) {
+                report << "excess frame spawned (unused frame spawned at line ";
+                report << (expanded_lines_to_source_lines.at(frame.line)+1) << ')';
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (instr == "return" and frame.spawned) {
+                report << "leftover frame (spawned at line " << (expanded_lines_to_source_lines.at(frame.line)+1) << ')';
+                throw ErrorReport(instruction.line, report.str());
+            }
+        });
+    }
+}
 
-        if (balance < 0) {
-            report << "call with '" << instruction << "' without a frame";
-            throw ErrorReport(i, report.str());
-        }
-        if (balance > 1) {
-            report << "excess frame spawned (unused frame spawned at line ";
-            report << (expanded_lines_to_source_lines.at(previous_frame_spawnline)+1) << ')';
-            throw ErrorReport(i, report.str());
-        }
-        if (instruction == "return" and balance > 0) {
-            report << "leftover frame (spawned at line " << (expanded_lines_to_source_lines.at(previous_frame_spawnline)+1) << ')';
-            throw ErrorReport(i, report.str());
-        }
+void assembler::verify::tryFrameBalance(const vector<graph_t>& graphs, const map<unsigned long, unsigned long>& expanded_lines_to_source_lines) {
+    for (const auto& graph : graphs) {
+        walk(graph, try_frame_t(true), spawnTryFrames, [&expanded_lines_to_source_lines](const instruction_t& instruction, const try_frame_t& frame) {
+            const string& instr = instruction.opcode;
+            if (not (frame.known and (instr == "catch" or instr == "enter" or instr == "try" or instr == "return" or instr == "leave"))) {
+                return;
+            }
 
-        if (instruction == "frame") {
-            previous_frame_spawnline = i;
-        }
+            ostringstream report("");
+            if ((instr == "catch" or instr == "enter") and not frame.pending) {
+                report << "use of '" << instr << "' without a try frame";
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (instr == "try" and frame.pending) {
+                report << "excess try frame (unused try frame created at line ";
+                report << (expanded_lines_to_source_lines.at(frame.line)+1) << ')';
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if ((instr == "return" or instr == "leave") and frame.pending) {
+                report << "leftover try frame (created at line " << (expanded_lines_to_source_lines.at(frame.line)+1) << ')';
+                throw ErrorReport(instruction.line, report.str());
+            }
+        });
     }
 }
 
-void assembler::verify::blockTries(const vector<string>& lines, const vector<string>& block_names, const vector<string>& block_signatures) {
+void assembler::verify::blockTries(const vector<graph_t>& graphs, const vector<string>& block_names, const vector<string>& block_signatures) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswithchunk(line, "enter")) {
-            continue;
-        }
 
-        string block = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
-        bool is_undefined = (find(block_names.begin(), block_names.end(), block) == block_names.end());
-        // if block is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(block_signatures.begin(), block_signatures.end(), block) == block_signatures.end());
-        }
+    // a block is defined if its body or its signature is known
+    set<string> defined_blocks(block_names.begin(), block_names.end());
+    defined_blocks.insert(block_signatures.begin(), block_signatures.end());
 
-        if (is_undefined) {
-            report << "cannot enter undefined block: " << block;
-            throw ErrorReport(i, report.str());
+    for (const auto& graph : graphs) {
+        for (const auto& instruction : graph.instructions) {
+            if (instruction.opcode != "enter") {
+                continue;
+            }
+
+            string block = (instruction.operands.empty() ? "" : instruction.operands[0]);
+            if (defined_blocks.count(block) == 0) {
+                report << "cannot enter undefined block: " << block;
+                throw ErrorReport(instruction.line, report.str());
+            }
         }
     }
 }
 
-void assembler::verify::blockCatches(const vector<string>& lines, const vector<string>& block_names, const vector<string>& block_signatures) {
+void assembler::verify::blockCatches(const vector<graph_t>& graphs, const vector<string>& block_names, const vector<string>& block_signatures) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswithchunk(line, "catch")) {
-            continue;
-        }
-
-        // remove instruction
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
 
-        // remove name of caught type
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
+    // a block is defined if its body or its signature is known
+    set<string> defined_blocks(block_names.begin(), block_names.end());
+    defined_blocks.insert(block_signatures.begin(), block_signatures.end());
 
-        string block = str::chunk(line);
-        bool is_undefined = (find(block_names.begin(), block_names.end(), block) == block_names.end());
-        // if block is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(block_signatures.begin(), block_signatures.end(), block) == block_signatures.end());
-        }
+    for (const auto& graph : graphs) {
+        for (const auto& instruction : graph.instructions) {
+            if (instruction.opcode != "catch") {
+                continue;
+            }
 
-        if (is_undefined) {
-            report << "cannot catch using undefined block: " << block;
-            throw ErrorReport(i, report.str());
+            // first operand is the name of caught type
+            string block = (instruction.operands.size() > 1 ? instruction.operands[1] : "");
+            if (defined_blocks.count(block) == 0) {
+                report << "cannot catch using undefined block: " << block;
+                throw ErrorReport(instruction.line, report.str());
+            }
         }
     }
 }
@@ -339,6 +459,11 @@ void assembler::verify::callableCreations(const vector<string>& lines, const vec
     ostringstream report("");
     string line;
     string callable_type;
+
+    // a function is defined if its body or its signature is known
+    set<string> defined_functions(function_names.begin(), function_names.end());
+    defined_functions.insert(function_signatures.begin(), function_signatures.end());
+
     for (unsigned i = 0; i < lines.size(); ++i) {
         line = str::lstrip(lines[i]);
         if (not str::startswith(line, "closure") and not str::startswith(line, "function")) {
@@ -352,20 +477,14 @@ void assembler::verify::callableCreations(const vector<string>& lines, const vec
         line = str::lstrip(str::sub(line, register_index.size()));
 
         string function = str::chunk(line);
-        bool is_undefined = (find(function_names.begin(), function_names.end(), function) == function_names.end());
-        // if function is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(function_signatures.begin(), function_signatures.end(), function) == function_signatures.end());
-        }
-
-        if (is_undefined) {
+        if (defined_functions.count(function) == 0) {
             report << callable_type << " from undefined function: " << function;
             throw ErrorReport(i, report.str());
         }
     }
 }
 
-void assembler::verify::ressInstructions(const vector<string>& lines, bool as_lib) {
+void assembler::verify::ressInstructions(const vector<graph_t>& graphs, bool as_lib) {
     ostringstream report("");
     vector<string> legal_register_sets = {
         "global",   // global register set
@@ -373,27 +492,26 @@ void assembler::verify::ressInstructions(const vector<string>& lines, bool as_li
         "static",   // static register set
         "temp",     // temporary register set
     };
-    string line;
     string function;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (assembler::utils::lines::is_function(line)) {
-            function = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
-            continue;
-        }
-        if (not str::startswith(line, "ress")) {
-            continue;
+    for (const auto& graph : graphs) {
+        if (not (graph.is_block or graph.name.empty())) {
+            function = graph.name;
         }
+        for (const auto& instruction : graph.instructions) {
+            if (instruction.opcode != "ress") {
+                continue;
+            }
 
-        string registerset_name = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
+            string registerset_name = (instruction.operands.empty() ? "" : instruction.operands[0]);
 
-        if (find(legal_register_sets.begin(), legal_register_sets.end(), registerset_name) == legal_register_sets.end()) {
-            report << "illegal register set name in ress instruction '" << registerset_name << "' in function " << function;
-            throw ErrorReport(i, report.str());
-        }
-        if (registerset_name == "global" and as_lib and function != "main/1") {
-            report << "global registers used in library function " << function;
-            throw ErrorReport(i, report.str());
+            if (find(legal_register_sets.begin(), legal_register_sets.end(), registerset_name) == legal_register_sets.end()) {
+                report << "illegal register set name in ress instruction '" << registerset_name << "' in function " << function;
+                throw ErrorReport(instruction.line, report.str());
+            }
+            if (registerset_name == "global" and as_lib and function != "main/1") {
+                report << "global registers used in library function " << function;
+                throw ErrorReport(instruction.line, report.str());
+            }
         }
     }
 }
@@ -483,124 +601,77 @@ void assembler::verify::directives(const vector<string>& lines) {
         }
     }
 }
-void assembler::verify::instructions(const vector<string>& lines) {
+void assembler::verify::instructions(const vector<graph_t>& graphs) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (line.size() == 0 or line[0] == '.' or line[0] == ';' or str::startswith(line, "--")) {
-            continue;
-        }
-
-        string token = str::chunk(line);
-        if (OP_SIZES.count(token) == 0) {
-            report << "unknown instruction: '" << token << "'";
-            throw ErrorReport(i, report.str());
+    for (const auto& graph : graphs) {
+        for (const auto& instruction : graph.instructions) {
+            if (OP_SIZES.count(instruction.opcode) == 0) {
+                report << "unknown instruction: '" << instruction.opcode << "'";
+                throw ErrorReport(instruction.line, report.str());
+            }
         }
     }
 }
 
-void assembler::verify::framesHaveOperands(const vector<string>& lines) {
+void assembler::verify::framesHaveOperands(const vector<graph_t>& graphs) {
     ostringstream report("");
-    string line;
-
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-
-        if (not str::startswith(line, "frame")) {
-            continue;
-        }
-
-        // remove leading instruction name and
-        // strip the remaining string of leading whitespace
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-
-        if (line.size() == 0) {
-            report << "frame instruction without operands";
-            throw ErrorReport(i, report.str());
+    for (const auto& graph : graphs) {
+        for (const auto& instruction : graph.instructions) {
+            if (instruction.opcode == "frame" and instruction.operands.empty()) {
+                report << "frame instruction without operands";
+                throw ErrorReport(instruction.line, report.str());
+            }
         }
     }
 }
 
-void assembler::verify::framesHaveNoGaps(const vector<string>& lines, const map<unsigned long, unsigned long>& expanded_lines_to_source_lines) {
-    ostringstream report("");
-    string line;
-    unsigned long frame_parameters_count = 0;
-    bool detected_frame_parameters_count = false;
-    unsigned last_frame = 0;
-
-    vector<bool> filled_slots;
-    vector<unsigned> pass_lines;
-
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not (str::startswith(line, "call") or str::startswith(line, "process") or str::startswith(line, "watchdog") or str::startswith(line, "frame") or str::startswith(line, "param") or str::startswith(line, "pamv"))) {
-            continue;
-        }
-
-        string instr_name = str::chunk(line);
-        line = str::lstrip(line.substr(instr_name.size()));
-
-        if (instr_name == "frame") {
-            last_frame = i;
-
-            line = str::chunk(line);
-            if (str::isnum(line)) {
-                frame_parameters_count = stoul(str::chunk(line));
-                filled_slots.clear();
-                pass_lines.clear();
-                filled_slots.resize(frame_parameters_count, false);
-                pass_lines.resize(frame_parameters_count);
-                detected_frame_parameters_count = true;
-            } else {
-                detected_frame_parameters_count = false;
+void assembler::verify::framesHaveNoGaps(const vector<graph_t>& graphs, const map<unsigned long, unsigned long>& expanded_lines_to_source_lines) {
+    for (const auto& graph : graphs) {
+        walk(graph, frame_t(true), spawnFrames, [&expanded_lines_to_source_lines](const instruction_t& instruction, const frame_t& frame) {
+            const string& instr = instruction.opcode;
+            if (not (instr == "param" or instr == "pamv" or instr == "call" or instr == "process" or instr == "watchdog")) {
+                return;
             }
-            continue;
-        }
-
-        if (instr_name == "param" or instr_name == "pamv") {
-            line = str::chunk(line);
-            unsigned long slot_index;
-            bool detected_slot_index = false;
-            if (str::isnum(line)) {
-                slot_index = stoul(line);
-                detected_slot_index = true;
+            if (not (frame.known and frame.spawned and frame.parameters >= 0)) {
+                // frame paramters count could not be statically determined, deffer the check until runtime
+                return;
             }
-            if (detected_slot_index and detected_frame_parameters_count and slot_index >= frame_parameters_count) {
-                report << "pass to parameter slot " << slot_index << " in frame with only " << frame_parameters_count << " slots available";
-                throw ErrorReport(i, report.str());
-            }
-            if (detected_slot_index and detected_frame_parameters_count) {
-                if (filled_slots[slot_index]) {
-                    report << "double pass to parameter slot " << slot_index << " in frame defined at line " << expanded_lines_to_source_lines.at(last_frame)+1;
-                    report << ", first pass at line " << expanded_lines_to_source_lines.at(pass_lines[slot_index])+1;
-                    throw ErrorReport(i, report.str());
+
+            ostringstream report("");
+
+            if ((instr == "param" or instr == "pamv") and not instruction.operands.empty() and isIndex(instruction.operands[0])) {
+                index_type slot_index = stoul(instruction.operands[0]);
+                if (slot_index >= frame.passes.size()) {
+                    report << "pass to parameter slot " << slot_index << " in frame with only " << frame.parameters << " slots available";
+                    throw ErrorReport(instruction.line, report.str());
+                }
+                if (frame.passes[slot_index]) {
+                    report << "double pass to parameter slot " << slot_index << " in frame defined at line " << expanded_lines_to_source_lines.at(frame.line)+1;
+                    report << ", first pass at line " << expanded_lines_to_source_lines.at(frame.passes[slot_index]-1)+1;
+                    throw ErrorReport(instruction.line, report.str());
                 }
-                filled_slots[slot_index] = true;
-                pass_lines[slot_index] = i;
             }
-            continue;
-        }
 
-        if (instr_name == "call" or instr_name == "process" or instr_name == "watchdog") {
-            for (decltype(frame_parameters_count) f = 0; f < frame_parameters_count; ++f) {
-                if (not filled_slots[f]) {
-                    report << "gap in frame defined at line " << expanded_lines_to_source_lines.at(last_frame)+1 << ", slot " << f << " left empty";
-                    throw ErrorReport(i, report.str());
+            if (instr == "call" or instr == "process" or instr == "watchdog") {
+                for (index_type f = 0; f < frame.passes.size(); ++f) {
+                    if (not frame.passes[f]) {
+                        report << "gap in frame defined at line " << expanded_lines_to_source_lines.at(frame.line)+1 << ", slot " << f << " left empty";
+                        throw ErrorReport(instruction.line, report.str());
+                    }
                 }
             }
-        }
+        });
     }
 }
 
-static void validate_jump(const unsigned lineno, const string& extracted_jump, const int function_instruction_counter, vector<pair<unsigned, int>>& forward_jumps, vector<pair<unsigned, string>>& deferred_marker_jumps, const map<string, int>& jump_targets) {
-    int target = -1;
-    if (str::isnum(extracted_jump)) {
-        target = stoi(extracted_jump);
-    } else if (str::startswith(extracted_jump, "+") and str::isnum(extracted_jump.substr(1))) {
-        target = (function_instruction_counter + stoi(extracted_jump.substr(1)));
+static void validate_jump(const index_type lineno, const string& extracted_jump, const int64_t instruction_index, vector<pair<index_type, int64_t>>& forward_jumps, vector<pair<index_type, string>>& deferred_marker_jumps) {
+    int64_t target = -1;
+    if (str::isnum(extracted_jump) and extracted_jump.size() < 18) {
+        target = stoll(extracted_jump);
+    } else if (str::startswith(extracted_jump, "+") and str::isnum(extracted_jump.substr(1)) and extracted_jump.size() < 18) {
+        target = (instruction_index + stoll(extracted_jump.substr(1)));
     } else if (str::startswith(extracted_jump, ".") and str::isnum(extracted_jump.substr(1))) {
-        if (stoi(extracted_jump.substr(1)) < 0) {
+        if (str::startswith(extracted_jump, ".-")) {
             throw ErrorReport(lineno, "absolute jump with negative value");
         }
         // absolute jumps cannot be verified without knowing how many bytes the bytecode spans
@@ -611,103 +682,291 @@ static void validate_jump(const unsigned lineno, const string& extracted_jump, c
         // this is a FIXME: add check for absolute jumps
         return;
     } else {
-        if (jump_targets.count(extracted_jump) == 0) {
-            deferred_marker_jumps.push_back({lineno, extracted_jump});
-            return;
-        } else {
-            target = jump_targets.at(extracted_jump);
-        }
+        deferred_marker_jumps.push_back({lineno, extracted_jump});
+        return;
     }
 
-    if (target < 0 and (function_instruction_counter+target) < 0) {
+    if (target < 0 and (instruction_index+target) < 0) {
         throw ErrorReport(lineno, "backward out-of-range jump");
     }
-    if (target > function_instruction_counter) {
+    if (target > instruction_index) {
         forward_jumps.push_back({lineno, target});
     }
 }
 
-static void verify_forward_jumps(const int function_instruction_counter, const vector<pair<unsigned, int>>& forward_jumps) {
+static void verify_forward_jumps(const int64_t last_instruction_index, const vector<pair<index_type, int64_t>>& forward_jumps) {
     for (auto jmp : forward_jumps) {
-        if (jmp.second > function_instruction_counter) {
+        if (jmp.second > last_instruction_index) {
             throw ErrorReport(jmp.first, "forward out-of-range jump");
         }
     }
 }
 
-static void verify_marker_jumps(const int function_instruction_counter, const vector<pair<unsigned, string>>& deferred_marker_jumps, const map<string, int>& jump_targets) {
+static void verify_marker_jumps(const int64_t last_instruction_index, const vector<pair<index_type, string>>& deferred_marker_jumps, const map<string, index_type>& jump_targets) {
     for (auto jmp : deferred_marker_jumps) {
         if (jump_targets.count(jmp.second) == 0) {
             throw ErrorReport(jmp.first, ("jump to unrecognised marker: " + jmp.second));
         }
-        if (jump_targets.at(jmp.second) > function_instruction_counter) {
+        if (static_cast<int64_t>(jump_targets.at(jmp.second)) > last_instruction_index) {
             throw ErrorReport(jmp.first, "marker out-of-range jump");
         }
     }
 }
 
-void assembler::verify::jumpsAreInRange(const vector<string>& lines) {
-    ostringstream report("");
-    string line;
+void assembler::verify::jumpsAreInRange(const vector<graph_t>& graphs) {
+    for (const auto& graph : graphs) {
+        if (graph.name.empty()) {
+            // code outside of functions and blocks is not verified
+            continue;
+        }
 
-    map<string, int> jump_targets;
-    vector<pair<unsigned, int>> forward_jumps;
-    vector<pair<unsigned, string>> deferred_marker_jumps;
-    int function_instruction_counter = 0;
-    string function_name;
+        vector<pair<index_type, int64_t>> forward_jumps;
+        vector<pair<index_type, string>> deferred_marker_jumps;
 
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
+        for (index_type i = 0; i < graph.instructions.size(); ++i) {
+            const auto& instruction = graph.instructions[i];
+            const auto& operands = instruction.operands;
+            int64_t instruction_index = static_cast<int64_t>(i);
 
-        if (line.size() == 0) {
-            continue;
+            if (instruction.opcode == "jump") {
+                validate_jump(instruction.line, (operands.empty() ? "" : operands[0]), instruction_index, forward_jumps, deferred_marker_jumps);
+            } else if (instruction.opcode == "branch") {
+                if (operands.size() < 2) {
+                    throw ErrorReport(instruction.line, "branch without a target");
+                }
+
+                validate_jump(instruction.line, operands[1], instruction_index, forward_jumps, deferred_marker_jumps);
+                if (operands.size() > 2) {
+                    validate_jump(instruction.line, operands[2], instruction_index, forward_jumps, deferred_marker_jumps);
+                }
+            }
+        }
+
+        int64_t last_instruction_index = (static_cast<int64_t>(graph.instructions.size()) - 1);
+        verify_forward_jumps(last_instruction_index, forward_jumps);
+        verify_marker_jumps(last_instruction_index, deferred_marker_jumps, graph.marks);
+    }
+}
+
+
+/*  Reads from empty registers are detected only for instructions whose operands are well understood.
+ *  Every other instruction is assumed to write its first operand so that no empty register is reported
+ *  when it may have been written, and
+ *  instructions writing registers in ways that are not visible in the source (entering blocks, and
+ *  indirect operands) are assumed to write all of them.
+ *
+ *  Functions whose registers may be filled before they start are not checked: closures, functions that
+ *  are tail-called (they reuse register set of the caller), and functions switching register sets.
+ *  Blocks are not checked either because they run in the frame of the function that entered them.
+ */
+namespace {
+    const set<string> BINARY_OPERATORS = {
+        "iadd", "isub", "imul", "idiv", "ilt", "ilte", "igt", "igte", "ieq",
+        "fadd", "fsub", "fmul", "fdiv", "flt", "flte", "fgt", "fgte", "feq",
+    };
+
+    // instructions that do not write registers given as their first operands (or that empty them)
+    const set<string> NOT_WRITING = {
+        "nop", "frame", "param", "pamv", "jump", "branch", "throw", "catch", "try", "enter", "leave",
+        "print", "echo", "import", "link", "tailcall", "watchdog", "return", "halt", "ress",
+        "delete", "empty", "tmpri",
+    };
+
+    struct registers_t {
+        // true if all registers may have been written
+        bool all;
+        vector<bool> written;
+
+        bool operator==(const registers_t& that) const {
+            return (all == that.all and (all or written == that.written));
+        }
+
+        registers_t(): all(true) {}
+        registers_t(index_type size): all(false), written(size, false) {}
+    };
+
+    void meet(registers_t& registers, const registers_t& that) {
+        if (that.all) {
+            return;
         }
-        if (function_name.size() > 0 and not str::startswith(line, ".")) {
-            ++function_instruction_counter;
+        if (registers.all) {
+            registers = that;
+            return;
         }
-        if (not (str::startswith(line, ".function:") or str::startswith(line, ".block:") or str::startswith(line, "jump") or str::startswith(line, "branch") or str::startswith(line, ".mark:") or str::startswith(line, ".end"))) {
-            continue;
+        for (index_type i = 0; i < registers.written.size(); ++i) {
+            registers.written[i] = (registers.written[i] and that.written[i]);
         }
+    }
 
-        string first_part = str::chunk(line);
-        line = str::lstrip(line.substr(first_part.size()));
+    bool isIndirect(const string& operand) {
+        return (not operand.empty() and (operand[0] == '@' or operand[0] == '*'));
+    }
 
-        string second_part = str::chunk(line);
-        line = str::lstrip(line.substr(second_part.size()));
+    bool registerIndex(const graph_t& graph, const string& operand, index_type& index) {
+        const string& spelled = (graph.names.count(operand) ? graph.names.at(operand) : operand);
+        if (not isIndex(spelled)) {
+            return false;
+        }
+        index = stoul(spelled);
+        return true;
+    }
 
-        if (first_part == ".function:" or first_part == ".block:") {
-            function_instruction_counter = -1;
-            jump_targets.clear();
-            forward_jumps.clear();
-            deferred_marker_jumps.clear();
-            function_name = second_part;
-            continue;
-        } else if (first_part == "jump") {
-            validate_jump(i, second_part, function_instruction_counter, forward_jumps, deferred_marker_jumps, jump_targets);
-        } else if (first_part == "branch") {
-            if (line.size() == 0) {
-                throw ErrorReport(i, "branch without a target");
-            }
+    vector<index_type> readOperands(const instruction_t& instruction) {
+        /** Returns which operands of an instruction are registers it reads.
+         */
+        const auto& op = instruction.opcode;
+        const auto size = instruction.operands.size();
+        if (BINARY_OPERATORS.count(op) and size == 3) {
+            return { 1, 2 };
+        } else if ((op == "copy" or op == "move" or op == "param" or op == "pamv") and size == 2) {
+            return { 1 };
+        } else if ((op == "iinc" or op == "idec" or op == "print" or op == "echo" or op == "branch" or op == "throw") and size > 0) {
+            return { 0 };
+        }
+        return {};
+    }
+
+    vector<index_type> emptiedOperands(const instruction_t& instruction) {
+        /** Returns which operands of an instruction are registers it leaves empty.
+         */
+        const auto& op = instruction.opcode;
+        const auto size = instruction.operands.size();
+        if ((op == "move" or op == "pamv") and size == 2) {
+            return { 1 };
+        } else if ((op == "throw" or op == "delete" or op == "empty" or op == "tmpri") and size > 0) {
+            return { 0 };
+        }
+        return {};
+    }
 
-            string when_true = str::chunk(line);
-            line = str::lstrip(line.substr(when_true.size()));
+    void writeRegisters(const graph_t& graph, const instruction_t& instruction, const index_type count, registers_t& registers) {
+        const auto& op = instruction.opcode;
+        const auto& operands = instruction.operands;
+        index_type index = 0;
 
-            string when_false = str::chunk(line);
+        if (op == "enter") {
+            registers = registers_t();
+            return;
+        }
+
+        for (auto each : emptiedOperands(instruction)) {
+            if (not registerIndex(graph, operands[each], index)) {
+                continue;
+            }
+            if (registers.all) {
+                registers = registers_t(count);
+                registers.written.assign(count, true);
+            }
+            registers.written[index] = false;
+        }
 
-            if (when_true.size()) {
-                validate_jump(i, when_true, function_instruction_counter, forward_jumps, deferred_marker_jumps, jump_targets);
+        vector<index_type> written;
+        if (op == "swap") {
+            written = { 0, 1 };
+        } else if (NOT_WRITING.count(op) == 0) {
+            written = { 0 };
+        }
+        for (auto each : written) {
+            if (each >= operands.size()) {
+                continue;
+            }
+            if (isIndirect(operands[each])) {
+                registers = registers_t();
+            } else if (not registers.all and registerIndex(graph, operands[each], index)) {
+                registers.written[index] = true;
             }
+        }
+    }
 
-            if (when_false.size()) {
-                validate_jump(i, when_false, function_instruction_counter, forward_jumps, deferred_marker_jumps, jump_targets);
+    index_type countRegisters(const graph_t& graph) {
+        index_type count = 0;
+        index_type index = 0;
+        for (const auto& instruction : graph.instructions) {
+            for (const auto& each : instruction.operands) {
+                if (registerIndex(graph, each, index)) {
+                    count = max(count, (index+1));
+                }
             }
-        } else if (first_part == ".mark:") {
-            jump_targets[second_part] = function_instruction_counter;
+        }
+        return count;
+    }
+}
+
+vector<ErrorReport> assembler::verify::registersAreInitialised(const vector<graph_t>& graphs) {
+    /** Returns reports of reads from registers that may be empty.
+     *
+     *  Reading an empty register is not an error (it throws an exception at runtime) so reports are
+     *  returned instead of thrown and the caller decides whether they are warnings or errors.
+     */
+    vector<ErrorReport> reports;
+
+    set<string> unchecked;
+    for (const auto& graph : graphs) {
+        for (const auto& instruction : graph.instructions) {
+            if ((instruction.opcode == "closure" and instruction.operands.size() > 1) or (instruction.opcode == "tailcall" and not instruction.operands.empty())) {
+                unchecked.insert(instruction.operands.back());
+            } else if (instruction.opcode == "ress") {
+                unchecked.insert(graph.name);
+            }
+        }
+    }
+
+    for (const auto& graph : graphs) {
+        if (graph.is_block or graph.name.empty() or unchecked.count(graph.name) or not graph.complete or graph.nodes.empty()) {
             continue;
-        } else if (first_part == ".end") {
-            function_name = "";
-            verify_forward_jumps(function_instruction_counter, forward_jumps);
-            verify_marker_jumps(function_instruction_counter, deferred_marker_jumps, jump_targets);
+        }
+
+        const index_type count = countRegisters(graph);
+
+        // registers written before a node are the ones written on all paths leading to it
+        vector<registers_t> states(graph.nodes.size());
+        vector<bool> reached(graph.nodes.size(), false);
+        states[0] = registers_t(count);
+        reached[0] = true;
+        vector<index_type> pending = { 0 };
+        while (not pending.empty()) {
+            index_type n = pending.back();
+            pending.pop_back();
+
+            registers_t registers = states[n];
+            for (index_type i = graph.nodes[n].begin; i < graph.nodes[n].end; ++i) {
+                writeRegisters(graph, graph.instructions[i], count, registers);
+            }
+            for (auto each : graph.nodes[n].successors) {
+                registers_t met = states[each];
+                meet(met, registers);
+                if (not reached[each] or not (met == states[each])) {
+                    reached[each] = true;
+                    states[each] = met;
+                    pending.push_back(each);
+                }
+            }
+        }
+
+        set<index_type> reported;
+        for (index_type n = 0; n < graph.nodes.size(); ++n) {
+            if (not reached[n]) {
+                continue;
+            }
+            registers_t registers = states[n];
+            for (index_type i = graph.nodes[n].begin; i < graph.nodes[n].end; ++i) {
+                const auto& instruction = graph.instructions[i];
+                index_type index = 0;
+                for (auto each : readOperands(instruction)) {
+                    if (registers.all or not registerIndex(graph, instruction.operands[each], index)) {
+                        continue;
+                    }
+                    if (not registers.written[index] and reported.count(index) == 0) {
+                        ostringstream report;
+                        report << "register " << index << " may be empty when read";
+                        reports.emplace_back(instruction.line, report.str());
+                        reported.insert(index);
+                    }
+                }
+                writeRegisters(graph, instruction, count, registers);
+            }
         }
     }
+
+    return reports;
 }
@@ -78,6 +78,19 @@ static byte* insertString(byte* ptr, const string& s) {
     return ptr;
 }
 
+static byte* insertSymbol(byte* ptr, uint32_t symbol) {
+    /** Insert reference to an entry in module's symbol table.
+     *
+     *  Names of functions and blocks are not embedded in the bytecode but stored once in symbol table, and
+     *  instructions refer to them by index.
+     */
+    *(reinterpret_cast<OperandType*>(ptr)) = OT_SYMBOL;
+    pointer::inc<OperandType, byte>(ptr);
+    *(reinterpret_cast<uint32_t*>(ptr)) = symbol;
+    pointer::inc<uint32_t, byte>(ptr);
+    return ptr;
+}
+
 namespace cg {
     namespace bytecode {
         byte* opnop(byte* addr_ptr) {
@@ -664,21 +677,21 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* opclosure(byte* addr_ptr, int_op reg, const string& fn) {
+        byte* opclosure(byte* addr_ptr, int_op reg, uint32_t fn) {
             /*  Inserts closure instuction.
              */
             *(addr_ptr++) = CLOSURE;
             addr_ptr = insertIntegerOperand(addr_ptr, reg);
-            addr_ptr = insertString(addr_ptr, fn);
+            addr_ptr = insertSymbol(addr_ptr, fn);
             return addr_ptr;
         }
 
-        byte* opfunction(byte* addr_ptr, int_op reg, const string& fn) {
+        byte* opfunction(byte* addr_ptr, int_op reg, uint32_t fn) {
             /*  Inserts function instuction.
              */
             *(addr_ptr++) = FUNCTION;
             addr_ptr = insertIntegerOperand(addr_ptr, reg);
-            addr_ptr = insertString(addr_ptr, fn);
+            addr_ptr = insertSymbol(addr_ptr, fn);
             return addr_ptr;
         }
 
@@ -744,29 +757,29 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* opcall(byte* addr_ptr, int_op reg, const string& fn_name) {
+        byte* opcall(byte* addr_ptr, int_op reg, uint32_t fn_name) {
             /*  Inserts call instruction.
              *  Byte offset is calculated automatically.
              */
             *(addr_ptr++) = CALL;
             addr_ptr = insertIntegerOperand(addr_ptr, reg);
-            addr_ptr = insertString(addr_ptr, fn_name);
+            addr_ptr = insertSymbol(addr_ptr, fn_name);
             return addr_ptr;
         }
 
-        byte* optailcall(byte* addr_ptr, const string& fn_name) {
+        byte* optailcall(byte* addr_ptr, uint32_t fn_name) {
             /*  Inserts tailcall instruction.
              *  Byte offset is calculated automatically.
              */
             *(addr_ptr++) = TAILCALL;
-            addr_ptr = insertString(addr_ptr, fn_name);
+            addr_ptr = insertSymbol(addr_ptr, fn_name);
             return addr_ptr;
         }
 
-        byte* opprocess(byte* addr_ptr, int_op reg, const string& fn_name) {
+        byte* opprocess(byte* addr_ptr, int_op reg, uint32_t fn_name) {
             *(addr_ptr++) = PROCESS;
             addr_ptr = insertIntegerOperand(addr_ptr, reg);
-            addr_ptr = insertString(addr_ptr, fn_name);
+            addr_ptr = insertSymbol(addr_ptr, fn_name);
             return addr_ptr;
         }
 
@@ -783,9 +796,9 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* opwatchdog(byte* addr_ptr, const string& fn_name) {
+        byte* opwatchdog(byte* addr_ptr, uint32_t fn_name) {
             *(addr_ptr++) = WATCHDOG;
-            addr_ptr = insertString(addr_ptr, fn_name);
+            addr_ptr = insertSymbol(addr_ptr, fn_name);
             return addr_ptr;
         }
 
@@ -831,7 +844,7 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* opcatch(byte* addr_ptr, const string& type_name, const string& block_name) {
+        byte* opcatch(byte* addr_ptr, const string& type_name, uint32_t block_name) {
             /*  Inserts catch instruction.
              */
             *(addr_ptr++) = CATCH;
@@ -840,7 +853,7 @@ namespace cg {
             addr_ptr = insertString(addr_ptr, type_name.substr(1, type_name.size()-2));
 
             // catcher block name
-            addr_ptr = insertString(addr_ptr, block_name);
+            addr_ptr = insertSymbol(addr_ptr, block_name);
 
             return addr_ptr;
         }
@@ -853,12 +866,12 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* openter(byte* addr_ptr, const string& block_name) {
+        byte* openter(byte* addr_ptr, uint32_t block_name) {
             /*  Inserts enter instruction.
              *  Byte offset is calculated automatically.
              */
             *(addr_ptr++) = ENTER;
-            addr_ptr = insertString(addr_ptr, block_name);
+            addr_ptr = insertSymbol(addr_ptr, block_name);
             return addr_ptr;
         }
 
@@ -938,12 +951,12 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* opmsg(byte* addr_ptr, int_op reg, const string& method_name) {
+        byte* opmsg(byte* addr_ptr, int_op reg, uint32_t method_name) {
             /*  Inserts msg instuction.
              */
             *(addr_ptr++) = MSG;
             addr_ptr = insertIntegerOperand(addr_ptr, reg);
-            addr_ptr = insertString(addr_ptr, method_name);
+            addr_ptr = insertSymbol(addr_ptr, method_name);
             return addr_ptr;
         }
 
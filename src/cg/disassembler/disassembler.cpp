@@ -20,6 +20,7 @@
 #include <sstream>
 #include <viua/bytecode/opcodes.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/operand_types.h>
 #include <viua/support/string.h>
 #include <viua/support/pointer.h>
 #include <viua/cg/disassembler/disassembler.h>
@@ -37,7 +38,31 @@ string disassembler::intop(byte* ptr) {
     return oss.str();
 }
 
-tuple<string, unsigned> disassembler::instruction(byte* ptr) {
+string disassembler::symbolop(byte*& ptr, const vector<string>* symbols) {
+    /** Decode name operand of call-like instructions, and advance the pointer past it.
+     *
+     *  Modules compiled to format revision 2 or later refer to names by their index in symbol table,
+     *  while older modules embed null-terminated names directly in the bytecode.
+     */
+    if (*reinterpret_cast<OperandType*>(ptr) != OT_SYMBOL) {
+        string s = string(reinterpret_cast<char*>(ptr));
+        ptr += s.size();
+        ++ptr; // for null character terminating the C-style string not included in std::string
+        return s;
+    }
+    pointer::inc<OperandType, byte>(ptr);
+    uint32_t index = *reinterpret_cast<uint32_t*>(ptr);
+    pointer::inc<uint32_t, byte>(ptr);
+
+    if (symbols == nullptr or index >= symbols->size()) {
+        ostringstream oss;
+        oss << "<symbol:" << index << ">";
+        return oss.str();
+    }
+    return symbols->at(index);
+}
+
+tuple<string, unsigned> disassembler::instruction(byte* ptr, const vector<string>* symbols) {
     byte* bptr = ptr;
 
     OPCODE op = OPCODE(*bptr);
@@ -68,7 +93,13 @@ tuple<string, unsigned> disassembler::instruction(byte* ptr) {
         oss << " " << str::enquote(s);
         bptr += s.size();
         ++bptr; // for null character terminating the C-style string not included in std::string
-    } else if ((op == CALL) or (op == PROCESS) or (op == CLOSURE) or (op == FUNCTION) or (op == CLASS) or (op == NEW) or (op == DERIVE) or (op == MSG)) {
+    } else if ((op == CALL) or (op == PROCESS) or (op == CLOSURE) or (op == FUNCTION) or (op == MSG)) {
+        oss << " " << intop(bptr);
+        pointer::inc<bool, byte>(bptr);
+        pointer::inc<int, byte>(bptr);
+
+        oss << " " << symbolop(bptr, symbols);
+    } else if ((op == CLASS) or (op == NEW) or (op == DERIVE)) {
         oss << " " << intop(bptr);
         pointer::inc<bool, byte>(bptr);
         pointer::inc<int, byte>(bptr);
@@ -78,7 +109,9 @@ tuple<string, unsigned> disassembler::instruction(byte* ptr) {
         oss << fn_name;
         bptr += fn_name.size();
         ++bptr; // for null character terminating the C-style string not included in std::string
-    } else if ((op == IMPORT) or (op == ENTER) or (op == LINK) or (op == WATCHDOG) or (op == TAILCALL)) {
+    } else if ((op == ENTER) or (op == WATCHDOG) or (op == TAILCALL)) {
+        oss << " " << symbolop(bptr, symbols);
+    } else if ((op == IMPORT) or (op == LINK)) {
         oss << " ";
         string s = string(reinterpret_cast<char*>(bptr));
         oss << (op == IMPORT ? str::enquote(s) : s);
@@ -93,11 +126,7 @@ tuple<string, unsigned> disassembler::instruction(byte* ptr) {
         bptr += s.size();
         ++bptr; // for null character terminating the C-style string not included in std::string
 
-        oss << " ";
-        s = string(reinterpret_cast<char*>(bptr));
-        oss << s;
-        bptr += s.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
+        oss << " " << symbolop(bptr, symbols);
     } else if (op == ATTACH) {
         oss << " " << intop(bptr);
         pointer::inc<bool, byte>(bptr);
@@ -17,51 +17,51 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <sstream>
+#include <string>
+#include <vector>
 #include <viua/support/string.h>
 #include <viua/cg/tokenizer.h>
 using namespace std;
 
 vector<string> tokenize(const string& s) {
     vector<string> tokens;
-    ostringstream token;
-    token.str("");
+    string token;
     for (long unsigned i = 0; i < s.size(); ++i) {
-        if (s[i] == ' ' and token.str().size()) {
-            tokens.push_back(token.str());
-            token.str("");
+        if (s[i] == ' ' and token.size()) {
+            tokens.push_back(token);
+            token.clear();
             continue;
         }
         if (s[i] == ' ') {
             continue;
         }
         if (s[i] == '^') {
-            if (token.str().size()) {
-                tokens.push_back(token.str());
-                token.str("");
+            if (token.size()) {
+                tokens.push_back(token);
+                token.clear();
             }
             tokens.push_back("^");
         }
         if (s[i] == '(' or s[i] == ')') {
-            if (token.str().size()) {
-                tokens.push_back(token.str());
-                token.str("");
+            if (token.size()) {
+                tokens.push_back(token);
+                token.clear();
             }
             tokens.push_back((s[i] == '(' ? "(" : ")"));
             continue;
         }
         if (s[i] == '[' or s[i] == ']') {
-            if (token.str().size()) {
-                tokens.push_back(token.str());
-                token.str("");
+            if (token.size()) {
+                tokens.push_back(token);
+                token.clear();
             }
             tokens.push_back((s[i] == '[' ? "[" : "]"));
             continue;
         }
         if (s[i] == '{' or s[i] == '}') {
-            if (token.str().size()) {
-                tokens.push_back(token.str());
-                token.str("");
+            if (token.size()) {
+                tokens.push_back(token);
+                token.clear();
             }
             tokens.push_back((s[i] == '{' ? "{" : "}"));
             continue;
@@ -72,10 +72,10 @@ vector<string> tokenize(const string& s) {
             tokens.push_back(ss);
             continue;
         }
-        token << s[i];
+        token += s[i];
     }
-    if (token.str().size()) {
-        tokens.push_back(token.str());
+    if (token.size()) {
+        tokens.push_back(token);
     }
     return tokens;
 }
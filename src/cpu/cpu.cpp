@@ -44,6 +44,7 @@
 #include <viua/include/module.h>
 #include <viua/cpu/cpu.h>
 #include <viua/scheduler/vps.h>
+#include <viua/scheduler/tracer.h>
 using namespace std;
 
 
@@ -59,7 +60,19 @@ CPU& CPU::load(byte* bc) {
      *
      *  bc:char*    - pointer to byte array containing bytecode with a program to run
      */
-    if (bytecode) { delete[] bytecode; }
+    if (bytecode and not bytecode_image) { delete[] bytecode; }
+    bytecode_image.reset();
+    bytecode = bc;
+    return (*this);
+}
+
+CPU& CPU::load(shared_ptr<MappedModule> image, byte* bc) {
+    /*  Load bytecode that is executed in place from a mapped module image.
+     *  CPU keeps the image alive (and the bytecode pointer valid) until different bytecode is loaded
+     *  or the CPU is destroyed.
+     */
+    load(nullptr);
+    bytecode_image = image;
     bytecode = bc;
     return (*this);
 }
@@ -72,6 +85,22 @@ CPU& CPU::bytes(uint64_t sz) {
     return (*this);
 }
 
+CPU& CPU::symbols(const vector<string>& names) {
+    /** Set symbol table of loaded bytecode.
+     *  Executables produced by older assemblers have no symbol table.
+     */
+    executable_symbols = names;
+    return (*this);
+}
+
+CPU& CPU::prepared(const vector<viua::cpu::PreparedSymbol>& entries) {
+    /** Set entry points of symbols of loaded bytecode that were resolved ahead of time.
+     *  Symbols that were not resolved ahead of time are resolved as usual.
+     */
+    executable_prepared_symbols = entries;
+    return (*this);
+}
+
 CPU& CPU::mapfunction(const string& name, uint64_t address) {
     /** Maps function name to bytecode address.
      */
@@ -86,6 +115,22 @@ CPU& CPU::mapblock(const string& name, uint64_t address) {
     return (*this);
 }
 
+CPU& CPU::addresses(AddressTable functions, AddressTable blocks, AddressTable register_counts) {
+    /** Set function and block address tables, and register count table of loaded bytecode.
+     */
+    executable_functions = functions;
+    executable_blocks = blocks;
+    executable_register_counts = register_counts;
+    return (*this);
+}
+
+CPU& CPU::lines(shared_ptr<LineTable> table) {
+    /** Set table mapping loaded bytecode to source lines.
+     */
+    executable_lines = table;
+    return (*this);
+}
+
 CPU& CPU::registerExternalFunction(const string& name, ForeignFunction* function_ptr) {
     /** Registers external function in CPU.
      */
@@ -94,6 +139,42 @@ CPU& CPU::registerExternalFunction(const string& name, ForeignFunction* function
     return (*this);
 }
 
+CPU& CPU::registerAsyncExternalFunction(const string& name, AsyncForeignFunction* function_ptr) {
+    /** Registers asynchronous external function in CPU.
+     */
+    unique_lock<mutex> lock(foreign_functions_mutex);
+    async_foreign_functions[name] = function_ptr;
+    return (*this);
+}
+
+CPU& CPU::registerNonblockingExternalFunction(const string& name, ForeignFunction* function_ptr) {
+    /** Registers external function that may be called directly on scheduler threads.
+     */
+    unique_lock<mutex> lock(foreign_functions_mutex);
+    nonblocking_foreign_functions[name] = function_ptr;
+    return (*this);
+}
+
+CPU& CPU::registerTypedExternalFunction(const TypedForeignFunctionSpec& spec) {
+    /** Registers typed external function in CPU.
+     *
+     *  Number of declared parameters must match arity encoded in the name of the function.
+     */
+    string name = spec.name;
+    unsigned declared = 0;
+    while (declared < MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS and spec.parameters[declared] != FOREIGN_VOID) {
+        ++declared;
+    }
+    auto slash = name.rfind('/');
+    if (slash == string::npos or name.substr(slash+1) != to_string(declared)) {
+        throw new Exception("LinkException", ("typed foreign function declares " + to_string(declared) + " parameter(s): " + name));
+    }
+
+    unique_lock<mutex> lock(foreign_functions_mutex);
+    typed_foreign_functions[name] = spec;
+    return (*this);
+}
+
 CPU& CPU::registerForeignPrototype(const string& name, Prototype* proto) {
     /** Registers foreign prototype in CPU.
      */
@@ -101,13 +182,32 @@ CPU& CPU::registerForeignPrototype(const string& name, Prototype* proto) {
     return (*this);
 }
 
-CPU& CPU::registerForeignMethod(const string& name, ForeignMethod method) {
-    /** Registers foreign prototype in CPU.
+CPU& CPU::registerForeignMethod(const string& name, ForeignMethodMemberPointer method) {
+    /** Registers foreign method in CPU.
+     *
+     *  Re-registering a method replaces it in the table but keeps its id so
+     *  call sites that already resolved it stay valid.
+     *  Registering a new method starts a new link generation so
+     *  call sites that did not find it are resolved again.
      */
-    foreign_methods[name] = method;
+    auto found = foreign_method_ids.find(name);
+    if (found != foreign_method_ids.end()) {
+        foreign_method_table[static_cast<decltype(foreign_method_table)::size_type>(found->second)] = method;
+    } else {
+        foreign_method_ids[name] = static_cast<int>(foreign_method_table.size());
+        foreign_method_table.push_back(method);
+        ++link_generation;
+    }
     return (*this);
 }
 
+int CPU::foreignMethodId(const string& name) const {
+    /** Returns id of a foreign method, or -1 if no method with given name is registered.
+     */
+    auto found = foreign_method_ids.find(name);
+    return (found == foreign_method_ids.end() ? -1 : found->second);
+}
+
 
 void CPU::loadNativeLibrary(const string& module) {
     regex double_colon("::");
@@ -122,22 +222,11 @@ void CPU::loadNativeLibrary(const string& module) {
         Loader loader(path);
         loader.load();
 
-        byte* lnk_btcd = loader.getBytecode();
-        linked_modules[module] = pair<unsigned, byte*>(static_cast<unsigned>(loader.getBytecodeSize()), lnk_btcd);
+        byte* lnk_btcd = loader.getMappedBytecode();
+        linked_modules.emplace_back(module, loader.getImage(), lnk_btcd, loader.getBytecodeSize(), loader.getFunctionTable(), loader.getBlockTable(), loader.getRegisterCountTable(), loader.getLineTable());
+        ++link_generation;
 
-        vector<string> fn_names = loader.getFunctions();
-        map<string, uint64_t> fn_addrs = loader.getFunctionAddresses();
-        for (unsigned i = 0; i < fn_names.size(); ++i) {
-            string fn_linkname = fn_names[i];
-            linked_functions[fn_linkname] = pair<string, byte*>(module, (lnk_btcd+fn_addrs[fn_names[i]]));
-        }
-
-        vector<string> bl_names = loader.getBlocks();
-        map<string, uint64_t> bl_addrs = loader.getBlockAddresses();
-        for (unsigned i = 0; i < bl_names.size(); ++i) {
-            string bl_linkname = bl_names[i];
-            linked_blocks[bl_linkname] = pair<string, byte*>(module, (lnk_btcd+bl_addrs[bl_linkname]));
-        }
+        registerModuleSymbols(lnk_btcd, loader.getBytecodeSize(), loader.getSymbols());
     } else {
         throw new Exception("failed to link: " + module);
     }
@@ -167,10 +256,30 @@ void CPU::loadForeignLibrary(const string& module) {
 
     unsigned i = 0;
     while (exported[i].name != NULL) {
-        registerExternalFunction(exported[i].name, exported[i].fpointer);
+        if (exported[i].nonblocking) {
+            registerNonblockingExternalFunction(exported[i].name, exported[i].fpointer);
+        } else {
+            registerExternalFunction(exported[i].name, exported[i].fpointer);
+        }
         ++i;
     }
 
+    TypedForeignFunctionSpec* (*typed_exports)() = nullptr;
+    if ((typed_exports = reinterpret_cast<TypedForeignFunctionSpec*(*)()>(dlsym(handle, "typed_exports"))) != nullptr) {
+        TypedForeignFunctionSpec* typed_exported = (*typed_exports)();
+        for (i = 0; typed_exported[i].name != nullptr; ++i) {
+            registerTypedExternalFunction(typed_exported[i]);
+        }
+    }
+
+    AsyncForeignFunctionSpec* (*async_exports)() = nullptr;
+    if ((async_exports = reinterpret_cast<AsyncForeignFunctionSpec*(*)()>(dlsym(handle, "async_exports"))) != nullptr) {
+        AsyncForeignFunctionSpec* async_exported = (*async_exports)();
+        for (i = 0; async_exported[i].name != nullptr; ++i) {
+            registerAsyncExternalFunction(async_exported[i].name, async_exported[i].fpointer);
+        }
+    }
+
     cxx_dynamic_lib_handles.push_back(handle);
 }
 
@@ -215,50 +324,102 @@ vector<string> CPU::inheritanceChainOf(const string& type_name) const {
     return ichain;
 }
 
+bool CPU::findLocalFunction(const string& name, uint64_t& address) const {
+    auto mapped = function_addresses.find(name);
+    if (mapped != function_addresses.end()) {
+        address = mapped->second;
+        return true;
+    }
+    return executable_functions.find(name, address);
+}
+
+bool CPU::findLocalBlock(const string& name, uint64_t& address) const {
+    auto mapped = block_addresses.find(name);
+    if (mapped != block_addresses.end()) {
+        address = mapped->second;
+        return true;
+    }
+    return executable_blocks.find(name, address);
+}
+
 bool CPU::isLocalFunction(const string& name) const {
-    return function_addresses.count(name);
+    uint64_t address = 0;
+    return findLocalFunction(name, address);
 }
 
 bool CPU::isLinkedFunction(const string& name) const {
-    return linked_functions.count(name);
+    pair<byte*, byte*> entry_point;
+    return findLinkedFunction(name, entry_point);
 }
 
 bool CPU::isNativeFunction(const string& name) const {
-    return (function_addresses.count(name) or linked_functions.count(name));
+    return (isLocalFunction(name) or isLinkedFunction(name));
 }
 
 bool CPU::isForeignMethod(const string& name) const {
-    return foreign_methods.count(name);
+    return foreign_method_ids.count(name);
 }
 
 bool CPU::isForeignFunction(const string& name) const {
-    return foreign_functions.count(name);
+    return (foreign_functions.count(name) or nonblocking_foreign_functions.count(name) or typed_foreign_functions.count(name) or async_foreign_functions.count(name));
+}
+
+bool CPU::isTypedForeignFunction(const string& name) const {
+    return typed_foreign_functions.count(name);
+}
+
+bool CPU::isNonblockingForeignFunction(const string& name) const {
+    return nonblocking_foreign_functions.count(name);
 }
 
 bool CPU::isBlock(const string& name) const {
-    return (block_addresses.count(name) or linked_blocks.count(name));
+    return (isLocalBlock(name) or isLinkedBlock(name));
 }
 
 bool CPU::isLocalBlock(const string& name) const {
-    return block_addresses.count(name);
+    uint64_t address = 0;
+    return findLocalBlock(name, address);
 }
 
 bool CPU::isLinkedBlock(const string& name) const {
-    return linked_blocks.count(name);
+    pair<byte*, byte*> entry_point;
+    return findLinkedBlock(name, entry_point);
+}
+
+bool CPU::findLinkedFunction(const string& name, pair<byte*, byte*>& entry_point) const {
+    uint64_t name_hash = AddressTable::hash(name);
+    uint64_t address = 0;
+    for (auto module = linked_modules.rbegin(); module != linked_modules.rend(); ++module) {
+        if (module->functions.find(name, name_hash, address)) {
+            entry_point = pair<byte*, byte*>((module->bytecode + address), module->bytecode);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CPU::findLinkedBlock(const string& name, pair<byte*, byte*>& entry_point) const {
+    uint64_t name_hash = AddressTable::hash(name);
+    uint64_t address = 0;
+    for (auto module = linked_modules.rbegin(); module != linked_modules.rend(); ++module) {
+        if (module->blocks.find(name, name_hash, address)) {
+            entry_point = pair<byte*, byte*>((module->bytecode + address), module->bytecode);
+            return true;
+        }
+    }
+    return false;
 }
 
 pair<byte*, byte*> CPU::getEntryPointOfBlock(const std::string& name) const {
-    byte *entry_point = nullptr;
-    byte *module_base = nullptr;
-    if (block_addresses.count(name)) {
-        entry_point = (bytecode + block_addresses.at(name));
-        module_base = bytecode;
-    } else {
-        auto lf = linked_blocks.at(name);
-        entry_point = lf.second;
-        module_base = linked_modules.at(lf.first).second;
+    uint64_t address = 0;
+    if (findLocalBlock(name, address)) {
+        return pair<byte*, byte*>((bytecode + address), bytecode);
     }
-    return pair<byte*, byte*>(entry_point, module_base);
+    pair<byte*, byte*> entry_point;
+    if (not findLinkedBlock(name, entry_point)) {
+        throw out_of_range("no such block: " + name);
+    }
+    return entry_point;
 }
 
 string CPU::resolveMethodName(const string& klass, const string& method_name) const {
@@ -266,17 +427,154 @@ string CPU::resolveMethodName(const string& klass, const string& method_name) co
 }
 
 pair<byte*, byte*> CPU::getEntryPointOf(const std::string& name) const {
-    byte *entry_point = nullptr;
-    byte *module_base = nullptr;
-    if (function_addresses.count(name)) {
-        entry_point = (bytecode + function_addresses.at(name));
-        module_base = bytecode;
+    uint64_t address = 0;
+    if (findLocalFunction(name, address)) {
+        return pair<byte*, byte*>((bytecode + address), bytecode);
+    }
+    pair<byte*, byte*> entry_point;
+    if (not findLinkedFunction(name, entry_point)) {
+        throw out_of_range("no such function: " + name);
+    }
+    return entry_point;
+}
+
+viua::cpu::ModuleSymbols* CPU::moduleSymbolsAt(const byte* address) const {
+    /** Returns symbol table of the module containing given bytecode address.
+     */
+    for (const auto& each : module_symbols) {
+        if (each->contains(address)) {
+            return each.get();
+        }
+    }
+    return nullptr;
+}
+
+uint64_t CPU::linkGeneration() const {
+    return link_generation;
+}
+
+void CPU::registerModuleSymbols(byte* module_bytecode, uint64_t module_size, const vector<string>& names, const vector<viua::cpu::PreparedSymbol>& prepared_symbols) {
+    /** Registers symbol table of a module and resolves its symbols (unless linking lazily).
+     *
+     *  Symbols of modules registered earlier that are not resolved yet (e.g. names of functions from modules
+     *  that were not linked) can only be resolved by a module that has just been linked so only its tables
+     *  are searched for them.
+     */
+    if ((not lazy_linking) and (not linked_modules.empty()) and linked_modules.back().bytecode == module_bytecode) {
+        for (auto& each : module_symbols) {
+            resolveModuleSymbols(*each, linked_modules.back());
+        }
+    }
+
+    unique_ptr<viua::cpu::ModuleSymbols> module(new viua::cpu::ModuleSymbols(module_bytecode, module_size));
+    for (const auto& name : names) {
+        module->symbols.emplace_back(name);
+    }
+    if (prepared_symbols.size() == module->symbols.size()) {
+        for (decltype(prepared_symbols.size()) i = 0; i < prepared_symbols.size(); ++i) {
+            auto& symbol = module->symbols[i];
+            if (prepared_symbols[i].function != viua::cpu::PreparedSymbol::NONE) {
+                symbol.function = pair<byte*, byte*>((module_bytecode + prepared_symbols[i].function), module_bytecode);
+            } else if (prepared_symbols[i].block != viua::cpu::PreparedSymbol::NONE) {
+                symbol.block = pair<byte*, byte*>((module_bytecode + prepared_symbols[i].block), module_bytecode);
+            } else {
+                continue;
+            }
+            symbol.link_generation = link_generation;
+        }
+    }
+    if (not lazy_linking) {
+        for (auto& symbol : module->symbols) {
+            if (symbol.function.first == nullptr and symbol.block.first == nullptr) {
+                resolveSymbol(symbol);
+            }
+        }
+    }
+    module_symbols.emplace_back(std::move(module));
+}
+
+void CPU::resolveSymbol(viua::cpu::Symbol& symbol) const {
+    /** Resolve a symbol into entry points.
+     *  Names of functions are not searched for among blocks.
+     */
+    uint64_t address = 0;
+    if (symbol.function.first == nullptr) {
+        if (findLocalFunction(symbol.name, address)) {
+            symbol.function = pair<byte*, byte*>((bytecode + address), bytecode);
+        } else {
+            findLinkedFunction(symbol.name, symbol.function);
+        }
+    }
+    if (symbol.function.first == nullptr and symbol.block.first == nullptr) {
+        if (findLocalBlock(symbol.name, address)) {
+            symbol.block = pair<byte*, byte*>((bytecode + address), bytecode);
+        } else {
+            findLinkedBlock(symbol.name, symbol.block);
+        }
+    }
+    symbol.link_generation = link_generation;
+}
+
+uint64_t CPU::registerCountOf(const string& name, pair<byte*, byte*> entry_point) const {
+    /** Returns number of local registers needed by a function, or zero if it is not known.
+     *  Entry point of the function tells which module's table should be searched.
+     */
+    uint64_t count = 0;
+    if (entry_point.second == bytecode) {
+        executable_register_counts.find(name, count);
+        return count;
+    }
+    for (const auto& module : linked_modules) {
+        if (module.bytecode == entry_point.second) {
+            module.register_counts.find(name, count);
+            break;
+        }
+    }
+    return count;
+}
+
+bool CPU::sourceLineOf(const byte* address, string& file, uint64_t& line) const {
+    /** Finds the source file and line that bytecode at given address was assembled from.
+     *  Returns false if the module containing the address has no line table, or the line is not known.
+     */
+    shared_ptr<LineTable> table;
+    uint64_t offset = 0;
+    if (address >= bytecode and address < (bytecode+bytecode_size)) {
+        table = executable_lines;
+        offset = static_cast<uint64_t>(address - bytecode);
     } else {
-        auto lf = linked_functions.at(name);
-        entry_point = lf.second;
-        module_base = linked_modules.at(lf.first).second;
+        for (const auto& module : linked_modules) {
+            if (address >= module.bytecode and address < (module.bytecode+module.size)) {
+                table = module.lines;
+                offset = static_cast<uint64_t>(address - module.bytecode);
+                break;
+            }
+        }
+    }
+    if (not table or (line = table->line(offset)) == 0) {
+        return false;
+    }
+    file = table->file();
+    return true;
+}
+
+void CPU::resolveModuleSymbols(viua::cpu::ModuleSymbols& module, const viua::cpu::LinkedModule& linked) {
+    /** Resolve symbols of a module that are left unresolved into entry points in given linked module.
+     */
+    uint64_t address = 0;
+    for (auto& symbol : module.symbols) {
+        if (symbol.function.first or symbol.block.first) {
+            continue;
+        }
+        uint64_t name_hash = AddressTable::hash(symbol.name);
+        if (symbol.function.first == nullptr and linked.functions.find(symbol.name, name_hash, address)) {
+            symbol.function = pair<byte*, byte*>((linked.bytecode + address), linked.bytecode);
+        }
+        if (symbol.function.first == nullptr and linked.blocks.find(symbol.name, name_hash, address)) {
+            symbol.block = pair<byte*, byte*>((linked.bytecode + address), linked.bytecode);
+        }
+        symbol.link_generation = link_generation;
     }
-    return pair<byte*, byte*>(entry_point, module_base);
 }
 
 void CPU::registerPrototype(Prototype *proto) {
@@ -284,8 +582,14 @@ void CPU::registerPrototype(Prototype *proto) {
 }
 
 void CPU::requestForeignFunctionCall(Frame *frame, Process *requesting_process) {
+    auto request = new ForeignFunctionCallRequest(frame, requesting_process, this);
+    if (tracer) {
+        // recorded before the request is queued because a worker may complete it (and delete it) right away
+        tracer->foreignCallRequested(requesting_process, frame->function_name, request);
+    }
+
     unique_lock<mutex> lock(foreign_call_queue_mutex);
-    foreign_call_queue.push_back(new ForeignFunctionCallRequest(frame, requesting_process, this));
+    foreign_call_queue.push_back(request);
 
     // unlock before calling notify_one() to avoid waking the worker thread when it
     // cannot obtain the lock and
@@ -294,8 +598,29 @@ void CPU::requestForeignFunctionCall(Frame *frame, Process *requesting_process)
     foreign_call_queue_condition.notify_one();
 }
 
-void CPU::requestForeignMethodCall(const string& name, Type *object, Frame *frame, RegisterSet*, RegisterSet*, Process *p) {
-    foreign_methods.at(name)(object, frame, nullptr, nullptr, p, this);
+void CPU::callNonblockingForeignFunction(Frame *frame, Process *calling_process) {
+    unique_lock<mutex> lock(foreign_functions_mutex);
+    auto function = nonblocking_foreign_functions.at(frame->function_name);
+    lock.unlock();
+
+    // request takes ownership of the frame and deletes it even if the function throws
+    ForeignFunctionCallRequest(frame, calling_process, this).callInline(function);
+}
+
+void CPU::callTypedForeignFunction(Frame *frame, Process *calling_process) {
+    unique_lock<mutex> lock(foreign_functions_mutex);
+    const TypedForeignFunctionSpec& spec = typed_foreign_functions.at(frame->function_name);
+    lock.unlock();
+
+    ForeignFunctionCallRequest(frame, calling_process, this).callTyped(spec);
+}
+
+ForeignIOReactor* CPU::reactor() {
+    return &io_reactor;
+}
+
+void CPU::callForeignMethod(int id, Type *object, Frame *frame, RegisterSet*, RegisterSet*, Process *p) {
+    (object->*foreign_method_table.at(static_cast<decltype(foreign_method_table)::size_type>(id)))(frame, nullptr, nullptr, p, this);
 }
 
 int CPU::exit() const {
@@ -309,6 +634,8 @@ int CPU::run() {
         throw "null bytecode (maybe not loaded?)";
     }
 
+    registerModuleSymbols(bytecode, bytecode_size, executable_symbols, executable_prepared_symbols);
+
     viua::scheduler::VirtualProcessScheduler vps(this);
     vps.bootstrap(commandline_arguments);
 
@@ -321,13 +648,20 @@ int CPU::run() {
 
 CPU::CPU():
     bytecode(nullptr), bytecode_size(0), executable_offset(0),
+    link_generation(0),
     thrown(nullptr), caught(nullptr),
     return_code(0),
     ffi_schedulers_limit(VIUA_SCHED_FFI),
-    debug(false), errors(false)
+    debug(false), errors(false),
+    lazy_linking(false),
+    profiler(nullptr),
+    statistics(nullptr),
+    allocations(nullptr),
+    tracer(nullptr),
+    perf_map(nullptr)
 {
     for (auto i = ffi_schedulers_limit; i; --i) {
-        foreign_call_workers.push_back(new std::thread(ff_call_processor, &foreign_call_queue, &foreign_functions, &foreign_functions_mutex, &foreign_call_queue_mutex, &foreign_call_queue_condition));
+        foreign_call_workers.push_back(new std::thread(ff_call_processor, &foreign_call_queue, &foreign_functions, &async_foreign_functions, &foreign_functions_mutex, &foreign_call_queue_mutex, &foreign_call_queue_condition));
     }
 }
 
@@ -335,7 +669,7 @@ CPU::~CPU() {
     /*  Destructor frees memory at bytecode pointer so make sure you passed a copy of the bytecode to the constructor
      *  if you want to keep it around after the CPU is finished.
      */
-    if (bytecode) { delete[] bytecode; }
+    load(nullptr);
 
     /** Send a poison pill to every foreign function call worker thread.
      *  Collect them after they are killed.
@@ -371,16 +705,8 @@ CPU::~CPU() {
         delete w;
     }
 
-    std::map<std::string, std::pair<unsigned, byte*> >::iterator lm = linked_modules.begin();
-    while (lm != linked_modules.end()) {
-        std::string lkey = lm->first;
-        byte *ptr = lm->second.second;
-
-        ++lm;
-
-        linked_modules.erase(lkey);
-        delete[] ptr;
-    }
+    // bytecode of linked modules is executed in place so it is released together with module images
+    linked_modules.clear();
 
     std::map<std::string, Prototype*>::iterator pr = typesystem.begin();
     while (pr != typesystem.end()) {
@@ -17,16 +17,49 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <limits>
 #include <string>
 #include <viua/types/integer.h>
+#include <viua/types/float.h>
+#include <viua/types/string.h>
+#include <viua/types/byte.h>
+#include <viua/types/vector.h>
 #include <viua/types/exception.h>
 #include <viua/include/module.h>
 #include <viua/cpu/cpu.h>
+#include <viua/scheduler/allocations.h>
+#include <viua/scheduler/tracer.h>
 using namespace std;
 
 string ForeignFunctionCallRequest::functionName() const {
     return frame->function_name;
 }
+void ForeignFunctionCallRequest::placeReturnValue() {
+    /* // FIXME: woohoo! segfault! */
+    Type* returned = nullptr;
+    if (frame->place_return_value_in != 0) {
+        // we check in 0. register because it's reserved for return values
+        if (frame->regset->at(0) == nullptr) {
+            caller_process->raiseException(new Exception("return value requested by frame but external function did not set return register"));
+        }
+        returned = frame->regset->pop(0);
+    }
+
+    if (returned) {
+        placeReturnValue(returned);
+    }
+}
+void ForeignFunctionCallRequest::placeReturnValue(Type* returned) {
+    unsigned return_value_register = frame->place_return_value_in;
+    if (caller_process->trace().size() > 0) {
+        if (frame->resolve_return_value_register) {
+            return_value_register = static_cast<Integer*>(caller_process->obtain(return_value_register))->as_unsigned();
+        }
+        caller_process->put(return_value_register, returned);
+    } else {
+        delete returned;
+    }
+}
 void ForeignFunctionCallRequest::call(ForeignFunction* callback) {
     /* FIXME: second parameter should be a pointer to static registers or
      *        0 if function does not have static registers registered
@@ -35,34 +68,156 @@ void ForeignFunctionCallRequest::call(ForeignFunction* callback) {
      */
     try {
         (*callback)(frame, nullptr, nullptr, caller_process, cpu);
+        placeReturnValue();
+    } catch (Type *exception) {
+        caller_process->raiseException(exception);
+        caller_process->handleActiveException();
+    }
+}
+void ForeignFunctionCallRequest::callInline(ForeignFunction* callback) {
+    /** Calls a non-blocking foreign function on the calling thread.
+     *
+     *  Exceptions are not caught here; they propagate to the instruction
+     *  dispatch loop of the calling process, the same as exceptions thrown by the VM.
+     */
+    (*callback)(frame, nullptr, nullptr, caller_process, cpu);
+    placeReturnValue();
+}
+void ForeignFunctionCallRequest::callTyped(const TypedForeignFunctionSpec& spec) {
+    /** Calls a typed foreign function on the calling thread.
+     *
+     *  Arguments are unboxed from the parameter registers, and
+     *  the result is boxed only if the caller wants it.
+     *  Exceptions propagate to the instruction dispatch loop of the calling process.
+     */
+    ForeignValue arguments[MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS];
+    string byte_buffers[MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS];
+    for (unsigned i = 0; i < MAX_TYPED_FOREIGN_FUNCTION_PARAMETERS and spec.parameters[i] != FOREIGN_VOID; ++i) {
+        Type* argument = frame->args->at(i);
+        if (argument == nullptr) {
+            throw new Exception("missing parameter " + to_string(i) + " in call to " + frame->function_name);
+        }
 
-        /* // FIXME: woohoo! segfault! */
-        Type* returned = nullptr;
-        unsigned return_value_register = frame->place_return_value_in;
-        bool resolve_return_value_register = frame->resolve_return_value_register;
-        if (return_value_register != 0) {
-            // we check in 0. register because it's reserved for return values
-            if (frame->regset->at(0) == nullptr) {
-                caller_process->raiseException(new Exception("return value requested by frame but external function did not set return register"));
-            }
-            returned = frame->regset->pop(0);
+        switch (spec.parameters[i]) {
+            case FOREIGN_INT64:
+                if (Integer* integer = dynamic_cast<Integer*>(argument)) {
+                    arguments[i].int64 = integer->as_integer();
+                    continue;
+                }
+                break;
+            case FOREIGN_DOUBLE:
+                if (Float* floating = dynamic_cast<Float*>(argument)) {
+                    arguments[i].float64 = static_cast<double>(floating->value());
+                    continue;
+                }
+                break;
+            case FOREIGN_STRING:
+                if (String* str = dynamic_cast<String*>(argument)) {
+                    arguments[i].string.data = str->value().data();
+                    arguments[i].string.size = str->value().size();
+                    continue;
+                }
+                break;
+            case FOREIGN_BYTES:
+                if (String* str = dynamic_cast<String*>(argument)) {
+                    arguments[i].bytes.data = reinterpret_cast<const unsigned char*>(str->value().data());
+                    arguments[i].bytes.size = str->value().size();
+                    continue;
+                }
+                if (Vector* vec = dynamic_cast<Vector*>(argument)) {
+                    for (Type* element : vec->value()) {
+                        Byte* b = dynamic_cast<Byte*>(element);
+                        if (b == nullptr) {
+                            throw new Exception("invalid element of parameter " + to_string(i) + " in call to " + frame->function_name + ": " + element->type());
+                        }
+                        byte_buffers[i].push_back(b->value());
+                    }
+                    arguments[i].bytes.data = reinterpret_cast<const unsigned char*>(byte_buffers[i].data());
+                    arguments[i].bytes.size = byte_buffers[i].size();
+                    continue;
+                }
+                break;
+            default:
+                break;
         }
+        throw new Exception("invalid type of parameter " + to_string(i) + " in call to " + frame->function_name + ": " + argument->type());
+    }
+
+    ForeignValue result;
+    (*spec.fpointer)(arguments, &result);
+
+    if (frame->place_return_value_in == 0) {
+        return;
+    }
 
-        // place return value
-        if (returned and caller_process->trace().size() > 0) {
-            if (resolve_return_value_register) {
-                return_value_register = static_cast<Integer*>(caller_process->obtain(return_value_register))->as_unsigned();
+    Type* returned = nullptr;
+    switch (spec.return_type) {
+        case FOREIGN_INT64:
+            if (result.int64 < numeric_limits<int>::min() or result.int64 > numeric_limits<int>::max()) {
+                throw new Exception("value returned by " + frame->function_name + " out of range of Integer: " + to_string(result.int64));
             }
-            caller_process->put(return_value_register, returned);
+            returned = new Integer(static_cast<int>(result.int64));
+            break;
+        case FOREIGN_DOUBLE:
+            returned = new Float(static_cast<float>(result.float64));
+            break;
+        case FOREIGN_STRING:
+            returned = new String(string(result.string.data, result.string.size));
+            break;
+        case FOREIGN_BYTES: {
+            Vector* vec = new Vector();
+            for (uint64_t i = 0; i < result.bytes.size; ++i) {
+                vec->push(new Byte(static_cast<char>(result.bytes.data[i])));
+            }
+            returned = vec;
+            break;
         }
+        default:
+            throw new Exception("return value requested by frame but external function does not return anything");
+    }
+    placeReturnValue(returned);
+}
+void ForeignFunctionCallRequest::call(AsyncForeignFunction* callback) {
+    /** Starts an asynchronous foreign call.
+     *
+     *  The request owns itself from now on and
+     *  is deleted when the function completes (or fails) the call.
+     *  If the function throws before taking ownership of the completion handle
+     *  the call is failed immediately.
+     */
+    try {
+        (*callback)(frame, nullptr, nullptr, caller_process, cpu, this);
+    } catch (Type *exception) {
+        fail(exception);
+    }
+}
+void ForeignFunctionCallRequest::complete() {
+    try {
+        placeReturnValue();
     } catch (Type *exception) {
         caller_process->raiseException(exception);
         caller_process->handleActiveException();
     }
+    wakeup();
+    delete this;
+}
+void ForeignFunctionCallRequest::fail(Type* exception) {
+    caller_process->raiseException(exception);
+    caller_process->handleActiveException();
+    wakeup();
+    delete this;
 }
 void ForeignFunctionCallRequest::registerException(Type* object) {
     caller_process->raiseException(object);
 }
 void ForeignFunctionCallRequest::wakeup() {
+    // objects allocated by the call are constructed by now so their types can be resolved
+    viua::scheduler::AllocationProfiler::resolvePending();
+    if (cpu->tracer) {
+        cpu->tracer->foreignCallCompleted(caller_process, frame->function_name, this);
+    }
     caller_process->wakeup();
 }
+ForeignIOReactor* ForeignFunctionCallRequest::reactor() {
+    return cpu->reactor();
+}
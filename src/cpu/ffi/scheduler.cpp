@@ -26,7 +26,7 @@
 using namespace std;
 
 
-void ff_call_processor(vector<ForeignFunctionCallRequest*> *requests, map<string, ForeignFunction*>* foreign_functions, mutex *ff_map_mtx, mutex *mtx, condition_variable *cv) {
+void ff_call_processor(vector<ForeignFunctionCallRequest*> *requests, map<string, ForeignFunction*>* foreign_functions, map<string, AsyncForeignFunction*>* async_foreign_functions, mutex *ff_map_mtx, mutex *mtx, condition_variable *cv) {
     while (true) {
         unique_lock<mutex> lock(*mtx);
 
@@ -49,7 +49,15 @@ void ff_call_processor(vector<ForeignFunctionCallRequest*> *requests, map<string
 
         string call_name = request->functionName();
         unique_lock<mutex> ff_map_lock(*ff_map_mtx);
-        if (foreign_functions->count(call_name) == 0) {
+        if (async_foreign_functions->count(call_name)) {
+            auto function = async_foreign_functions->at(call_name);
+            ff_map_lock.unlock();
+
+            // asynchronous calls are completed (and their callers woken up) by whoever holds the completion handle
+            // so the worker must not touch the request after starting the call
+            request.release()->call(function);
+            continue;
+        } else if (foreign_functions->count(call_name) == 0) {
             request->registerException(new Exception("call to unregistered foreign function: " + call_name));
         } else {
             auto function = foreign_functions->at(call_name);
@@ -18,8 +18,28 @@
  */
 
 #include <viua/cpu/frame.h>
+using namespace std;
 
 
+atomic<void (*)(void*, size_t)> Frame::allocation_hook(nullptr);
+atomic<void (*)(void*, size_t)> Frame::deallocation_hook(nullptr);
+
+void* Frame::operator new(size_t size) {
+    void* allocated = ::operator new(size);
+    if (auto hook = allocation_hook.load()) {
+        hook(allocated, size);
+    }
+    return allocated;
+}
+
+void Frame::operator delete(void* allocated, size_t size) {
+    auto hook = deallocation_hook.load();
+    if (hook and allocated) {
+        hook(allocated, size);
+    }
+    ::operator delete(allocated);
+}
+
 void Frame::setLocalRegisterSet(RegisterSet* rs, bool receives_ownership) {
     if (owns_local_register_set) {
         delete regset;
@@ -27,3 +47,38 @@ void Frame::setLocalRegisterSet(RegisterSet* rs, bool receives_ownership) {
     owns_local_register_set = receives_ownership;
     regset = rs;
 }
+
+void Frame::allocateLocalRegisterSet(long unsigned needed) {
+    /** Allocates local register set of the frame unless it already has one.
+     *
+     *  If number of registers needed by the function using the frame is known (non-zero)
+     *  exactly that many registers are allocated instead of the requested number.
+     *  Counts are computed by the assembler after inlining so they must take precedence
+     *  over sizes requested by callers.
+     */
+    if (regset != nullptr) {
+        return;
+    }
+    regset = new RegisterSet(needed ? needed : local_register_set_size);
+    owns_local_register_set = true;
+}
+
+void Frame::growLocalRegisterSet(long unsigned needed) {
+    /** Makes owned local register set of the frame hold at least given number of registers.
+     *  Objects (and their masks) are kept in their registers.
+     */
+    if (regset == nullptr or not owns_local_register_set or needed <= regset->size()) {
+        return;
+    }
+    RegisterSet* grown = new RegisterSet(needed);
+    for (registerset_size_type i = 0; i < regset->size(); ++i) {
+        if (regset->at(i) == nullptr) {
+            continue;
+        }
+        mask_t mask = regset->getmask(i);
+        grown->put(i, regset->pop(i));
+        grown->setmask(i, mask);
+    }
+    delete regset;
+    regset = grown;
+}
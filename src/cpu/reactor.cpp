@@ -0,0 +1,205 @@
+/*
+ *  Copyright (C) 2015, 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <viua/types/exception.h>
+#include <viua/cpu/reactor.h>
+using namespace std;
+
+
+static const int MAX_EVENTS_PER_WAKEUP = 64;
+
+
+bool viua::cpu::Reactor::arm(int fd, Waiters& waiters) {
+    /** Registers the descriptor with epoll for every direction that is waited for.
+     *
+     *  Descriptors are registered as one-shot so a single readiness notification is
+     *  delivered for every await().
+     *  Returns false if the descriptor cannot be polled (e.g. a regular file); such descriptors
+     *  are always ready.
+     */
+    epoll_event event;
+    event.events = EPOLLONESHOT;
+    event.data.fd = fd;
+    if (waiters.on_readable) { event.events |= EPOLLIN; }
+    if (waiters.on_writable) { event.events |= EPOLLOUT; }
+
+    // descriptor may have been closed (which removes it from epoll's interest list) and
+    // its number reused since it was last armed so both operations must fall back to the other one
+    int result = epoll_ctl(epoll_fd, (waiters.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD), fd, &event);
+    if (result == -1 and waiters.registered and errno == ENOENT) {
+        result = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+    } else if (result == -1 and not waiters.registered and errno == EEXIST) {
+        result = epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+    }
+
+    if (result == -1) {
+        if (errno == EPERM) {
+            return false;
+        }
+        throw new Exception("IOException", ("failed to watch file descriptor: " + string(strerror(errno))));
+    }
+    waiters.registered = true;
+    return true;
+}
+
+void viua::cpu::Reactor::loop() {
+    epoll_event events[MAX_EVENTS_PER_WAKEUP];
+    vector<function<void()>> ready;
+
+    // callbacks made ready by the batch in which the reactor is woken up to stop must still be run
+    bool stopping = false;
+    while (not stopping) {
+        int n = epoll_wait(epoll_fd, events, MAX_EVENTS_PER_WAKEUP, -1);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        unique_lock<mutex> lock(waiting_mutex);
+        for (int i = 0; i < n; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeup_fd) {
+                stopping = true;
+                continue;
+            }
+            if (waiting.count(fd) == 0) {
+                continue;
+            }
+
+            Waiters& waiters = waiting.at(fd);
+            uint32_t flags = events[i].events;
+            bool failed = (flags & (EPOLLERR | EPOLLHUP));
+            if (waiters.on_readable and (failed or (flags & EPOLLIN))) {
+                ready.push_back(waiters.on_readable);
+                waiters.on_readable = nullptr;
+            }
+            if (waiters.on_writable and (failed or (flags & EPOLLOUT))) {
+                ready.push_back(waiters.on_writable);
+                waiters.on_writable = nullptr;
+            }
+
+            // one-shot registration is disarmed now, rearm it if the other direction is still waited for,
+            // and forget the descriptor otherwise so that the map does not grow with every descriptor ever awaited
+            if (not (waiters.on_readable or waiters.on_writable)) {
+                waiting.erase(fd);
+            } else {
+                bool armed = false;
+                try {
+                    armed = arm(fd, waiters);
+                } catch (Type* e) {
+                    delete e;
+                }
+                if (not armed) {
+                    // the descriptor cannot be watched any more so let the remaining callback discover why
+                    if (waiters.on_readable) { ready.push_back(waiters.on_readable); }
+                    if (waiters.on_writable) { ready.push_back(waiters.on_writable); }
+                    waiting.erase(fd);
+                }
+            }
+        }
+
+        // callbacks may await() again so they must be run without holding the lock
+        lock.unlock();
+        for (auto& callback : ready) {
+            callback();
+        }
+        ready.clear();
+    }
+}
+
+void viua::cpu::Reactor::await(int fd, Readiness direction, function<void()> callback) {
+    if (not failure.empty()) {
+        throw new Exception("IOException", ("I/O reactor is not available: " + failure));
+    }
+
+    unique_lock<mutex> lock(waiting_mutex);
+
+    if (loop_thread == nullptr) {
+        loop_thread = new thread(&viua::cpu::Reactor::loop, this);
+    }
+
+    Waiters& waiters = waiting[fd];
+    function<void()>& slot = (direction == READABLE ? waiters.on_readable : waiters.on_writable);
+    if (slot) {
+        throw new Exception("IOException", ("file descriptor is already awaited: " + to_string(fd)));
+    }
+    slot = callback;
+
+    bool armed = false;
+    try {
+        armed = arm(fd, waiters);
+    } catch (Type*) {
+        slot = nullptr;
+        throw;
+    }
+
+    if (not armed) {
+        slot = nullptr;
+        lock.unlock();
+        callback();
+    }
+}
+
+viua::cpu::Reactor::Reactor(): epoll_fd(-1), wakeup_fd(-1), loop_thread(nullptr) {
+    /*  Reactor is a part of CPU so failing to set it up must not prevent programs that
+     *  never wait for I/O from running; every await() fails instead of parking a process forever.
+     */
+    if ((epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        failure = ("failed to create epoll instance: " + string(strerror(errno)));
+        return;
+    }
+    if ((wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) == -1) {
+        failure = ("failed to create wakeup descriptor: " + string(strerror(errno)));
+        return;
+    }
+
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.fd = wakeup_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &event) == -1) {
+        failure = ("failed to watch wakeup descriptor: " + string(strerror(errno)));
+    }
+}
+
+viua::cpu::Reactor::~Reactor() {
+    if (loop_thread) {
+        uint64_t one = 1;
+        if (write(wakeup_fd, &one, sizeof(one)) == sizeof(one)) {
+            loop_thread->join();
+        } else {
+            loop_thread->detach();
+        }
+        delete loop_thread;
+    }
+    if (wakeup_fd != -1) {
+        close(wakeup_fd);
+    }
+    if (epoll_fd != -1) {
+        close(epoll_fd);
+    }
+}
@@ -29,6 +29,25 @@
 using namespace std;
 
 
+atomic<void (*)(void*, size_t)> RegisterSet::allocation_hook(nullptr);
+atomic<void (*)(void*, size_t)> RegisterSet::deallocation_hook(nullptr);
+
+void* RegisterSet::operator new(size_t size) {
+    void* allocated = ::operator new(size);
+    if (auto hook = allocation_hook.load()) {
+        hook(allocated, size);
+    }
+    return allocated;
+}
+
+void RegisterSet::operator delete(void* allocated, size_t size) {
+    auto hook = deallocation_hook.load();
+    if (hook and allocated) {
+        hook(allocated, size);
+    }
+    ::operator delete(allocated);
+}
+
 Type* RegisterSet::put(registerset_size_type index, Type* object) {
     if (index >= registerset_size) { throw new Exception("register access out of bounds: write"); }
     registers[index] = object;
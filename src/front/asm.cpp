@@ -19,6 +19,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <thread>
 #include <viua/support/string.h>
 #include <viua/support/env.h>
 #include <viua/version.h>
@@ -36,8 +38,15 @@ bool AS_LIB = false;
 
 // are we just expanding the source to simple form?
 bool EXPAND_ONLY = false;
+bool OPTIMISE = false;
+// functions with at most this many instructions are inlined when optimising
+unsigned INLINE_THRESHOLD = 8;
+// how many functions and blocks may be assembled in parallel (0 means one per hardware thread)
+unsigned JOBS = 0;
 // are we only verifying source code correctness?
 bool EARLY_VERIFICATION_ONLY = false;
+// should bytecode offsets be mapped to source lines?
+bool LINE_INFO = false;
 
 bool VERBOSE = false;
 bool DEBUG = false;
@@ -49,11 +58,13 @@ bool ERROR_ALL = false;
 // WARNINGS
 bool WARNING_MISSING_RETURN = false;
 bool WARNING_UNDEFINED_ARITY = false;
+bool WARNING_UNINITIALISED_REGISTER = false;
 
 // ERRORS
 bool ERROR_MISSING_RETURN = false;
 bool ERROR_HALT_IS_LAST = false;
 bool ERROR_UNDEFINED_ARITY = false;
+bool ERROR_UNINITIALISED_REGISTER = false;
 
 
 static bool usage(const char* program, bool show_help, bool show_version, bool verbose) {
@@ -81,16 +92,26 @@ static bool usage(const char* program, bool show_help, bool show_version, bool v
              << "    " << "-W, --Wall               - warn about everything\n"
              << "    " << "    --Wmissing-return    - warn about missing 'return' instruction at the end of functions\n"
              << "    " << "    --Wundefined-arity   - warn about functions declared with undefined arity\n"
+             << "    " << "    --Wuninitialised-register\n"
+             << "    " << "                         - warn about reads from registers that may be empty\n"
 
         // error reporting level control
              << "    " << "-E, --Eall               - treat all warnings as errors\n"
              << "    " << "    --Emissing-return    - treat missing 'return' instruction at the end of function as error\n"
              << "    " << "    --Eundefined-arity   - treat functions declared with undefined arity as errors\n"
              << "    " << "    --Ehalt-is-last      - treat 'halt' being used as last instruction of 'main' function as error\n"
+             << "    " << "    --Euninitialised-register\n"
+             << "    " << "                         - treat reads from registers that may be empty as errors (not implied by --Eall\n"
+             << "    " << "                           because such reads are well-defined: they throw exceptions)\n"
 
         // compilation options
              << "    " << "-o, --out <file>         - specify output file\n"
              << "    " << "-c, --lib                - assemble as a library\n"
+             << "    " << "-O, --optimise           - optimise functions (fold constants, remove dead stores, thread jumps)\n"
+             << "    " << "    --inline-threshold <n>\n"
+             << "    " << "                         - when optimising, inline leaf functions with at most <n> instructions (default: 8, 0 disables inlining)\n"
+             << "    " << "-j, --jobs <n>           - assemble at most <n> functions in parallel (default: one per hardware thread)\n"
+             << "    " << "-g, --line-info          - write a table mapping bytecode to source lines (used in stack traces and profiles)\n"
              << "    " << "-e, --expand             - only expand the source code to simple form (one instruction per line)\n"
              << "    " << "                           with this option, assembler prints expanded source to standard output\n"
              << "    " << "-C, --verify             - verify source code correctness without actually compiling it\n"
@@ -135,6 +156,9 @@ int main(int argc, char* argv[]) {
         } else if (option == "--Wundefined-arity") {
             WARNING_UNDEFINED_ARITY = true;
             continue;
+        } else if (option == "--Wuninitialised-register") {
+            WARNING_UNINITIALISED_REGISTER = true;
+            continue;
         } else if (option == "--Eall" or option == "-E") {
             ERROR_ALL = true;
             continue;
@@ -147,6 +171,9 @@ int main(int argc, char* argv[]) {
         } else if (option == "--Ehalt-is-last") {
             ERROR_HALT_IS_LAST = true;
             continue;
+        } else if (option == "--Euninitialised-register") {
+            ERROR_UNINITIALISED_REGISTER = true;
+            continue;
         } else if (option == "--out" or option == "-o") {
             if (i < argc-1) {
                 compilename = string(argv[++i]);
@@ -158,6 +185,28 @@ int main(int argc, char* argv[]) {
         } else if (option == "--lib" or option == "-c") {
             AS_LIB = true;
             continue;
+        } else if (option == "--optimise" or option == "-O") {
+            OPTIMISE = true;
+            continue;
+        } else if (option == "--inline-threshold") {
+            if (i < argc-1 and str::isnum(argv[i+1], false)) {
+                INLINE_THRESHOLD = static_cast<unsigned>(stoul(argv[++i]));
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: number of instructions" << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "--jobs" or option == "-j") {
+            if (i < argc-1 and str::isnum(argv[i+1], false)) {
+                JOBS = static_cast<unsigned>(stoul(argv[++i]));
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: number of jobs" << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "--line-info" or option == "-g") {
+            LINE_INFO = true;
+            continue;
         } else if (option == "--expand" or option == "-e") {
             EXPAND_ONLY = true;
             continue;
@@ -244,23 +293,35 @@ int main(int argc, char* argv[]) {
 
     ///////////////////////////////////////////
     // INITIAL VERIFICATION OF CODE CORRECTNESS
+    // control flow graphs are built once and shared by all checks of instructions
+    vector<assembler::cfg::graph_t> graphs = assembler::cfg::build(expanded_lines);
     try {
         assembler::verify::directives(expanded_lines);
-        assembler::verify::instructions(expanded_lines);
-        assembler::verify::ressInstructions(expanded_lines, AS_LIB);
+        assembler::verify::instructions(graphs);
+        assembler::verify::ressInstructions(graphs, AS_LIB);
         assembler::verify::functionNames(expanded_lines);
         assembler::verify::functionBodiesAreNonempty(expanded_lines);
-        assembler::verify::blockTries(expanded_lines, blocks.names, blocks.signatures);
-        assembler::verify::blockCatches(expanded_lines, blocks.names, blocks.signatures);
-        assembler::verify::frameBalance(expanded_lines, expanded_lines_to_source_lines);
-        assembler::verify::functionCallArities(expanded_lines);
-        assembler::verify::msgArities(expanded_lines);
+        assembler::verify::blockTries(graphs, blocks.names, blocks.signatures);
+        assembler::verify::blockCatches(graphs, blocks.names, blocks.signatures);
+        assembler::verify::frameBalance(graphs, expanded_lines_to_source_lines);
+        assembler::verify::tryFrameBalance(graphs, expanded_lines_to_source_lines);
+        assembler::verify::functionCallArities(graphs);
+        assembler::verify::msgArities(graphs);
         assembler::verify::functionsEndWithReturn(expanded_lines);
         assembler::verify::blockBodiesAreNonempty(expanded_lines);
-        assembler::verify::jumpsAreInRange(expanded_lines);
-        assembler::verify::framesHaveOperands(expanded_lines);
-        assembler::verify::framesHaveNoGaps(expanded_lines, expanded_lines_to_source_lines);
+        assembler::verify::jumpsAreInRange(graphs);
+        assembler::verify::framesHaveOperands(graphs);
+        assembler::verify::framesHaveNoGaps(graphs, expanded_lines_to_source_lines);
         assembler::verify::blocksEndWithFinishingInstruction(expanded_lines);
+
+        if (WARNING_ALL or WARNING_UNINITIALISED_REGISTER or ERROR_UNINITIALISED_REGISTER) {
+            for (const auto& each : assembler::verify::registersAreInitialised(graphs)) {
+                if (ERROR_UNINITIALISED_REGISTER) {
+                    throw each;
+                }
+                cout << filename << ':' << expanded_lines_to_source_lines.at(each.first)+1 << ": warning: " << each.second << endl;
+            }
+        }
     } catch (const pair<unsigned, string>& e) {
         cout << filename << ':' << expanded_lines_to_source_lines.at(e.first)+1 << ": error: " << e.second << endl;
         return 1;
@@ -271,15 +332,39 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    ///////////////////////////////////////
+    // OPTIMISE VERIFIED CODE IF REQUESTED
+    // inlined code is reported at lines of calls it replaced, and optimised code has as many lines
+    // as the original so line numbers of error reports do not change
+    if (OPTIMISE) {
+        vector<vector<string>::size_type> origins;
+        expanded_lines = assembler::optimise::inlineCalls(expanded_lines, INLINE_THRESHOLD, origins);
+        map<long unsigned, long unsigned> inlined_lines_to_source_lines;
+        for (decltype(origins.size()) i = 0; i < origins.size(); ++i) {
+            if (expanded_lines_to_source_lines.count(origins[i])) {
+                inlined_lines_to_source_lines[i] = expanded_lines_to_source_lines.at(origins[i]);
+            }
+        }
+        expanded_lines_to_source_lines = inlined_lines_to_source_lines;
+
+        expanded_lines = assembler::optimise::lines(expanded_lines);
+        ilines = assembler::ce::getilines(expanded_lines);
+        if (gatherFunctions(&functions, expanded_lines, ilines)) {
+            return 1;
+        }
+    }
+
     compilationflags_t flags;
     flags.as_lib = AS_LIB;
     flags.verbose = VERBOSE;
     flags.debug = DEBUG;
     flags.scream = SCREAM;
+    flags.jobs = (JOBS ? JOBS : max(1u, thread::hardware_concurrency()));
+    flags.line_info = LINE_INFO;
 
     int ret_code = 0;
     try {
-        ret_code = generate(expanded_lines, ilines, functions, blocks, filename, compilename, commandline_given_links, flags);
+        ret_code = generate(expanded_lines, expanded_lines_to_source_lines, ilines, functions, blocks, filename, compilename, commandline_given_links, flags);
     } catch (const string& e) {
         ret_code = 1;
         cout << "fatal: exception occured during assembling: " << e << endl;
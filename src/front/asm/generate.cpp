@@ -17,11 +17,17 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <unistd.h>
 #include <cstdint>
+#include <cstdlib>
+#include <cstdio>
 #include <iostream>
 #include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <set>
+#include <thread>
+#include <atomic>
 #include <viua/machine.h>
 #include <viua/bytecode/maps.h>
 #include <viua/support/string.h>
@@ -30,6 +36,7 @@
 #include <viua/program.h>
 #include <viua/cg/tokenizer.h>
 #include <viua/cg/assembler/assembler.h>
+#include <viua/cg/disassembler/disassembler.h>
 #include <viua/front/asm.h>
 using namespace std;
 
@@ -476,15 +483,17 @@ static Program& compile(Program& program, const vector<string>& lines, map<strin
              *  If call is given only one operand - it means it is the instruction index and returned value is discarded.
              *  To explicitly state that return value should be discarderd 0 can be supplied as second operand.
              */
-            /** Why is the function supplied as a *string* and not direct instruction pointer?
+            /** Why is the function supplied as a *name* and not direct instruction pointer?
              *  That would be faster - c'mon couldn't assembler just calculate offsets and insert them?
              *
              *  Nope.
              *
              *  Yes, it *would* be faster if calls were just precalculated jumps.
-             *  However, by them being strings we get plenty of flexibility, good-quality stack traces, and
+             *  However, by them being names we get plenty of flexibility, good-quality stack traces, and
              *  a place to put plenty of debugging info.
-             *  All that at a cost of just one map lookup; the overhead is minimal and gains are big.
+             *  Names are stored once in module's symbol table and the instruction refers to them by index, which
+             *  the CPU resolves to entry points when the module is loaded.
+             *  All that at a cost of just one table lookup; the overhead is minimal and gains are big.
              *  What's not to love?
              *
              *  Of course, you, my dear reader, are free to take this code (it's GPL after all!) and
@@ -687,6 +696,351 @@ static void assemble(Program& program, const vector<string>& lines) {
 }
 
 
+/*  Bytecode of a single function or block.
+ *  Each function and block is assembled with its own symbol table, and jump targets relative
+ *  to its first byte; both are adjusted when the bytecode is laid out in the code section.
+ */
+struct assembled_t {
+    string name;
+    string kind;
+    const vector<string>& counted_lines;
+    const vector<string>& lines;
+
+    uint64_t size;
+    byte* bytecode;
+    vector<uint64_t> jumps;
+    vector<uint64_t> jumps_absolute;
+    vector<uint64_t> symbol_references;
+    SymbolTable symbols;
+
+    // assembly errors are reported when the bytecode is laid out, in the order of definitions
+    string error;
+
+    // path of object cache file, empty if the cache is not used
+    string cache_path;
+    bool cached;
+
+    assembled_t(const string& n, const string& k, const vector<string>& cl, const vector<string>& l):
+        name(n), kind(k), counted_lines(cl), lines(l), size(0), bytecode(nullptr), cached(false)
+    {}
+};
+
+
+/*  Object cache.
+ *
+ *  When VIUACACHE environment variable names a directory, bytecode of every assembled function and block is stored
+ *  there and reused by later runs of the assembler if source of the function (or block) has not changed.
+ *  Bytecode of a function depends only on its own source: references to other functions and blocks are symbol
+ *  operands, and jump targets are relative to the first byte of the function, and both are adjusted by the layout.
+ *  Cache files are named after the source file and the function, and hold source of the function to compare it
+ *  with the one being assembled; they are also keyed by the identity of the assembler binary.
+ */
+static const char* OBJECT_CACHE_MAGIC = "VIUAOBJC";
+static const uint64_t OBJECT_CACHE_REVISION = 1;
+
+static string objectCachePath(const string& directory, const string& filename, const assembled_t& each) {
+    char* resolved = realpath(filename.c_str(), nullptr);
+    string absolute = (resolved ? string(resolved) : filename);
+    free(resolved);
+
+    ostringstream path;
+    path << directory << '/' << hex << AddressTable::hash(absolute + '\0' + each.kind + '\0' + each.name) << ".vobj";
+    return path.str();
+}
+
+static string objectCacheSource(const assembled_t& each) {
+    return (each.kind + '\n' + each.name + '\n' + str::join<char>(each.lines, '\n'));
+}
+
+static void writeNumbers(ofstream& out, const vector<uint64_t>& numbers) {
+    uint64_t count = numbers.size();
+    bwrite(out, count);
+    out.write(reinterpret_cast<const char*>(numbers.data()), static_cast<streamsize>(numbers.size() * sizeof(uint64_t)));
+}
+
+static bool readNumbers(ifstream& in, vector<uint64_t>& numbers) {
+    uint64_t count = 0;
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (not in) {
+        return false;
+    }
+    numbers.resize(count);
+    in.read(reinterpret_cast<char*>(numbers.data()), static_cast<streamsize>(count * sizeof(uint64_t)));
+    return static_cast<bool>(in);
+}
+
+static bool readObjectCache(assembled_t& each, const vector<uint64_t>& key) {
+    ifstream in(each.cache_path, ios::binary);
+    string magic(8, '\0');
+    vector<uint64_t> cached_key(key.size());
+    uint64_t source_size = 0;
+    in.read(&magic[0], static_cast<streamsize>(magic.size()));
+    in.read(reinterpret_cast<char*>(cached_key.data()), static_cast<streamsize>(cached_key.size() * sizeof(uint64_t)));
+    in.read(reinterpret_cast<char*>(&source_size), sizeof(source_size));
+    if ((not in) or magic != OBJECT_CACHE_MAGIC or cached_key != key) {
+        return false;
+    }
+
+    string source = objectCacheSource(each);
+    if (source_size != source.size()) {
+        return false;
+    }
+    string cached_source(source_size, '\0');
+    in.read(&cached_source[0], static_cast<streamsize>(source_size));
+    if ((not in) or cached_source != source) {
+        return false;
+    }
+
+    uint64_t size = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (not in) {
+        return false;
+    }
+    vector<byte> bytecode(size);
+    in.read(reinterpret_cast<char*>(bytecode.data()), static_cast<streamsize>(size));
+
+    vector<uint64_t> jumps, jumps_absolute, symbol_references;
+    uint64_t symbols = 0;
+    if (not (readNumbers(in, jumps) and readNumbers(in, jumps_absolute) and readNumbers(in, symbol_references))) {
+        return false;
+    }
+    in.read(reinterpret_cast<char*>(&symbols), sizeof(symbols));
+    vector<string> names;
+    string name;
+    for (uint64_t i = 0; i < symbols and getline(in, name, '\0'); ++i) {
+        names.push_back(name);
+    }
+    if ((not in) or names.size() != symbols) {
+        return false;
+    }
+
+    each.size = size;
+    each.bytecode = new byte[size];
+    copy(bytecode.begin(), bytecode.end(), each.bytecode);
+    each.jumps = jumps;
+    each.jumps_absolute = jumps_absolute;
+    each.symbol_references = symbol_references;
+    for (const auto& symbol : names) {
+        each.symbols.intern(symbol);
+    }
+    each.cached = true;
+    return true;
+}
+
+static void writeObjectCache(const assembled_t& each, const vector<uint64_t>& key) {
+    // other assemblers may be reading the cache so it is replaced atomically
+    string temporary_path = (each.cache_path + '.' + to_string(getpid()));
+    string source = objectCacheSource(each);
+    ofstream out(temporary_path, ios::binary);
+    out.write(OBJECT_CACHE_MAGIC, 8);
+    out.write(reinterpret_cast<const char*>(key.data()), static_cast<streamsize>(key.size() * sizeof(uint64_t)));
+    uint64_t source_size = source.size();
+    bwrite(out, source_size);
+    out.write(source.c_str(), static_cast<streamsize>(source.size()));
+    bwrite(out, each.size);
+    out.write(reinterpret_cast<const char*>(each.bytecode), static_cast<streamsize>(each.size));
+    writeNumbers(out, each.jumps);
+    writeNumbers(out, each.jumps_absolute);
+    writeNumbers(out, each.symbol_references);
+    uint64_t symbols = each.symbols.symbols().size();
+    bwrite(out, symbols);
+    for (const auto& symbol : each.symbols.symbols()) {
+        strwrite(out, symbol);
+    }
+    out.close();
+
+    if ((not out) or rename(temporary_path.c_str(), each.cache_path.c_str()) == -1) {
+        // failing to write the cache is not an error, the function is just assembled again next time
+        unlink(temporary_path.c_str());
+    }
+}
+
+
+static void assembleCodeBlock(assembled_t& each, const vector<uint64_t>& cache_key) {
+    if (not each.cache_path.empty() and readObjectCache(each, cache_key)) {
+        return;
+    }
+
+    uint64_t fun_bytes = 0;
+    try {
+        fun_bytes = Program::countBytes(each.counted_lines);
+    } catch (const string& e) {
+        each.error = ("fatal: error during " + each.kind + " size count (pre-assembling): " + e);
+        return;
+    } catch (const std::out_of_range& e) {
+        each.error = e.what();
+        return;
+    }
+
+    Program func(fun_bytes);
+    func.setdebug(DEBUG).setscream(SCREAM).setsymbols(&each.symbols);
+    try {
+        assemble(func, each.lines);
+    } catch (const string& e) {
+        each.error = (string(DEBUG ? "\n" : "") + "fatal: error during assembling: " + e);
+        return;
+    } catch (const char*& e) {
+        each.error = (string(DEBUG ? "\n" : "") + "fatal: error during assembling: " + e);
+        return;
+    } catch (const std::out_of_range& e) {
+        each.error = (string(DEBUG ? "\n" : "") + "[asm] fatal: could not assemble " + each.kind + " '" + each.name + "' (" + e.what() + ')');
+        return;
+    }
+
+    each.jumps = func.jumps();
+    each.jumps_absolute = func.jumpsAbsolute();
+
+    vector<tuple<uint64_t, uint64_t> > local_jumps;
+    for (unsigned i = 0; i < each.jumps.size(); ++i) {
+        local_jumps.push_back(tuple<uint64_t, uint64_t>(each.jumps[i], 0));
+    }
+    func.calculateJumps(local_jumps);
+
+    each.size = func.size();
+    each.bytecode = func.bytecode();
+    each.symbol_references = func.symbolReferences();
+
+    if (not each.cache_path.empty()) {
+        writeObjectCache(each, cache_key);
+    }
+}
+
+static void assembleInParallel(vector<assembled_t>& blocks, vector<assembled_t>& functions, unsigned jobs, const vector<uint64_t>& cache_key) {
+    /** Assembles functions and blocks using at most `jobs` threads.
+     */
+    const auto total = (blocks.size() + functions.size());
+    atomic<decltype(blocks.size())> next(0);
+    auto worker = [&blocks, &functions, &next, &cache_key, total]() {
+        for (auto i = next++; i < total; i = next++) {
+            assembleCodeBlock((i < blocks.size() ? blocks[i] : functions[i - blocks.size()]), cache_key);
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned i = 1; i < jobs and i < total; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& each : workers) {
+        each.join();
+    }
+}
+
+static uint64_t layOut(vector<assembled_t>& assembled, map<string, tuple<uint64_t, byte*>>& bytecode, SymbolTable& symbol_table, vector<uint64_t>& jump_table, vector<tuple<uint64_t, uint64_t>>& jump_positions, vector<uint64_t>& symbol_references, uint64_t section_size) {
+    /** Places assembled functions or blocks one after another, starting at `section_size`.
+     *  Returns size of the section after all of them have been placed.
+     */
+    for (auto& each : assembled) {
+        if (VERBOSE or DEBUG) {
+            cout << "[asm] message: generating bytecode for " << each.kind << " \"" << each.name << '"';
+        }
+        if (not each.error.empty()) {
+            cout << each.error << endl;
+            exit(1);
+        }
+        if (VERBOSE or DEBUG) {
+            cout << " (" << each.size << " bytes at byte " << section_size << (each.cached ? ", from cache" : "") << ')' << endl;
+        }
+
+        // relative jumps were calculated as if the code started at byte 0
+        for (uint64_t jmp : each.jumps) {
+            *reinterpret_cast<uint64_t*>(each.bytecode+jmp) += section_size;
+        }
+
+        // symbol operands refer to symbol table of the function or block so they must be remapped
+        for (uint64_t ref : each.symbol_references) {
+            uint32_t* symbol = reinterpret_cast<uint32_t*>(each.bytecode+ref+sizeof(OperandType));
+            *symbol = symbol_table.intern(each.symbols.symbols().at(*symbol));
+            symbol_references.push_back(ref+section_size);
+        }
+
+        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
+        bytecode[each.name] = tuple<uint64_t, byte*>(each.size, each.bytecode);
+
+        // extend jump table with jumps from current function or block
+        for (uint64_t jmp : each.jumps) {
+            if (DEBUG) {
+                cout << "[asm] debug: pushed relative jump to jump table: " << jmp << '+' << section_size << endl;
+            }
+            jump_table.push_back(jmp+section_size);
+        }
+
+        for (uint64_t jmp : each.jumps_absolute) {
+            if (DEBUG) {
+                cout << "[asm] debug: pushed absolute jump to jump table: " << jmp << "+0" << endl;
+            }
+            jump_positions.push_back(tuple<uint64_t, uint64_t>(jmp+section_size, 0));
+        }
+
+        section_size += each.size;
+    }
+    return section_size;
+}
+
+static vector<uint64_t> sourceLinesOfInstructionLines(const vector<string>& expanded_lines, const map<long unsigned, long unsigned>& expanded_lines_to_source_lines) {
+    /** Returns source lines (counted from 1, or zero if not known) of lines that are left in the code
+     *  by assembler::ce::getilines(), in the same order.
+     */
+    vector<uint64_t> source_lines;
+    for (decltype(expanded_lines.size()) i = 0; i < expanded_lines.size(); ++i) {
+        string line = str::lstrip(expanded_lines[i]);
+        if (line.empty() or line[0] == ';' or str::startswith(line, "--")) {
+            continue;
+        }
+        auto found = expanded_lines_to_source_lines.find(i);
+        source_lines.push_back(found == expanded_lines_to_source_lines.end() ? 0 : (found->second + 1));
+    }
+    return source_lines;
+}
+
+static vector<pair<uint64_t, uint64_t>> lineTableEntries(const vector<assembled_t>& blocks, const vector<assembled_t>& functions, const vector<string>& ilines, const vector<uint64_t>& source_lines) {
+    /** Maps bytecode of local functions and blocks (laid out in the given order, starting at byte 0) to source lines.
+     *
+     *  Bodies of functions and blocks are found in instruction lines by name, and
+     *  lines of code that was not assembled from the source (e.g. the entry function) are marked with line 0.
+     */
+    map<string, decltype(ilines.size())> openings;
+    for (decltype(ilines.size()) i = 0; i < ilines.size(); ++i) {
+        for (const string kind : {"function", "block"}) {
+            string opening = ('.' + kind + ':');
+            if (str::startswith(ilines[i], opening)) {
+                openings[kind + ' ' + str::chunk(str::lstrip(str::sub(ilines[i], opening.size())))] = i;
+            }
+        }
+    }
+
+    vector<pair<uint64_t, uint64_t>> entries;
+    uint64_t offset = 0;
+    for (const auto& assembled : {&blocks, &functions}) {
+        for (const auto& each : *assembled) {
+            auto opening = openings.find(each.kind + ' ' + each.name);
+            for (decltype(each.counted_lines.size()) i = 0; i < each.counted_lines.size(); ++i) {
+                uint64_t size = Program::countBytes({each.counted_lines[i]});
+                if (size == 0) {
+                    continue;
+                }
+
+                uint64_t line = 0;
+                if (opening != openings.end()) {
+                    auto at = (opening->second + 1 + i);
+                    if (at < ilines.size() and ilines[at] == each.counted_lines[i]) {
+                        line = source_lines.at(at);
+                    }
+                }
+                if (entries.empty() or entries.back().second != line) {
+                    entries.emplace_back(offset, line);
+                }
+                offset += size;
+            }
+        }
+    }
+    if (not entries.empty() and entries.back().second != 0) {
+        // statically linked functions follow local code
+        entries.emplace_back(offset, 0);
+    }
+    return entries;
+}
+
 static map<string, uint64_t> mapInvocableAddresses(uint64_t& starting_instruction, const vector<string>& names, const map<string, vector<string> >& sources) {
     map<string, uint64_t> addresses;
     for (string name : names) {
@@ -743,7 +1097,54 @@ vector<string> expandSource(const vector<string>& lines, map<long unsigned, long
     return asm_lines;
 }
 
-static uint64_t writeCodeBlocksSection(ofstream& out, const invocables_t& blocks, const vector<string>& linked_block_names, uint64_t block_bodies_size_so_far = 0) {
+static vector<tuple<string, uint64_t, uint64_t>> linkedFunctionRanges(Loader& loader) {
+    /** Returns names, addresses and sizes of functions of a linked module, sorted by address.
+     *
+     *  Function bodies are laid out one after another after the blocks of the module so
+     *  every function ends where the next one begins, and the last one ends with the bytecode.
+     */
+    vector<tuple<string, uint64_t, uint64_t>> ranges;
+    for (const auto& each : loader.getFunctionAddresses()) {
+        ranges.emplace_back(each.first, each.second, 0);
+    }
+    sort(ranges.begin(), ranges.end(), [](const tuple<string, uint64_t, uint64_t>& a, const tuple<string, uint64_t, uint64_t>& b) -> bool {
+        return get<1>(a) < get<1>(b);
+    });
+    for (decltype(ranges)::size_type i = 0; i < ranges.size(); ++i) {
+        uint64_t end = ((i+1) < ranges.size() ? get<1>(ranges[i+1]) : loader.getBytecodeSize());
+        get<2>(ranges[i]) = (end - get<1>(ranges[i]));
+    }
+    return ranges;
+}
+
+static void gatherReferencedNames(const string& line, set<string>& names) {
+    /** Collects operands that may name a function (i.e. ones with arity) from a line of assembly.
+     *
+     *  This catches names used by call, tailcall, process, watchdog, closure, function, msg and attach
+     *  instructions alike, and errs on the safe side for anything else that merely looks like a name.
+     */
+    istringstream tokens(line);
+    string token;
+    while (tokens >> token) {
+        if (str::contains(token, '/')) {
+            names.insert(token);
+        }
+    }
+}
+
+static set<string> referencedNames(byte* bytecode, uint64_t size, const vector<string>& symbols) {
+    set<string> names;
+    for (uint64_t i = 0; i < size;) {
+        string instruction;
+        unsigned instruction_size = 0;
+        tie(instruction, instruction_size) = disassembler::instruction((bytecode+i), &symbols);
+        gatherReferencedNames(instruction, names);
+        i += instruction_size;
+    }
+    return names;
+}
+
+static uint64_t writeCodeBlocksSection(ofstream& out, const invocables_t& blocks, const vector<string>& linked_block_names, vector<pair<string, uint64_t>>& address_table, uint64_t block_bodies_size_so_far = 0) {
     uint64_t block_ids_section_size = 0;
     for (string name : blocks.names) { block_ids_section_size += name.size(); }
     // we need to insert address after every block
@@ -773,6 +1174,7 @@ static uint64_t writeCodeBlocksSection(ofstream& out, const invocables_t& blocks
         // mapped address must come after name
         // FIXME: use uncasted uint64_t
         bwrite(out, block_bodies_size_so_far);
+        address_table.emplace_back(name, block_bodies_size_so_far);
         // blocks.bodies size must be incremented by the actual size of block's bytecode size
         // to give correct offset for next block
         try {
@@ -786,7 +1188,7 @@ static uint64_t writeCodeBlocksSection(ofstream& out, const invocables_t& blocks
     return block_bodies_size_so_far;
 }
 
-int generate(const vector<string>& expanded_lines, vector<string>& ilines, invocables_t& functions, invocables_t& blocks, const string& filename, string& compilename, const vector<string>& commandline_given_links, const compilationflags_t& flags) {
+int generate(const vector<string>& expanded_lines, const map<long unsigned, long unsigned>& expanded_lines_to_source_lines, vector<string>& ilines, invocables_t& functions, invocables_t& blocks, const string& filename, string& compilename, const vector<string>& commandline_given_links, const compilationflags_t& flags) {
     //////////////////////////////
     // SETUP INITIAL BYTECODE SIZE
     uint64_t bytes = 0;
@@ -860,10 +1262,13 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
     /////////////////////////////////////////////////////////
     // GATHER LINKS, GET THEIR SIZES AND ADJUST BYTECODE SIZE
     vector<string> links = assembler::ce::getlinks(ilines);
-    vector<tuple<string, uint64_t, byte*> > linked_libs_bytecode;
+    vector<tuple<string, vector<byte>>> linked_libs_bytecode;
     vector<string> linked_function_names;
     vector<string> linked_block_names;
-    map<string, vector<uint64_t> > linked_libs_jumptables;
+
+    // names of functions referenced by each linked function
+    // only functions reachable from local code are written to output when linking executables
+    map<string, set<string>> linked_function_references;
 
     // map of symbol names to name of the module the symbol came from
     map<string, string> symbol_sources;
@@ -891,7 +1296,11 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
             }
         }
 
-        map<string, uint64_t> fn_addresses = loader.getFunctionAddresses();
+        vector<string> lib_symbols = loader.getSymbols();
+        for (const auto& each : linkedFunctionRanges(loader)) {
+            linked_function_references[get<0>(each)] = referencedNames((loader.getMappedBytecode()+get<1>(each)), get<2>(each), lib_symbols);
+        }
+
         for (string fn : fn_names) {
             function_addresses[fn] = 0; // for now we just build a list of all available functions
             symbol_sources[fn] = lnk;
@@ -983,7 +1392,7 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
         // we also save return value in 1 register since 0 means "drop return value"
         entry_function_lines.push_back("call 1 " + main_function);
         bytes += OP_SIZES.at("call");
-        bytes += main_function.size()+1;
+        bytes += SYMBOL_OPERAND_SIZE;
 
         // then, register 1 is moved to register 0 so it counts as a return code
         entry_function_lines.push_back("move 0 1");
@@ -996,6 +1405,45 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
     }
 
 
+    ////////////////////////////////////////////////////
+    // FIND LINKED FUNCTIONS REACHABLE FROM THE LOCAL CODE
+    // libraries export everything they contain so only executables are trimmed;
+    // local code (including the entry function calling main) is always kept so
+    // its references are the roots of the search
+    set<string> reachable_linked_functions;
+    if (flags.as_lib) {
+        reachable_linked_functions.insert(linked_function_names.begin(), linked_function_names.end());
+    } else {
+        set<string> referenced;
+        for (const auto& each : functions.bodies) {
+            for (const auto& line : each.second) { gatherReferencedNames(line, referenced); }
+        }
+        for (const auto& each : blocks.bodies) {
+            for (const auto& line : each.second) { gatherReferencedNames(line, referenced); }
+        }
+
+        vector<string> pending(referenced.begin(), referenced.end());
+        while (not pending.empty()) {
+            string name = pending.back();
+            pending.pop_back();
+            if (linked_function_references.count(name) == 0 or reachable_linked_functions.count(name)) {
+                continue;
+            }
+            reachable_linked_functions.insert(name);
+            for (const auto& each : linked_function_references.at(name)) {
+                pending.push_back(each);
+            }
+        }
+    }
+
+
+    // names of functions and blocks referenced by the bytecode, and positions of symbol operands in it
+    SymbolTable symbol_table;
+    vector<uint64_t> symbol_references;
+
+    // numbers of local registers needed by functions; linked functions bring theirs from their modules
+    vector<pair<string, uint64_t>> register_count_table;
+
     uint64_t current_link_offset = bytes;
     for (string lnk : links) {
         if (DEBUG or VERBOSE) {
@@ -1005,8 +1453,6 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
         Loader loader(lnk);
         loader.load();
 
-        vector<string> fn_names = loader.getFunctions();
-
         vector<uint64_t> lib_jumps = loader.getJumps();
         if (DEBUG) {
             cout << "[loader] entries in jump table: " << lib_jumps.size() << endl;
@@ -1014,19 +1460,60 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
                 cout << "  jump at byte: " << lib_jumps[i] << endl;
             }
         }
+        sort(lib_jumps.begin(), lib_jumps.end());
+
+        vector<uint64_t> lib_symbol_references = loader.getSymbolReferences();
+        sort(lib_symbol_references.begin(), lib_symbol_references.end());
+        vector<string> lib_symbols = loader.getSymbols();
+        AddressTable lib_register_counts = loader.getRegisterCountTable();
+
+        // blocks of linked modules are not mapped in the output so only function bodies are copied,
+        // and each of them is moved to its place in the output
+        byte* lib_bytecode = loader.getMappedBytecode();
+        vector<byte> linked_bytecode;
+        for (const auto& each : linkedFunctionRanges(loader)) {
+            string fn;
+            uint64_t fn_address, fn_size;
+            tie(fn, fn_address, fn_size) = each;
+
+            if (reachable_linked_functions.count(fn) == 0) {
+                if (DEBUG or VERBOSE) {
+                    cout << "[linker] message: dropping unreachable function \"" << fn << "\" (" << fn_size << " bytes) from module " << lnk << endl;
+                }
+                continue;
+            }
 
-        linked_libs_jumptables[lnk] = lib_jumps;
-
-        map<string, uint64_t> fn_addresses = loader.getFunctionAddresses();
-        for (string fn : fn_names) {
-            function_addresses[fn] = fn_addresses.at(fn) + current_link_offset;
+            uint64_t linked_address = (bytes + linked_bytecode.size());
+            function_addresses[fn] = linked_address;
             if (DEBUG) {
-                cout << "  \"" << fn << "\": entry point at byte: " << current_link_offset << '+' << fn_addresses.at(fn) << endl;
+                cout << "  \"" << fn << "\": entry point at byte: " << linked_address << " (" << fn_address << " in module)" << endl;
+            }
+            linked_bytecode.insert(linked_bytecode.end(), (lib_bytecode+fn_address), (lib_bytecode+fn_address+fn_size));
+            uint64_t register_count = 0;
+            if (lib_register_counts.find(fn, register_count)) {
+                register_count_table.emplace_back(fn, register_count);
+            }
+            byte* linked_function = (linked_bytecode.data() + (linked_address - bytes));
+
+            // jumps are absolute so they must be adjusted by the distance the function has been moved by
+            for (auto jmp = lower_bound(lib_jumps.begin(), lib_jumps.end(), fn_address); jmp != lib_jumps.end() and *jmp < (fn_address+fn_size); ++jmp) {
+                uint64_t* jmp_target = reinterpret_cast<uint64_t*>(linked_function+(*jmp-fn_address));
+                if (DEBUG) {
+                    cout << "[linker] adjusting jump: at position " << *jmp << ", " << *jmp_target << " -> " << (*jmp_target-fn_address+linked_address) << endl;
+                }
+                *jmp_target = (*jmp_target - fn_address + linked_address);
+            }
+
+            // symbol operands of linked module refer to its own symbol table so they must be remapped
+            for (auto ref = lower_bound(lib_symbol_references.begin(), lib_symbol_references.end(), fn_address); ref != lib_symbol_references.end() and *ref < (fn_address+fn_size); ++ref) {
+                uint32_t* symbol = reinterpret_cast<uint32_t*>(linked_function+(*ref-fn_address)+sizeof(OperandType));
+                *symbol = symbol_table.intern(lib_symbols.at(*symbol));
+                symbol_references.push_back(*ref-fn_address+linked_address);
             }
         }
 
-        linked_libs_bytecode.push_back( tuple<string, uint64_t, byte*>(lnk, loader.getBytecodeSize(), loader.getBytecode()) );
-        bytes += loader.getBytecodeSize();
+        bytes += linked_bytecode.size();
+        linked_libs_bytecode.emplace_back(lnk, std::move(linked_bytecode));
     }
 
 
@@ -1036,6 +1523,12 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
     assembler::verify::functionCallsAreDefined(expanded_lines, functions.names, functions.signatures);
     assembler::verify::callableCreations(expanded_lines, functions.names, functions.signatures);
 
+    auto unreachable = [&reachable_linked_functions, &linked_function_references](const string& name) -> bool {
+        return (linked_function_references.count(name) and reachable_linked_functions.count(name) == 0);
+    };
+    functions.names.erase(remove_if(functions.names.begin(), functions.names.end(), unreachable), functions.names.end());
+    linked_function_names.erase(remove_if(linked_function_names.begin(), linked_function_names.end(), unreachable), linked_function_names.end());
+
 
     /////////////////////////////
     // REPORT TOTAL BYTECODE SIZE
@@ -1065,162 +1558,59 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
     //
     // BYTECODE IS GENERATED HERE BUT NOT YET WRITTEN TO FILE
     // THIS MUST BE GENERATED HERE TO OBTAIN FILL JUMP TABLE
+    //
+    // functions and blocks are assembled independently of each other (in parallel if more than
+    // one job is allowed) and then laid out in the order in which they are defined so the output
+    // does not depend on the number of jobs
     map<string, tuple<uint64_t, byte*> > functions_bytecode;
     map<string, tuple<uint64_t, byte*> > block_bodies_bytecode;
-    uint64_t functions_section_size = 0;
-    uint64_t block_bodies_section_size = 0;
-
     vector<tuple<uint64_t, uint64_t> > jump_positions;
 
+    vector<assembled_t> assembled_blocks;
     for (string name : blocks.names) {
         // do not generate bytecode for blocks.bodies that were linked
         if (find(linked_block_names.begin(), linked_block_names.end(), name) != linked_block_names.end()) { continue; }
-
-        if (VERBOSE or DEBUG) {
-            cout << "[asm] message: generating bytecode for block \"" << name << '"';
-        }
-        uint64_t fun_bytes = 0;
-        try {
-            fun_bytes = Program::countBytes(blocks.bodies.at(name));
-            if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte " << block_bodies_section_size << ')' << endl;
-            }
-        } catch (const string& e) {
-            cout << "fatal: error during block size count (pre-assembling): " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << e.what() << endl;
-            exit(1);
-        }
-
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            assemble(func, blocks.bodies.at(name));
-        } catch (const string& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const char*& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble block '" << name << "' (" << e.what() << ')' << endl;
-            exit(1);
-        }
-
-        vector<uint64_t> jumps = func.jumps();
-        vector<uint64_t> jumps_absolute = func.jumpsAbsolute();
-
-        vector<tuple<uint64_t, uint64_t> > local_jumps;
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            uint64_t jmp = jumps[i];
-            local_jumps.push_back(tuple<int, int>(jmp, block_bodies_section_size));
-        }
-        func.calculateJumps(local_jumps);
-
-        byte* btcode = func.bytecode();
-
-        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
-        block_bodies_bytecode[name] = tuple<uint64_t, byte*>(func.size(), btcode);
-
-        // extend jump table with jumps from current block
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            uint64_t jmp = jumps[i];
-            if (DEBUG) {
-                cout << "[asm] debug: pushed relative jump to jump table: " << jmp << '+' << block_bodies_section_size << endl;
-            }
-            jump_table.push_back(jmp+block_bodies_section_size);
-        }
-
-        for (unsigned i = 0; i < jumps_absolute.size(); ++i) {
-            if (DEBUG) {
-                cout << "[asm] debug: pushed absolute jump to jump table: " << jumps_absolute[i] << "+0" << endl;
-            }
-            jump_positions.push_back(tuple<int, int>(jumps_absolute[i]+block_bodies_section_size, 0));
-        }
-
-        block_bodies_section_size += func.size();
+        assembled_blocks.emplace_back(name, "block", blocks.bodies.at(name), blocks.bodies.at(name));
     }
-
-    // functions section size, must be offset by the size of block section
-    functions_section_size = block_bodies_section_size;
-
+    vector<assembled_t> assembled_functions;
+    vector<string> entry_function_body;
     for (string name : functions.names) {
         // do not generate bytecode for functions that were linked
         if (find(linked_function_names.begin(), linked_function_names.end(), name) != linked_function_names.end()) { continue; }
-
-        if (VERBOSE or DEBUG) {
-            cout << "[asm] message: generating bytecode for function \"" << name << '"';
-        }
-        uint64_t fun_bytes = 0;
-        try {
-            fun_bytes = Program::countBytes(name == ENTRY_FUNCTION_NAME ? filter(functions.bodies.at(name)) : functions.bodies.at(name));
-            if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte " << functions_section_size << ')' << endl;
-            }
-        } catch (const string& e) {
-            cout << "fatal: error during function size count (pre-assembling): " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << e.what() << endl;
-            exit(1);
-        }
-
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            assemble(func, functions.bodies.at(name));
-        } catch (const string& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const char*& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble function '" << name << "' (" << e.what() << ')' << endl;
-            exit(1);
+        if (name == ENTRY_FUNCTION_NAME) {
+            entry_function_body = filter(functions.bodies.at(name));
+            assembled_functions.emplace_back(name, "function", entry_function_body, functions.bodies.at(name));
+        } else {
+            assembled_functions.emplace_back(name, "function", functions.bodies.at(name), functions.bodies.at(name));
         }
+    }
 
-        vector<uint64_t> jumps = func.jumps();
-        vector<uint64_t> jumps_absolute = func.jumpsAbsolute();
-
-        vector<tuple<uint64_t, uint64_t> > local_jumps;
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            uint64_t jmp = jumps[i];
-            local_jumps.push_back(tuple<int, int>(jmp, functions_section_size));
+    // bytecode of unchanged functions and blocks is reused if object cache is enabled
+    string cache_directory = support::env::getvar("VIUACACHE");
+    vector<uint64_t> cache_key { OBJECT_CACHE_REVISION, VIUA_FORMAT_REVISION };
+    if (cache_directory.size() and support::env::identify("/proc/self/exe", cache_key)) {
+        for (auto& each : assembled_blocks) {
+            each.cache_path = objectCachePath(cache_directory, filename, each);
         }
-        func.calculateJumps(local_jumps);
-
-        byte* btcode = func.bytecode();
-
-        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
-        functions_bytecode[name] = tuple<uint64_t, byte*>{func.size(), btcode};
-
-        // extend jump table with jumps from current function
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            uint64_t jmp = jumps[i];
-            if (DEBUG) {
-                cout << "[asm] debug: pushed relative jump to jump table: " << jmp << '+' << functions_section_size << endl;
-            }
-            jump_table.push_back(jmp+functions_section_size);
+        for (auto& each : assembled_functions) {
+            each.cache_path = objectCachePath(cache_directory, filename, each);
         }
+    }
 
-        for (unsigned i = 0; i < jumps_absolute.size(); ++i) {
-            if (DEBUG) {
-                cout << "[asm] debug: pushed absolute jump to jump table: " << jumps_absolute[i] << "+0" << endl;
-            }
-            jump_positions.push_back(tuple<int, int>(jumps_absolute[i]+functions_section_size, 0));
-        }
+    // debugging output of functions assembled concurrently would be interleaved
+    assembleInParallel(assembled_blocks, assembled_functions, (DEBUG ? 1 : flags.jobs), cache_key);
 
-        functions_section_size += func.size();
-    }
+    uint64_t block_bodies_section_size = layOut(assembled_blocks, block_bodies_bytecode, symbol_table, jump_table, jump_positions, symbol_references, 0);
+    // functions section must be offset by the size of block section
+    layOut(assembled_functions, functions_bytecode, symbol_table, jump_table, jump_positions, symbol_references, block_bodies_section_size);
 
 
     ////////////////////////////////////////
     // CREATE OFSTREAM TO WRITE BYTECODE OUT
     ofstream out(compilename, ios::out | ios::binary);
 
-    out.write(VIUA_MAGIC_NUMBER, sizeof(char)*5);
+    out.write(VIUA_MAGIC_NUMBER, sizeof(char)*4);
+    out.write(reinterpret_cast<const char*>(&VIUA_FORMAT_REVISION), sizeof(VIUA_FORMAT_REVISION));
     if (flags.as_lib) {
         out.write(&VIUA_LINKABLE, sizeof(ViuaBinaryType));
     } else {
@@ -1259,6 +1649,13 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
             jmp = jump_table[i];
             bwrite(out, jmp);
         }
+
+        // symbol reference table lets the linker remap symbol operands of the library
+        uint64_t total_symbol_references = symbol_references.size();
+        bwrite(out, total_symbol_references);
+        for (uint64_t ref : symbol_references) {
+            bwrite(out, ref);
+        }
     }
 
 
@@ -1288,13 +1685,48 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
 
     /////////////////////////////////////////////////////////////
     // WRITE BLOCK AND FUNCTION ENTRY POINT ADDRESSES TO BYTECODE
-    uint64_t functions_size_so_far = writeCodeBlocksSection(out, blocks, linked_block_names);
-    functions_size_so_far = writeCodeBlocksSection(out, functions, linked_function_names, functions_size_so_far);
+    vector<pair<string, uint64_t>> block_address_table;
+    vector<pair<string, uint64_t>> function_address_table;
+    uint64_t functions_size_so_far = writeCodeBlocksSection(out, blocks, linked_block_names, block_address_table);
+    functions_size_so_far = writeCodeBlocksSection(out, functions, linked_function_names, function_address_table, functions_size_so_far);
     for (string name : linked_function_names) {
         strwrite(out, name);
         // mapped address must come after name
         uint64_t address = function_addresses[name];
         bwrite(out, address);
+        function_address_table.emplace_back(name, address);
+    }
+
+
+    /////////////////////
+    // WRITE SYMBOL TABLE
+    uint64_t symbol_table_section_size = 0;
+    for (const auto& each : symbol_table.symbols()) {
+        symbol_table_section_size += (each.size() + 1); // +1 for null byte after each symbol
+    }
+    bwrite(out, symbol_table_section_size);
+    for (const auto& each : symbol_table.symbols()) {
+        strwrite(out, each);
+    }
+
+
+    /////////////////////////////////////////////////////////////
+    // WRITE HASHED FUNCTION AND BLOCK ADDRESS TABLES, AND REGISTER COUNT TABLE
+    // loader queries them in place instead of building maps from the lists above,
+    // and the machine uses register counts to allocate register sets no bigger than needed
+    for (const auto& name : functions.names) {
+        if (functions.bodies.count(name) == 0 or find(linked_function_names.begin(), linked_function_names.end(), name) != linked_function_names.end()) {
+            continue;
+        }
+        uint64_t register_count = assembler::registers::count(functions.bodies.at(name), blocks.bodies);
+        if (register_count) {
+            register_count_table.emplace_back(name, register_count);
+        }
+    }
+    for (const auto& table : {AddressTable::encode(function_address_table), AddressTable::encode(block_address_table), AddressTable::encode(register_count_table)}) {
+        uint64_t table_size = table.size();
+        bwrite(out, table_size);
+        out.write(reinterpret_cast<const char*>(table.data()), static_cast<streamsize>(table.size()));
     }
 
 
@@ -1302,6 +1734,14 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
     // WRITE BYTECODE SIZE
     bwrite(out, bytes);
 
+    ////////////////////////////////////////////////////////////////////
+    // PAD THE FILE SO THAT BYTECODE SECTION STARTS AT AN ALIGNED OFFSET
+    // this lets the loader map the module and execute the bytecode in place
+    uint64_t bytecode_offset = static_cast<uint64_t>(out.tellp());
+    for (uint64_t i = 0; i < ((VIUA_BYTECODE_SECTION_ALIGNMENT - (bytecode_offset % VIUA_BYTECODE_SECTION_ALIGNMENT)) % VIUA_BYTECODE_SECTION_ALIGNMENT); ++i) {
+        out.put('\0');
+    }
+
     byte* program_bytecode = new byte[bytes];
     uint64_t program_bytecode_used = 0;
 
@@ -1359,43 +1799,29 @@ int generate(const vector<string>& expanded_lines, vector<string>& ilines, invoc
 
     ////////////////////////////////////
     // WRITE STATICALLY LINKED LIBRARIES
-    uint64_t bytes_offset = current_link_offset;
-    for (tuple<string, uint64_t, byte*> lnk : linked_libs_bytecode) {
-        string lib_name;
-        byte* linked_bytecode;
-        uint64_t linked_size;
-        tie(lib_name, linked_size, linked_bytecode) = lnk;
-
+    // jumps and symbol operands of linked functions have already been adjusted when they were linked
+    for (const auto& lnk : linked_libs_bytecode) {
         if (VERBOSE or DEBUG) {
-            cout << "[linker] message: linked module \"" << lib_name <<  "\" written at offset " << bytes_offset << endl;
-        }
-
-        vector<uint64_t> linked_jumptable;
-        try {
-            linked_jumptable = linked_libs_jumptables[lib_name];
-        } catch (const std::out_of_range& e) {
-            cout << "[linker] fatal: could not find jumptable for '" << lib_name << "' (maybe not loaded?)" << endl;
-            exit(1);
+            cout << "[linker] message: linked module \"" << get<0>(lnk) <<  "\" written at offset " << program_bytecode_used << endl;
         }
 
-        uint64_t jmp, jmp_target;
-        for (unsigned i = 0; i < linked_jumptable.size(); ++i) {
-            jmp = linked_jumptable[i];
-            // we know what we're doing here
-            jmp_target = *reinterpret_cast<uint64_t*>(linked_bytecode+jmp);
-            if (DEBUG) {
-                cout << "[linker] adjusting jump: at position " << jmp << ", " << jmp_target << '+' << bytes_offset << " -> " << (jmp_target+bytes_offset) << endl;
-            }
-            *reinterpret_cast<uint64_t*>(linked_bytecode+jmp) += bytes_offset;
-        }
-
-        for (decltype(linked_size) i = 0; i < linked_size; ++i) {
-            program_bytecode[program_bytecode_used+i] = linked_bytecode[i];
-        }
-        program_bytecode_used += linked_size;
+        copy(get<1>(lnk).begin(), get<1>(lnk).end(), (program_bytecode+program_bytecode_used));
+        program_bytecode_used += get<1>(lnk).size();
     }
 
     out.write(reinterpret_cast<const char*>(program_bytecode), static_cast<std::streamsize>(bytes));
+
+
+    ////////////////////////////////////////////////
+    // WRITE LINE TABLE (EMPTY UNLESS IT IS REQUESTED)
+    // it is placed after the bytecode so that the machine does not touch it unless it looks lines up
+    vector<byte> line_table;
+    if (flags.line_info) {
+        line_table = LineTable::encode(filename, lineTableEntries(assembled_blocks, assembled_functions, ilines, sourceLinesOfInstructionLines(expanded_lines, expanded_lines_to_source_lines)));
+    }
+    uint64_t line_table_size = line_table.size();
+    bwrite(out, line_table_size);
+    out.write(reinterpret_cast<const char*>(line_table.data()), static_cast<streamsize>(line_table.size()));
     out.close();
 
     return 0;
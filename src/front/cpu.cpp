@@ -17,24 +17,35 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <csignal>
 #include <cstdlib>
 #include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <vector>
+#include <memory>
 #include <viua/version.h>
 #include <viua/bytecode/maps.h>
 #include <viua/cg/disassembler/disassembler.h>
 #include <viua/program.h>
 #include <viua/printutils.h>
 #include <viua/front/vm.h>
+#include <viua/scheduler/profiler.h>
+#include <viua/scheduler/statistics.h>
+#include <viua/scheduler/allocations.h>
+#include <viua/scheduler/tracer.h>
+#include <viua/scheduler/perfmap.h>
 using namespace std;
 
 
 const char* NOTE_LOADED_ASM = "note: seems like you have loaded an .asm file which cannot be run on CPU without prior compilation";
 
 
+static void requestStatisticsDump(int) {
+    viua::scheduler::DispatchStatistics::requestDump();
+}
+
 static bool usage(const string program, const vector<string>& args) {
     bool show_help = false;
     bool show_version = false;
@@ -78,6 +89,16 @@ static bool usage(const string program, const vector<string>& args) {
         cout << "    " << "-V, --version            - show version\n"
              << "    " << "-h, --help               - display this message\n"
              << "    " << "-v, --verbose            - show verbose output\n"
+             << "    " << "--profile=<file>         - sample running processes and write profile to <file>\n"
+             << "    " << "--profile-interval=<us>  - sampling interval in microseconds (default: 1000)\n"
+             << "    " << "--stats=<file>           - count executed instructions and calls, and write them to <file>\n"
+             << "    " << "                           as JSON on exit and when SIGUSR1 is received\n"
+             << "    " << "--allocations=<file>     - profile allocations of objects, and write the profile to <file>\n"
+             << "    " << "--allocations-interval=<ms>\n"
+             << "    " << "                         - interval between snapshots of live objects (default: 100)\n"
+             << "    " << "--trace=<file>           - record scheduling events, and write them to <file> as a Chrome trace\n"
+             << "    " << "--trace-buffer=<events>  - number of most recent events kept in the trace (default: 65536)\n"
+             << "    " << "--perf-map               - write /tmp/perf-<pid>.map so that Linux perf shows Viua functions\n"
              ;
     }
 
@@ -91,6 +112,40 @@ int main(int argc, char* argv[]) {
         args.push_back(argv[i]);
     }
 
+    // profiling options must come before the executable
+    string profile_path = "";
+    unsigned profile_interval = 1000;
+    string statistics_path = "";
+    string allocations_path = "";
+    unsigned allocations_interval = 100;
+    string trace_path = "";
+    unsigned trace_buffer = 65536;
+    bool perf_map_enabled = false;
+    while (args.size() and (str::startswith(args[0], "--profile") or str::startswith(args[0], "--stats") or str::startswith(args[0], "--allocations") or str::startswith(args[0], "--trace") or args[0] == "--perf-map")) {
+        string option = args[0];
+        args.erase(args.begin());
+        if (str::startswith(option, "--stats=")) {
+            statistics_path = option.substr(8);
+        } else if (str::startswith(option, "--allocations=")) {
+            allocations_path = option.substr(14);
+        } else if (str::startswith(option, "--allocations-interval=") and str::isnum(option.substr(23), false) and option.size() < 33) {
+            allocations_interval = static_cast<unsigned>(stoul(option.substr(23)));
+        } else if (option == "--perf-map") {
+            perf_map_enabled = true;
+        } else if (str::startswith(option, "--trace=")) {
+            trace_path = option.substr(8);
+        } else if (str::startswith(option, "--trace-buffer=") and str::isnum(option.substr(15), false) and option.size() < 25 and stoul(option.substr(15)) > 0) {
+            trace_buffer = static_cast<unsigned>(stoul(option.substr(15)));
+        } else if (str::startswith(option, "--profile=")) {
+            profile_path = option.substr(10);
+        } else if (str::startswith(option, "--profile-interval=") and str::isnum(option.substr(19), false) and option.size() < 29 and stoul(option.substr(19)) > 0) {
+            profile_interval = static_cast<unsigned>(stoul(option.substr(19)));
+        } else {
+            cout << "error: invalid option: " << option << endl;
+            return 1;
+        }
+    }
+
     if (usage(argv[0], args)) { return 0; }
 
     if (args.size() == 0) {
@@ -110,8 +165,66 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    if (profile_path.size() and not ofstream(profile_path)) {
+        cout << "fatal: could not open profile file: " << profile_path << endl;
+        return 1;
+    }
+    if (statistics_path.size() and not ofstream(statistics_path)) {
+        cout << "fatal: could not open statistics file: " << statistics_path << endl;
+        return 1;
+    }
+    if (allocations_path.size() and not ofstream(allocations_path)) {
+        cout << "fatal: could not open allocation profile file: " << allocations_path << endl;
+        return 1;
+    }
+    if (trace_path.size() and not ofstream(trace_path)) {
+        cout << "fatal: could not open trace file: " << trace_path << endl;
+        return 1;
+    }
+    if (perf_map_enabled and not viua::scheduler::PerfMap::supported()) {
+        cout << "fatal: perf maps are not supported on this platform" << endl;
+        return 1;
+    }
+
+    // allocation profiler must outlive the CPU because threads of the CPU allocate objects until they are stopped
+    unique_ptr<viua::scheduler::AllocationProfiler> allocations;
+
     CPU cpu;
 
+    unique_ptr<viua::scheduler::Profiler> profiler;
+    if (profile_path.size()) {
+        profiler.reset(new viua::scheduler::Profiler(profile_path, profile_interval));
+        cpu.profiler = profiler.get();
+    }
+
+    unique_ptr<viua::scheduler::DispatchStatistics> statistics;
+    if (statistics_path.size()) {
+        statistics.reset(new viua::scheduler::DispatchStatistics(statistics_path));
+        cpu.statistics = statistics.get();
+        signal(SIGUSR1, requestStatisticsDump);
+    }
+
+    if (allocations_path.size()) {
+        allocations.reset(new viua::scheduler::AllocationProfiler(allocations_path, allocations_interval));
+        cpu.allocations = allocations.get();
+    }
+
+    unique_ptr<viua::scheduler::Tracer> tracer;
+    if (trace_path.size()) {
+        tracer.reset(new viua::scheduler::Tracer(trace_path, trace_buffer));
+        cpu.tracer = tracer.get();
+    }
+
+    unique_ptr<viua::scheduler::PerfMap> perf_map;
+    if (perf_map_enabled) {
+        perf_map.reset(new viua::scheduler::PerfMap());
+        if (not perf_map->good()) {
+            cout << "fatal: could not open perf map: " << perf_map->path() << endl;
+            return 1;
+        }
+        cpu.perf_map = perf_map.get();
+    }
+
     try {
         viua::front::vm::initialise(&cpu, filename, args);
     } catch (const char *e) {
@@ -144,5 +257,25 @@ int main(int argc, char* argv[]) {
     // the catch (...) is intentionally omitted, if we can't provide useful information about
     // the error it's better to just crash
 
+    if (profiler) {
+        profiler->stop();
+        if (not profiler->write()) {
+            cout << "error: could not write profile: " << profile_path << endl;
+            return 1;
+        }
+    }
+    if (statistics and not statistics->write()) {
+        cout << "error: could not write statistics: " << statistics_path << endl;
+        return 1;
+    }
+    if (allocations and not allocations->write()) {
+        cout << "error: could not write allocation profile: " << allocations_path << endl;
+        return 1;
+    }
+    if (tracer and not tracer->write()) {
+        cout << "error: could not write trace: " << trace_path << endl;
+        return 1;
+    }
+
     return cpu.exit();
 }
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <tuple>
@@ -150,7 +151,8 @@ int main(int argc, char* argv[]) {
     }
 
     uint64_t bytes = loader.getBytecodeSize();
-    byte* bytecode = loader.getBytecode();
+    byte* bytecode = loader.getMappedBytecode();
+    vector<string> symbols = loader.getSymbols();
 
     map<string, uint64_t> function_address_mapping = loader.getFunctionAddresses();
     vector<string> functions = loader.getFunctions();
@@ -271,7 +273,7 @@ int main(int argc, char* argv[]) {
             string instruction;
             try {
                 unsigned size;
-                tie(instruction, size) = disassembler::instruction((bytecode+element_address_mapping[name]+j));
+                tie(instruction, size) = disassembler::instruction((bytecode+element_address_mapping[name]+j), &symbols);
                 oss << "    " << instruction << '\n';
                 j += size;
             } catch (const out_of_range& e) {
@@ -17,24 +17,128 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <unistd.h>
+#include <climits>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <viua/front/vm.h>
 using namespace std;
 
 
+/*  Image cache.
+ *
+ *  Symbols of an executable that refer to its own functions and blocks are resolved ahead of time, and stored in
+ *  a cache file in directory named by VIUACACHE environment variable so that later runs of the same executable by
+ *  the same VM do not have to resolve them.
+ *  Cache files are keyed by the identity of the executable and the VM binary (device, inode, size, and modification
+ *  time of both files) instead of their contents, which would have to be read and hashed at every start.
+ */
+static const char* IMAGE_CACHE_MAGIC = "VIUAIMGC";
+static const uint64_t IMAGE_CACHE_REVISION = 1;
+
+static bool imageCacheKey(const string& program, uint64_t symbols, vector<uint64_t>& key) {
+    key.push_back(IMAGE_CACHE_REVISION);
+    key.push_back(VIUA_FORMAT_REVISION);
+    key.push_back(symbols);
+    return (support::env::identify(program, key) and support::env::identify("/proc/self/exe", key));
+}
+
+static string imageCachePath(const string& directory, const string& program) {
+    char* resolved = realpath(program.c_str(), nullptr);
+    string absolute = (resolved ? string(resolved) : program);
+    free(resolved);
+
+    ostringstream path;
+    path << directory << '/' << hex << AddressTable::hash(absolute) << ".vcache";
+    return path.str();
+}
+
+static vector<viua::cpu::PreparedSymbol> readImageCache(const string& path, const vector<uint64_t>& key) {
+    vector<viua::cpu::PreparedSymbol> prepared;
+
+    ifstream in(path, ios::binary);
+    string magic(8, '\0');
+    vector<uint64_t> cached_key(key.size());
+    in.read(&magic[0], static_cast<streamsize>(magic.size()));
+    in.read(reinterpret_cast<char*>(cached_key.data()), static_cast<streamsize>(cached_key.size() * sizeof(uint64_t)));
+    if ((not in) or magic != IMAGE_CACHE_MAGIC or cached_key != key) {
+        return prepared;
+    }
+
+    // the key includes number of symbols
+    prepared.resize(key.at(2));
+    in.read(reinterpret_cast<char*>(prepared.data()), static_cast<streamsize>(prepared.size() * sizeof(viua::cpu::PreparedSymbol)));
+    if (not in) {
+        prepared.clear();
+    }
+    return prepared;
+}
+
+static void writeImageCache(const string& path, const vector<uint64_t>& key, const vector<viua::cpu::PreparedSymbol>& prepared) {
+    // other VM processes may be reading the cache so it is replaced atomically
+    string temporary_path = (path + '.' + to_string(getpid()));
+    ofstream out(temporary_path, ios::binary);
+    out.write(IMAGE_CACHE_MAGIC, 8);
+    out.write(reinterpret_cast<const char*>(key.data()), static_cast<streamsize>(key.size() * sizeof(uint64_t)));
+    out.write(reinterpret_cast<const char*>(prepared.data()), static_cast<streamsize>(prepared.size() * sizeof(viua::cpu::PreparedSymbol)));
+    out.close();
+
+    if ((not out) or rename(temporary_path.c_str(), path.c_str()) == -1) {
+        // failing to write the cache is not an error, the program just runs without it
+        unlink(temporary_path.c_str());
+    }
+}
+
+static vector<viua::cpu::PreparedSymbol> prepareSymbols(const vector<string>& symbols, const AddressTable& functions, const AddressTable& blocks) {
+    vector<viua::cpu::PreparedSymbol> prepared;
+    for (const auto& name : symbols) {
+        viua::cpu::PreparedSymbol entry { viua::cpu::PreparedSymbol::NONE, viua::cpu::PreparedSymbol::NONE };
+        if (not functions.find(name, entry.function)) {
+            entry.function = viua::cpu::PreparedSymbol::NONE;
+            if (not blocks.find(name, entry.block)) {
+                entry.block = viua::cpu::PreparedSymbol::NONE;
+            }
+        }
+        prepared.push_back(entry);
+    }
+    return prepared;
+}
+
+
 void viua::front::vm::initialise(CPU *cpu, const string& program, vector<string> args) {
     Loader loader(program);
     loader.executable();
 
     uint64_t bytes = loader.getBytecodeSize();
-    byte* bytecode = loader.getBytecode();
+    byte* bytecode = loader.getMappedBytecode();
 
-    map<string, uint64_t> function_address_mapping = loader.getFunctionAddresses();
-    for (auto p : function_address_mapping) { cpu->mapfunction(p.first, p.second); }
-    for (auto p : loader.getBlockAddresses()) { cpu->mapblock(p.first, p.second); }
+    vector<string> symbols = loader.getSymbols();
+    AddressTable functions = loader.getFunctionTable();
+    AddressTable blocks = loader.getBlockTable();
+    cpu->addresses(functions, blocks, loader.getRegisterCountTable());
+    cpu->lines(loader.getLineTable());
+
+    string cache_directory = support::env::getvar("VIUACACHE");
+    vector<uint64_t> cache_key;
+    if (cache_directory.size() and imageCacheKey(program, symbols.size(), cache_key)) {
+        string cache_path = imageCachePath(cache_directory, program);
+        vector<viua::cpu::PreparedSymbol> prepared = readImageCache(cache_path, cache_key);
+        if (prepared.empty() and not symbols.empty()) {
+            prepared = prepareSymbols(symbols, functions, blocks);
+            writeImageCache(cache_path, cache_key, prepared);
+        }
+        cpu->prepared(prepared);
+    }
 
     cpu->commandline_arguments = args;
 
-    cpu->load(bytecode).bytes(bytes);
+    // linking is eager unless requested otherwise by environment
+    string lazy_linking = support::env::getvar("VIUALAZYLINK");
+    cpu->lazy_linking = (lazy_linking.size() and lazy_linking != "0");
+
+    cpu->load(loader.getImage(), bytecode).bytes(bytes).symbols(symbols);
 }
 
 void viua::front::vm::load_standard_prototypes(CPU* cpu) {
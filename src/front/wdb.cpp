@@ -1072,6 +1072,12 @@ int main(int argc, char* argv[]) {
     viua::front::vm::initialise(&cpu, filename, args);
     viua::front::vm::load_standard_prototypes(&cpu);
 
+    // debugger lists functions and blocks by name so they are mapped
+    Loader loader(filename);
+    loader.executable();
+    for (auto p : loader.getFunctionAddresses()) { cpu.mapfunction(p.first, p.second); }
+    for (auto p : loader.getBlockAddresses()) { cpu.mapblock(p.first, p.second); }
+
     string homedir(getenv("HOME"));
     ifstream local_rc_file(homedir + RC_FILENAME);
     ifstream global_rc_file("/etc/viuavm/dbrc");
@@ -17,9 +17,13 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
-#include <fstream>
 #include <sstream>
 #include <tuple>
 #include <string>
@@ -32,6 +36,249 @@
 using namespace std;
 
 
+MappedModule::MappedModule(const string& path): address(nullptr), length(0) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        throw ("failed to open file: " + path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        throw ("failed to stat file: " + path);
+    }
+    length = static_cast<uint64_t>(st.st_size);
+
+    if (length) {
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw ("failed to map file: " + path);
+        }
+        address = static_cast<byte*>(mapping);
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+}
+MappedModule::~MappedModule() {
+    if (address) {
+        munmap(address, length);
+    }
+}
+byte* MappedModule::data() const {
+    return address;
+}
+uint64_t MappedModule::size() const {
+    return length;
+}
+
+
+const uint64_t AddressTable::EMPTY_SLOT = UINT64_MAX;
+static const uint64_t ADDRESS_TABLE_SLOT_SIZE = (3 * sizeof(uint64_t));
+
+static uint64_t readword(const byte* source) {
+    // tables are not aligned inside module files so words must not be dereferenced directly
+    uint64_t word;
+    memcpy(&word, source, sizeof(word));
+    return word;
+}
+static void writeword(vector<byte>& destination, uint64_t at, uint64_t word) {
+    memcpy(destination.data()+at, &word, sizeof(word));
+}
+
+uint64_t AddressTable::hash(const string& name) {
+    /** FNV-1a hash of a name.
+     *  Must not change between releases since it is used for tables stored in module files.
+     */
+    uint64_t h = 14695981039346656037ULL;
+    for (const char c : name) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+vector<byte> AddressTable::encode(const vector<pair<string, uint64_t>>& entries) {
+    /** Encodes a table in the format in which it is stored in module files.
+     *  Load factor of the table is kept at or below 1/2.
+     */
+    uint64_t slot_count = 0;
+    if (entries.size()) {
+        slot_count = 2;
+        while (slot_count < (entries.size() * 2)) {
+            slot_count *= 2;
+        }
+    }
+
+    uint64_t names_size = 0;
+    for (const auto& each : entries) {
+        names_size += (each.first.size() + 1);
+    }
+
+    vector<byte> encoded((2 * sizeof(uint64_t)) + (slot_count * ADDRESS_TABLE_SLOT_SIZE) + names_size, 0);
+    writeword(encoded, 0, slot_count);
+    writeword(encoded, sizeof(uint64_t), entries.size());
+
+    const uint64_t slots_base = (2 * sizeof(uint64_t));
+    for (uint64_t i = 0; i < slot_count; ++i) {
+        writeword(encoded, (slots_base + (i * ADDRESS_TABLE_SLOT_SIZE) + sizeof(uint64_t)), EMPTY_SLOT);
+    }
+
+    const uint64_t names_base = (slots_base + (slot_count * ADDRESS_TABLE_SLOT_SIZE));
+    uint64_t name_offset = 0;
+    for (const auto& each : entries) {
+        uint64_t h = hash(each.first);
+        uint64_t i = (h & (slot_count - 1));
+        while (readword(encoded.data() + slots_base + (i * ADDRESS_TABLE_SLOT_SIZE) + sizeof(uint64_t)) != EMPTY_SLOT) {
+            i = ((i + 1) & (slot_count - 1));
+        }
+        uint64_t slot = (slots_base + (i * ADDRESS_TABLE_SLOT_SIZE));
+        writeword(encoded, slot, h);
+        writeword(encoded, (slot + sizeof(uint64_t)), name_offset);
+        writeword(encoded, (slot + (2 * sizeof(uint64_t))), each.second);
+
+        memcpy(encoded.data() + names_base + name_offset, each.first.c_str(), each.first.size() + 1);
+        name_offset += (each.first.size() + 1);
+    }
+
+    return encoded;
+}
+
+bool AddressTable::find(const string& name, uint64_t& address) const {
+    return find(name, hash(name), address);
+}
+bool AddressTable::find(const string& name, uint64_t name_hash, uint64_t& address) const {
+    /** Looks name up in the table.
+     *  Hash is supplied by the caller so that a name can be looked up in many tables after being hashed once.
+     */
+    if (slot_count == 0) {
+        return false;
+    }
+    for (uint64_t i = (name_hash & (slot_count - 1));; i = ((i + 1) & (slot_count - 1))) {
+        const byte* slot = (slots + (i * ADDRESS_TABLE_SLOT_SIZE));
+        uint64_t name_offset = readword(slot + sizeof(uint64_t));
+        if (name_offset == EMPTY_SLOT) {
+            return false;
+        }
+        if (readword(slot) == name_hash and name_offset < names_size and name == (names + name_offset)) {
+            address = readword(slot + (2 * sizeof(uint64_t)));
+            return true;
+        }
+    }
+}
+uint64_t AddressTable::size() const {
+    return entry_count;
+}
+
+AddressTable::AddressTable(): storage(nullptr), slots(nullptr), slot_count(0), entry_count(0), names(nullptr), names_size(0) {
+}
+AddressTable::AddressTable(const byte* encoded, uint64_t encoded_size): AddressTable() {
+    /** Creates a view of an encoded table.
+     *  The encoded table must outlive the view.
+     */
+    if (encoded_size < (2 * sizeof(uint64_t))) {
+        throw string("truncated address table");
+    }
+    slot_count = readword(encoded);
+    entry_count = readword(encoded + sizeof(uint64_t));
+    if ((slot_count & (slot_count - 1)) or entry_count > slot_count or ((encoded_size - (2 * sizeof(uint64_t))) / ADDRESS_TABLE_SLOT_SIZE) < slot_count) {
+        throw string("malformed address table");
+    }
+    slots = (encoded + (2 * sizeof(uint64_t)));
+    names = reinterpret_cast<const char*>(slots + (slot_count * ADDRESS_TABLE_SLOT_SIZE));
+    names_size = (encoded_size - (2 * sizeof(uint64_t)) - (slot_count * ADDRESS_TABLE_SLOT_SIZE));
+    if (slot_count == entry_count and slot_count) {
+        // lookups of missing names would never terminate
+        throw string("malformed address table");
+    }
+}
+AddressTable::AddressTable(vector<byte> encoded): AddressTable() {
+    /** Creates a table owning its encoded form.
+     */
+    auto owned = make_shared<vector<byte>>(std::move(encoded));
+    *this = AddressTable(owned->data(), owned->size());
+    storage = owned;
+}
+
+
+static void writeLEB128(vector<byte>& destination, uint64_t value) {
+    do {
+        byte b = (value & 0x7f);
+        value >>= 7;
+        destination.push_back(value ? (b | 0x80) : b);
+    } while (value);
+}
+static bool readLEB128(const byte*& source, const byte* end, uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; source < end and shift < 64; shift += 7) {
+        byte b = *source++;
+        value |= (static_cast<uint64_t>(b & 0x7f) << shift);
+        if (not (b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<byte> LineTable::encode(const string& file, const vector<pair<uint64_t, uint64_t>>& entries) {
+    /** Encodes a table in the format in which it is stored in module files.
+     *  Entries (offsets paired with lines) must be sorted by offset.
+     */
+    vector<byte> encoded(file.begin(), file.end());
+    encoded.push_back('\0');
+
+    uint64_t previous_offset = 0, previous_line = 0;
+    for (const auto& each : entries) {
+        int64_t line_delta = static_cast<int64_t>(each.second - previous_line);
+        writeLEB128(encoded, (each.first - previous_offset));
+        writeLEB128(encoded, ((static_cast<uint64_t>(line_delta) << 1) ^ static_cast<uint64_t>(line_delta >> 63)));
+        previous_offset = each.first;
+        previous_line = each.second;
+    }
+
+    return encoded;
+}
+
+void LineTable::decode() {
+    /** Decodes entries of the table.
+     *  Malformed tables are decoded up to the first malformed entry.
+     */
+    const byte* end = (encoded + encoded_size);
+    const byte* name_end = find(encoded, end, '\0');
+    source_file = string(reinterpret_cast<const char*>(encoded), reinterpret_cast<const char*>(name_end));
+
+    const byte* entry = (name_end + (name_end < end));
+    uint64_t offset = 0, line = 0, offset_delta = 0, line_delta = 0;
+    while (entry < end and readLEB128(entry, end, offset_delta) and readLEB128(entry, end, line_delta)) {
+        offset += offset_delta;
+        line += ((line_delta >> 1) ^ (~(line_delta & 1) + 1));
+        offsets.push_back(offset);
+        lines.push_back(line);
+    }
+}
+
+const string& LineTable::file() {
+    call_once(decoded, &LineTable::decode, this);
+    return source_file;
+}
+uint64_t LineTable::line(uint64_t offset) {
+    /** Returns line of the source file that bytecode at given offset was assembled from, or
+     *  zero if the line is not known.
+     */
+    call_once(decoded, &LineTable::decode, this);
+    auto found = upper_bound(offsets.begin(), offsets.end(), offset);
+    if (found == offsets.begin()) {
+        return 0;
+    }
+    return lines[static_cast<decltype(lines)::size_type>((found - offsets.begin()) - 1)];
+}
+
+LineTable::LineTable(shared_ptr<MappedModule> i, const byte* e, uint64_t s): image(i), encoded(e), encoded_size(s) {
+    /** Creates a view of an encoded table inside the mapping of a module.
+     */
+}
+
+
 IdToAddressMapping Loader::loadmap(char* bytedump, const uint64_t& bytedump_size) {
     vector<string> order;
     map<string, uint64_t> mapping;
@@ -75,173 +322,215 @@ void Loader::calculateFunctionSizes() {
     }
 }
 
-void Loader::loadMagicNumber(ifstream& in) {
-    char magic_number[5];
-    in.read(magic_number, sizeof(char)*5);
-    if (magic_number[4] != '\0') {
-        throw "invalid magic number";
-    }
-    if (string(magic_number) != string(VIUA_MAGIC_NUMBER)) {
-        throw (string("invalid magic number: ") + string(magic_number));
-    }
-}
-
-void Loader::assumeBinaryType(ifstream& in, ViuaBinaryType assumed_binary_type) {
-    char bt;
-    in.read(&bt, sizeof(decltype(bt)));
-    if (bt != assumed_binary_type) {
-        ostringstream error;
-        error << "not a " << (assumed_binary_type == VIUA_LINKABLE ? "linkable" : "executable") << " file: " << path;
-        throw error.str();
+byte* Loader::take(uint64_t n) {
+    /** Returns pointer to next n bytes of the mapped module, and advances past them.
+     */
+    if (n > (image->size() - offset)) {
+        throw ("truncated module: " + path);
     }
+    byte* here = image->data() + offset;
+    offset += n;
+    return here;
 }
+map<string, string> Loader::readStringMap() {
+    uint64_t map_size = readvalue<uint64_t>();
+    char *buffer = reinterpret_cast<char*>(take(map_size));
 
-static map<string, string> load_meta_information_map(ifstream& in) {
-    uint64_t meta_information_map_size = 0;
-    readinto(in, &meta_information_map_size);
-
-    unique_ptr<char[]> meta_information_map_buffer(new char[meta_information_map_size]);
-    in.read(meta_information_map_buffer.get(), static_cast<std::streamsize>(meta_information_map_size));
+    map<string, string> string_map;
 
-    map<string, string> meta_information_map;
-
-    char *buffer = meta_information_map_buffer.get();
     uint64_t i = 0;
     string key, value;
-    while (i < meta_information_map_size) {
+    while (i < map_size) {
         key = string(buffer+i);
         i += (key.size() + 1);
         value = string(buffer+i);
         i += (value.size() + 1);
-        meta_information_map[key] = value;
+        string_map[key] = value;
     }
 
-    return meta_information_map;
-}
-void Loader::loadMetaInformation(ifstream& in) {
-    meta_information = load_meta_information_map(in);
+    return string_map;
 }
-
-static vector<string> load_string_list(ifstream& in) {
-    uint64_t signatures_section_size = 0;
-    readinto(in, &signatures_section_size);
-
-    unique_ptr<char[]> signatures_section_buffer(new char[signatures_section_size]);
-    in.read(signatures_section_buffer.get(), static_cast<std::streamsize>(signatures_section_size));
+vector<string> Loader::readStringList() {
+    uint64_t list_size = readvalue<uint64_t>();
+    char *buffer = reinterpret_cast<char*>(take(list_size));
 
     uint64_t i = 0;
-    char *buffer = signatures_section_buffer.get();
-    string sig;
+    string s;
     vector<string> strings_list;
-    while (i < signatures_section_size) {
-        sig = string(buffer+i);
-        i += (sig.size() + 1);
-        strings_list.push_back(sig);
+    while (i < list_size) {
+        s = string(buffer+i);
+        i += (s.size() + 1);
+        strings_list.push_back(s);
     }
 
     return strings_list;
 }
-void Loader::loadExternalSignatures(ifstream& in) {
-    external_signatures = load_string_list(in);
-}
-void Loader::loadExternalBlockSignatures(ifstream& in) {
-    external_signatures_block = load_string_list(in);
-}
 
-void Loader::loadJumpTable(ifstream& in) {
-    // load jump table
-    uint64_t lib_total_jumps;
-    readinto(in, &lib_total_jumps);
+void Loader::open() {
+    image = make_shared<MappedModule>(path);
+    offset = 0;
+}
 
-    uint64_t lib_jmp;
-    for (uint64_t i = 0; i < lib_total_jumps; ++i) {
-        readinto(in, &lib_jmp);
-        jumps.push_back(lib_jmp);
+void Loader::loadMagicNumber() {
+    char *magic_number = reinterpret_cast<char*>(take(sizeof(char)*5));
+    if (string(magic_number, 4) != string(VIUA_MAGIC_NUMBER)) {
+        throw (string("invalid magic number: ") + string(magic_number, 4));
+    }
+    format_revision = static_cast<uint8_t>(magic_number[4]);
+    if (format_revision > VIUA_FORMAT_REVISION) {
+        ostringstream error;
+        error << "unsupported format revision " << static_cast<unsigned>(format_revision) << ": " << path;
+        throw error.str();
     }
 }
-void Loader::loadFunctionsMap(ifstream& in) {
-    uint64_t lib_function_ids_section_size = 0;
-    readinto(in, &lib_function_ids_section_size);
 
-    char *lib_buffer_function_ids = new char[lib_function_ids_section_size];
-    in.read(lib_buffer_function_ids, static_cast<std::streamsize>(lib_function_ids_section_size));
+void Loader::assumeBinaryType(ViuaBinaryType assumed_binary_type) {
+    char bt = readvalue<char>();
+    if (bt != assumed_binary_type) {
+        ostringstream error;
+        error << "not a " << (assumed_binary_type == VIUA_LINKABLE ? "linkable" : "executable") << " file: " << path;
+        throw error.str();
+    }
+}
 
-    vector<string> order;
-    map<string, uint64_t> mapping;
+void Loader::loadMetaInformation() {
+    meta_information = readStringMap();
+}
 
-    tie(order, mapping) = loadmap(lib_buffer_function_ids, lib_function_ids_section_size);
+void Loader::loadExternalSignatures() {
+    external_signatures = readStringList();
+}
+void Loader::loadExternalBlockSignatures() {
+    external_signatures_block = readStringList();
+}
 
-    for (string p : order) {
-        functions.push_back(p);
-        function_addresses[p] = mapping[p];
+void Loader::loadJumpTable() {
+    // load jump table
+    uint64_t lib_total_jumps = readvalue<uint64_t>();
+    for (uint64_t i = 0; i < lib_total_jumps; ++i) {
+        jumps.push_back(readvalue<uint64_t>());
     }
-    delete[] lib_buffer_function_ids;
 }
-void Loader::loadBlocksMap(ifstream& in) {
-    uint64_t lib_block_ids_section_size = 0;
-    readinto(in, &lib_block_ids_section_size);
-
-    char *lib_buffer_block_ids = new char[lib_block_ids_section_size];
-    in.read(lib_buffer_block_ids, static_cast<std::streamsize>(lib_block_ids_section_size));
+void Loader::loadSymbolReferences() {
+    if (format_revision < 2) {
+        return;
+    }
+    uint64_t total_symbol_references = readvalue<uint64_t>();
+    for (uint64_t i = 0; i < total_symbol_references; ++i) {
+        symbol_references.push_back(readvalue<uint64_t>());
+    }
+}
+void Loader::loadSymbolTable() {
+    if (format_revision < 2) {
+        // names are embedded in bytecode of older modules
+        return;
+    }
+    symbols = readStringList();
+}
+void Loader::loadFunctionsMap() {
+    uint64_t lib_function_ids_section_size = readvalue<uint64_t>();
+    functions_map_section = pair<char*, uint64_t>(reinterpret_cast<char*>(take(lib_function_ids_section_size)), lib_function_ids_section_size);
+}
+void Loader::loadBlocksMap() {
+    uint64_t lib_block_ids_section_size = readvalue<uint64_t>();
+    blocks_map_section = pair<char*, uint64_t>(reinterpret_cast<char*>(take(lib_block_ids_section_size)), lib_block_ids_section_size);
+}
+void Loader::loadAddressTables() {
+    if (format_revision < 3) {
+        // tables are built from name/address lists when requested
+        return;
+    }
+    uint64_t table_size = readvalue<uint64_t>();
+    function_table = AddressTable(take(table_size), table_size);
+    table_size = readvalue<uint64_t>();
+    block_table = AddressTable(take(table_size), table_size);
+
+    if (format_revision < 4) {
+        // register sets of functions from older modules are as big as their frames request
+        return;
+    }
+    table_size = readvalue<uint64_t>();
+    register_count_table = AddressTable(take(table_size), table_size);
+}
+void Loader::parseAddressMaps() {
+    if (address_maps_parsed) {
+        return;
+    }
+    address_maps_parsed = true;
 
     vector<string> order;
     map<string, uint64_t> mapping;
 
-    tie(order, mapping) = loadmap(lib_buffer_block_ids, lib_block_ids_section_size);
-
+    tie(order, mapping) = loadmap(blocks_map_section.first, blocks_map_section.second);
     for (string p : order) {
         blocks.push_back(p);
         block_addresses[p] = mapping[p];
     }
-    delete[] lib_buffer_block_ids;
+
+    tie(order, mapping) = loadmap(functions_map_section.first, functions_map_section.second);
+    for (string p : order) {
+        functions.push_back(p);
+        function_addresses[p] = mapping[p];
+    }
+
+    calculateFunctionSizes();
 }
-void Loader::loadBytecode(ifstream& in) {
-    in.read(reinterpret_cast<char*>(&size), sizeof(decltype(size)));
-    bytecode = new byte[size];
-    in.read(reinterpret_cast<char*>(bytecode), static_cast<std::streamsize>(size));
+void Loader::loadBytecode() {
+    size = readvalue<uint64_t>();
+    if (format_revision >= 1) {
+        // the writer pads the file so that bytecode section starts at an aligned offset
+        take((VIUA_BYTECODE_SECTION_ALIGNMENT - (offset % VIUA_BYTECODE_SECTION_ALIGNMENT)) % VIUA_BYTECODE_SECTION_ALIGNMENT);
+    }
+    bytecode = take(size);
+}
+void Loader::loadLineTable() {
+    if (format_revision < 5) {
+        return;
+    }
+    uint64_t table_size = readvalue<uint64_t>();
+    line_table_section = pair<byte*, uint64_t>(take(table_size), table_size);
 }
 
 Loader& Loader::load() {
-    ifstream in(path, ios::in | ios::binary);
-    if (!in) {
-        throw ("failed to open file: " + path);
-    }
+    open();
 
-    loadMagicNumber(in);
-    assumeBinaryType(in, VIUA_LINKABLE);
+    loadMagicNumber();
+    assumeBinaryType(VIUA_LINKABLE);
 
-    loadMetaInformation(in);
+    loadMetaInformation();
 
     // jump table must be loaded if loading a library
-    loadJumpTable(in);
-
-    loadExternalSignatures(in);
-    loadExternalBlockSignatures(in);
-    loadBlocksMap(in);
-    loadFunctionsMap(in);
-    loadBytecode(in);
-    calculateFunctionSizes();
+    loadJumpTable();
+    loadSymbolReferences();
+
+    loadExternalSignatures();
+    loadExternalBlockSignatures();
+    loadBlocksMap();
+    loadFunctionsMap();
+    loadSymbolTable();
+    loadAddressTables();
+    loadBytecode();
+    loadLineTable();
 
     return (*this);
 }
 
 Loader& Loader::executable() {
-    ifstream in(path, ios::in | ios::binary);
-    if (!in) {
-        throw ("fatal: failed to open file: " + path);
-    }
+    open();
 
-    loadMagicNumber(in);
-    assumeBinaryType(in, VIUA_EXECUTABLE);
+    loadMagicNumber();
+    assumeBinaryType(VIUA_EXECUTABLE);
 
-    loadMetaInformation(in);
+    loadMetaInformation();
 
-    loadExternalSignatures(in);
-    loadExternalBlockSignatures(in);
-    loadBlocksMap(in);
-    loadFunctionsMap(in);
-    loadBytecode(in);
-    calculateFunctionSizes();
+    loadExternalSignatures();
+    loadExternalBlockSignatures();
+    loadBlocksMap();
+    loadFunctionsMap();
+    loadSymbolTable();
+    loadAddressTables();
+    loadBytecode();
+    loadLineTable();
 
     return (*this);
 }
@@ -250,12 +539,26 @@ uint64_t Loader::getBytecodeSize() {
     return size;
 }
 byte* Loader::getBytecode() {
+    /** Returns a heap-allocated copy of the bytecode that the caller may modify and must delete[].
+     */
     byte* copy = new byte[size];
     for (uint64_t i = 0; i < size; ++i) {
         copy[i] = bytecode[i];
     }
     return copy;
 }
+byte* Loader::getMappedBytecode() {
+    /** Returns pointer to the bytecode inside the read-only mapping of the module.
+     *  The pointer is valid only as long as the image obtained from getImage() is kept alive.
+     */
+    return bytecode;
+}
+shared_ptr<MappedModule> Loader::getImage() {
+    return image;
+}
+uint8_t Loader::getFormatRevision() {
+    return format_revision;
+}
 
 vector<uint64_t> Loader::getJumps() {
     return jumps;
@@ -265,6 +568,13 @@ map<string, string> Loader::getMetaInformation() {
     return meta_information;
 }
 
+vector<string> Loader::getSymbols() {
+    return symbols;
+}
+vector<uint64_t> Loader::getSymbolReferences() {
+    return symbol_references;
+}
+
 vector<string> Loader::getExternalSignatures() {
     return external_signatures;
 }
@@ -274,18 +584,63 @@ vector<string> Loader::getExternalBlockSignatures() {
 }
 
 map<string, uint64_t> Loader::getFunctionAddresses() {
+    parseAddressMaps();
     return function_addresses;
 }
 map<string, uint64_t> Loader::getFunctionSizes() {
+    parseAddressMaps();
     return function_sizes;
 }
 vector<string> Loader::getFunctions() {
+    parseAddressMaps();
     return functions;
 }
 
 map<string, uint64_t> Loader::getBlockAddresses() {
+    parseAddressMaps();
     return block_addresses;
 }
 vector<string> Loader::getBlocks() {
+    parseAddressMaps();
     return blocks;
 }
+
+AddressTable Loader::getFunctionTable() {
+    /** Returns table of function addresses.
+     *  Tables of modules produced by older assemblers are built from name/address lists.
+     */
+    if (format_revision < 3) {
+        parseAddressMaps();
+        vector<pair<string, uint64_t>> entries;
+        for (const auto& each : functions) {
+            entries.emplace_back(each, function_addresses.at(each));
+        }
+        return AddressTable(AddressTable::encode(entries));
+    }
+    return function_table;
+}
+AddressTable Loader::getBlockTable() {
+    if (format_revision < 3) {
+        parseAddressMaps();
+        vector<pair<string, uint64_t>> entries;
+        for (const auto& each : blocks) {
+            entries.emplace_back(each, block_addresses.at(each));
+        }
+        return AddressTable(AddressTable::encode(entries));
+    }
+    return block_table;
+}
+AddressTable Loader::getRegisterCountTable() {
+    /** Returns table mapping names of functions to numbers of local registers they need.
+     *  Functions for which the number could not be computed by the assembler are not in the table.
+     */
+    return register_count_table;
+}
+shared_ptr<LineTable> Loader::getLineTable() {
+    /** Returns table mapping bytecode offsets to source lines, or null if the module has none.
+     */
+    if (line_table_section.second == 0) {
+        return nullptr;
+    }
+    return make_shared<LineTable>(image, line_table_section.first, line_table_section.second);
+}
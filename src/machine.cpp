@@ -21,6 +21,8 @@
 
 const char *ENTRY_FUNCTION_NAME = "__entry";
 const char *VIUA_MAGIC_NUMBER = "VIUA";
+const uint8_t VIUA_FORMAT_REVISION = 5;
+const uint64_t VIUA_BYTECODE_SECTION_ALIGNMENT = 4096;
 
 const ViuaBinaryType VIUA_LINKABLE = 'L';
 const ViuaBinaryType VIUA_EXECUTABLE = 'E';
@@ -21,16 +21,26 @@
 #include <algorithm>
 #include <viua/bytecode/opcodes.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/operand_types.h>
+#include <viua/support/pointer.h>
 #include <viua/types/integer.h>
 #include <viua/types/exception.h>
 #include <viua/types/reference.h>
 #include <viua/types/process.h>
+#include <viua/operand.h>
 #include <viua/process.h>
 #include <viua/cpu/cpu.h>
 #include <viua/scheduler/vps.h>
+#include <viua/scheduler/statistics.h>
+#include <viua/scheduler/allocations.h>
+#include <viua/scheduler/tracer.h>
 using namespace std;
 
 
+// source of process ids
+static atomic<uint64_t> spawned_processes(0);
+
+
 Type* Process::fetch(unsigned index) const {
     /*  Return pointer to object at given register.
      *  This method safeguards against reaching for out-of-bounds registers and
@@ -125,9 +135,11 @@ Frame* Process::requestNewFrame(unsigned arguments_size, unsigned registers_size
      *  Creates new frame if the new-frame hook is empty.
      *  Throws an exception otherwise.
      *  Returns pointer to the newly created frame.
+     *
+     *  Local register set of the frame is allocated when the frame is used.
      */
     if (frame_new) { throw "requested new frame while last one is unused"; }
-    frame_new.reset(new Frame(nullptr, arguments_size, registers_size));
+    frame_new.reset(new Frame(nullptr, arguments_size, registers_size, false));
     return frame_new.get();
 }
 void Process::pushFrame() {
@@ -139,12 +151,16 @@ void Process::pushFrame() {
         throw new Exception(oss.str());
     }
 
+    frame_new->allocateLocalRegisterSet();
     uregset = frame_new->regset;
     if (find(frames.begin(), frames.end(), frame_new) != frames.end()) {
         ostringstream oss;
         oss << "stack corruption: frame " << hex << frame_new.get() << dec << " for function " << frame_new->function_name << '/' << frame_new->args->size() << " pushed more than once";
         throw oss.str();
     }
+    if (statistics) {
+        statistics->called(frame_new->function_name);
+    }
     frames.push_back(std::move(frame_new));
 }
 void Process::dropFrame() {
@@ -195,8 +211,49 @@ byte* Process::adjustJumpBaseFor(const string& call_name) {
     jump_base = ep.second;
     return entry_point;
 }
+const viua::cpu::Symbol& Process::fetchSymbol(byte*& addr) {
+    /** Decode name operand of a call-like instruction, and advance the address past it.
+     *
+     *  Bytecode produced by older assemblers embeds names instead of referring to symbol table;
+     *  such names are decoded into a scratch symbol without resolved entry points.
+     *  Unresolved symbols are resolved here when they are first used after a module was linked
+     *  (i.e. always when linking lazily), and numbers of registers needed by functions are looked up
+     *  when their symbols are first used.
+     */
+    if (*reinterpret_cast<OperandType*>(addr) != OT_SYMBOL) {
+        inline_symbol = viua::cpu::Symbol(viua::operand::extractString(addr));
+        return inline_symbol;
+    }
+
+    byte* operand = addr;
+    pointer::inc<OperandType, byte>(addr);
+    uint32_t index = *reinterpret_cast<uint32_t*>(addr);
+    pointer::inc<uint32_t, byte>(addr);
+
+    // most symbols are decoded in the same module as the previous one
+    if (current_module == nullptr or not current_module->contains(operand)) {
+        current_module = scheduler->moduleSymbolsAt(operand);
+    }
+    if (current_module == nullptr or index >= current_module->symbols.size()) {
+        throw new Exception("invalid symbol operand: no such entry in symbol table");
+    }
+    viua::cpu::Symbol& symbol = current_module->symbols[index];
+    if (symbol.function.first == nullptr and symbol.block.first == nullptr and symbol.link_generation != scheduler->linkGeneration()) {
+        scheduler->resolveSymbol(symbol);
+    }
+    if (symbol.registers == viua::cpu::Symbol::UNRESOLVED and symbol.function.first) {
+        symbol.registers = scheduler->registerCountOf(symbol.name, symbol.function);
+    }
+    return symbol;
+}
+
 byte* Process::callNative(byte* return_address, const string& call_name, const bool return_ref, const unsigned return_index, const string&) {
-    byte* call_address = adjustJumpBaseFor(call_name);
+    auto entry_point = scheduler->getEntryPointOf(call_name);
+    return callNativeAt(entry_point, return_address, call_name, return_ref, return_index, scheduler->registerCountOf(call_name, entry_point));
+}
+byte* Process::callNativeAt(pair<byte*, byte*> entry_point, byte* return_address, const string& call_name, const bool return_ref, const unsigned return_index, const uint64_t registers) {
+    byte* call_address = entry_point.first;
+    jump_base = entry_point.second;
 
     if (not frame_new) {
         throw new Exception("function call without a frame: use `frame 0' in source code if the function takes no parameters");
@@ -208,6 +265,8 @@ byte* Process::callNative(byte* return_address, const string& call_name, const b
     frame_new->resolve_return_value_register = return_ref;
     frame_new->place_return_value_in = return_index;
 
+    // functions with known register counts get exactly as many registers as they need
+    frame_new->allocateLocalRegisterSet(registers);
     pushFrame();
 
     return call_address;
@@ -223,28 +282,43 @@ byte* Process::callForeign(byte* return_address, const string& call_name, const
     frame_new->resolve_return_value_register = return_ref;
     frame_new->place_return_value_in = return_index;
 
+    if (statistics) {
+        statistics->called(call_name);
+    }
+
+    // foreign functions return values in local register set
+    frame_new->allocateLocalRegisterSet();
+
+    if (scheduler->isNonblockingForeignFunction(call_name)) {
+        // no need to suspend the process and involve FFI schedulers
+        scheduler->callNonblockingForeignFunction(frame_new.release(), this);
+        return return_address;
+    }
+    if (scheduler->isTypedForeignFunction(call_name)) {
+        scheduler->callTypedForeignFunction(frame_new.release(), this);
+        return return_address;
+    }
+
     suspend();
     scheduler->requestForeignFunctionCall(frame_new.release(), this);
 
     return return_address;
 }
-byte* Process::callForeignMethod(byte* return_address, Type* object, const string& call_name, const bool return_ref, const unsigned return_index, const string&) {
+byte* Process::callForeignMethod(byte* return_address, Type* object, int method, const string& call_name, const bool return_ref, const unsigned return_index) {
     if (not frame_new) {
         throw new Exception("foreign method call without a frame");
     }
-    // set function name and return address
-    frame_new->function_name = call_name;
-    frame_new->return_address = return_address;
-
-    frame_new->resolve_return_value_register = return_ref;
-    frame_new->place_return_value_in = return_index;
-
-    Frame* frame = frame_new.get();
 
-    pushFrame();
+    /*  Foreign methods cannot call back into the machine so their frames are never
+     *  pushed on the call stack.
+     */
+    unique_ptr<Frame> frame(std::move(frame_new));
+    frame->function_name = call_name;
+    frame->return_address = return_address;
+    frame->allocateLocalRegisterSet();
 
-    if (not scheduler->isForeignMethod(call_name)) {
-        throw new Exception("call to unregistered foreign method: " + call_name);
+    if (statistics) {
+        statistics->called(call_name);
     }
 
     Reference* rf = nullptr;
@@ -254,35 +328,29 @@ byte* Process::callForeignMethod(byte* return_address, Type* object, const strin
 
     try {
         // FIXME: supply static and global registers to foreign functions
-        scheduler->requestForeignMethodCall(call_name, object, frame, nullptr, nullptr, this);
+        scheduler->callForeignMethod(method, object, frame.get(), nullptr, nullptr, this);
     } catch (const std::out_of_range& e) {
         throw new Exception(e.what());
     }
 
-    // FIXME: woohoo! segfault!
-    Type* returned = nullptr;
-    bool returned_is_reference = false;
-    unsigned return_value_register = frames.back()->place_return_value_in;
-    bool resolve_return_value_register = frames.back()->resolve_return_value_register;
+    for (registerset_size_type i = 0; i < frame->args->size(); ++i) {
+        if (frame->args->at(i) != nullptr and frame->args->isflagged(i, MOVED)) {
+            throw new Exception("unused pass-by-move parameter");
+        }
+    }
+
+    unsigned return_value_register = return_index;
     if (return_value_register != 0) {
         // we check in 0. register because it's reserved for return values
-        if (uregset->at(0) == nullptr) {
+        if (frame->regset->at(0) == nullptr) {
             throw new Exception("return value requested by frame but foreign method did not set return register");
         }
-        returned = uregset->pop(0);
-    }
-
-    dropFrame();
+        Type* returned = frame->regset->pop(0);
 
-    // place return value
-    if (returned and frames.size() > 0) {
-        if (resolve_return_value_register) {
+        if (return_ref) {
             return_value_register = static_cast<Integer*>(fetch(return_value_register))->as_unsigned();
         }
         place(return_value_register, returned);
-        if (returned_is_reference) {
-            uregset->flag(return_value_register, REFERENCE);
-        }
     }
 
     return return_address;
@@ -351,6 +419,7 @@ void Process::handleActiveException() {
     if (tframe != nullptr) {
         unwindStack(tframe, handler_found_for_type);
         caught.reset(thrown.release());
+        thrown_from = nullptr;
     }
 }
 byte* Process::tick() {
@@ -359,6 +428,14 @@ byte* Process::tick() {
     byte* previous_instruction_pointer = instruction_pointer;
     ++instruction_counter;
 
+    if (statistics) {
+        statistics->dispatched(previous_opcode, OPCODE(*instruction_pointer));
+        previous_opcode = *instruction_pointer;
+    }
+    if (allocations) {
+        allocations->dispatching(this, *instruction_pointer);
+    }
+
     try {
         instruction_pointer = dispatch(instruction_pointer);
     } catch (Exception* e) {
@@ -378,6 +455,10 @@ byte* Process::tick() {
         thrown.reset(new Exception(e));
     }
 
+    if (allocations) {
+        allocations->dispatched();
+    }
+
     if (halt or frames.size() == 0) {
         finished = true;
         return nullptr;
@@ -411,6 +492,7 @@ byte* Process::tick() {
     }
 
     if (thrown) {
+        thrown_from = previous_instruction_pointer;
         handleActiveException();
     }
     if (thrown) {
@@ -446,10 +528,16 @@ bool Process::joinable() const {
 }
 
 void Process::suspend() {
-    is_suspended.store(true, std::memory_order_release);
+    bool was_suspended = is_suspended.exchange(true, std::memory_order_acq_rel);
+    if (tracer and not was_suspended) {
+        tracer->suspended(this);
+    }
 }
 void Process::wakeup() {
-    is_suspended.store(false, std::memory_order_release);
+    bool was_suspended = is_suspended.exchange(false, std::memory_order_acq_rel);
+    if (tracer and was_suspended) {
+        tracer->wokenUp(this);
+    }
 }
 bool Process::suspended() const {
     return is_suspended.load(std::memory_order_acquire);
@@ -459,6 +547,10 @@ Process* Process::parent() const {
     return parent_process;
 }
 
+uint64_t Process::id() const {
+    return process_id;
+}
+
 auto Process::priority() const -> decltype(process_priority) {
     return process_priority;
 }
@@ -476,6 +568,9 @@ bool Process::terminated() const {
 
 void Process::pass(unique_ptr<Type> message) {
     message_queue.push(std::move(message));
+    if (tracer) {
+        tracer->sent(this);
+    }
     wakeup();
 }
 
@@ -510,6 +605,18 @@ uint64_t Process::counter() const {
 auto Process::executionAt() const -> decltype(instruction_pointer) {
     return instruction_pointer;
 }
+auto Process::executionBase() const -> decltype(jump_base) {
+    return jump_base;
+}
+byte* Process::thrownFrom() const {
+    /** Returns address of the instruction that threw the active exception, or
+     *  null if it is not known (e.g. exceptions thrown by foreign functions).
+     */
+    return thrown_from;
+}
+bool Process::sourceLineOf(const byte* address, string& file, uint64_t& line) const {
+    return scheduler->sourceLineOf(address, file, line);
+}
 
 
 vector<Frame*> Process::trace() const {
@@ -519,22 +626,36 @@ vector<Frame*> Process::trace() const {
     }
     return tr;
 }
+Frame* Process::currentFrame() const {
+    return (frames.size() ? frames.back().get() : nullptr);
+}
 
 
 Process::Process(unique_ptr<Frame> frm, viua::scheduler::VirtualProcessScheduler *sch, Process* pt): scheduler(sch), parent_process(pt), entry_function(frm->function_name),
+    process_id(++spawned_processes),
     regset(nullptr), uregset(nullptr), tmp(nullptr),
     jump_base(nullptr),
+    current_module(nullptr),
     frame_new(nullptr), try_frame_new(nullptr),
     thrown(nullptr), caught(nullptr),
     return_value(nullptr),
     instruction_counter(0),
     instruction_pointer(nullptr),
+    thrown_from(nullptr),
+    statistics(sch->cpu()->statistics),
+    previous_opcode(viua::scheduler::DispatchStatistics::NONE),
+    allocations(sch->cpu()->allocations),
+    tracer(sch->cpu()->tracer),
     finished(false), is_joinable(true),
     is_suspended(false),
     process_priority(1)
 {
     regset.reset(new RegisterSet(DEFAULT_REGISTER_SIZE));
+    frm->allocateLocalRegisterSet();
     uregset = frm->regset;
+    if (statistics) {
+        statistics->called(frm->function_name);
+    }
     frames.push_back(std::move(frm));
 }
 
@@ -24,6 +24,7 @@
 #include <viua/operand.h>
 #include <viua/cpu/cpu.h>
 #include <viua/scheduler/vps.h>
+#include <viua/scheduler/statistics.h>
 using namespace std;
 
 
@@ -105,17 +106,17 @@ byte* Process::opcall(byte* addr) {
     // FIXME: register indexes should be encoded as unsigned integers
     viua::cpu::util::extractIntegerOperand(addr, return_register_ref, return_register_index);
 
-    string call_name = viua::operand::extractString(addr);
+    byte* symbol_operand = addr;
+    const viua::cpu::Symbol& symbol = fetchSymbol(addr);
+    const string& call_name = symbol.name;
 
-    bool is_native = scheduler->isNativeFunction(call_name);
-    bool is_foreign = scheduler->isForeignFunction(call_name);
-    bool is_foreign_method = scheduler->isForeignMethod(call_name);
-
-    if (not (is_native or is_foreign or is_foreign_method)) {
-        throw new Exception("call to undefined function: " + call_name);
+    // native functions are resolved into entry points when modules are loaded
+    if (symbol.function.first) {
+        return callNativeAt(symbol.function, addr, call_name, return_register_ref, static_cast<unsigned>(return_register_index), symbol.registers);
     }
 
-    if (is_foreign_method) {
+    // foreign method call sites are resolved once, and then dispatched by method id
+    if (auto call_site = scheduler->foreignMethodCallSite(symbol_operand, call_name)) {
         if (frame_new == nullptr) {
             throw new Exception("cannot call foreign method without a frame");
         }
@@ -126,7 +127,14 @@ byte* Process::opcall(byte* addr) {
             throw new Exception("frame must have at least one argument when used to call a foreign method");
         }
         Type* obj = frame_new->args->at(0);
-        return callForeignMethod(addr, obj, call_name, return_register_ref, static_cast<unsigned>(return_register_index), call_name);
+        return callForeignMethod(addr, obj, call_site->method, call_site->name, return_register_ref, static_cast<unsigned>(return_register_index));
+    }
+
+    bool is_native = scheduler->isNativeFunction(call_name);
+    bool is_foreign = scheduler->isForeignFunction(call_name);
+
+    if (not (is_native or is_foreign)) {
+        throw new Exception("call to undefined function: " + call_name);
     }
 
     auto caller = (is_native ? &Process::callNative : &Process::callForeign);
@@ -136,7 +144,8 @@ byte* Process::opcall(byte* addr) {
 byte* Process::optailcall(byte* addr) {
     /*  Run tailcall instruction.
      */
-    string call_name = viua::operand::extractString(addr);
+    const viua::cpu::Symbol& symbol = fetchSymbol(addr);
+    const string& call_name = symbol.name;
 
     bool is_native = scheduler->isNativeFunction(call_name);
     bool is_foreign = scheduler->isForeignFunction(call_name);
@@ -167,6 +176,10 @@ byte* Process::optailcall(byte* addr) {
 
     Frame *last_frame = frames.back().get();
 
+    if (statistics) {
+        statistics->called(call_name);
+    }
+
     // move arguments from new frame to old frame
     delete last_frame->args;
     last_frame->args = frame_new->args;
@@ -176,7 +189,22 @@ byte* Process::optailcall(byte* addr) {
     // it's a simulated "push-and-pop" from the stack
     frame_new.reset(nullptr);
 
-    return adjustJumpBaseFor(call_name);
+    auto entry_point = symbol.function;
+    auto registers = symbol.registers;
+    if (not entry_point.first) {
+        entry_point = scheduler->getEntryPointOf(call_name);
+        registers = scheduler->registerCountOf(call_name, entry_point);
+    }
+
+    // tail called function runs in register set of the caller which may be too small for it
+    RegisterSet* caller_register_set = last_frame->regset;
+    last_frame->growLocalRegisterSet(registers);
+    if (uregset == caller_register_set) {
+        uregset = last_frame->regset;
+    }
+
+    jump_base = entry_point.second;
+    return entry_point.first;
 }
 
 byte* Process::opreturn(byte* addr) {
@@ -100,7 +100,7 @@ byte* Process::opclosure(byte* addr) {
 
     unsigned target = viua::operand::getRegisterIndex(viua::operand::extract(addr).get(), this);
 
-    string call_name = viua::operand::extractString(addr);
+    const string& call_name = fetchSymbol(addr).name;
 
     Closure* clsr = new Closure();
     clsr->function_name = call_name;
@@ -120,7 +120,7 @@ byte* Process::opfunction(byte* addr) {
      */
     unsigned target = viua::operand::getRegisterIndex(viua::operand::extract(addr).get(), this);
 
-    string call_name = viua::operand::extractString(addr);
+    const string& call_name = fetchSymbol(addr).name;
 
     Function* fn = new Function();
     fn->function_name = call_name;
@@ -148,8 +148,9 @@ byte* Process::opfcall(byte* addr) {
         throw new Exception("fcall to undefined function: " + call_name);
     }
 
-    byte* call_address = nullptr;
-    call_address = adjustJumpBaseFor(call_name);
+    auto entry_point = scheduler->getEntryPointOf(call_name);
+    byte* call_address = entry_point.first;
+    jump_base = entry_point.second;
 
     // save return address for frame
     byte* return_address = addr;
@@ -166,6 +167,8 @@ byte* Process::opfcall(byte* addr) {
 
     if (fn->type() == "Closure") {
         frame_new->setLocalRegisterSet(static_cast<Closure*>(fn)->regset, false);
+    } else {
+        frame_new->allocateLocalRegisterSet(scheduler->registerCountOf(call_name, entry_point));
     }
 
     pushFrame();
@@ -25,6 +25,7 @@
 #include <viua/operand.h>
 #include <viua/cpu/cpu.h>
 #include <viua/scheduler/vps.h>
+#include <viua/scheduler/tracer.h>
 using namespace std;
 
 
@@ -33,7 +34,7 @@ byte* Process::opprocess(byte* addr) {
      */
     unsigned target = viua::operand::getRegisterIndex(viua::operand::extract(addr).get(), this);
 
-    string call_name = viua::operand::extractString(addr);
+    const string& call_name = fetchSymbol(addr).name;
 
     bool is_native = scheduler->isNativeFunction(call_name);
     bool is_foreign = scheduler->isForeignFunction(call_name);
@@ -43,6 +44,9 @@ byte* Process::opprocess(byte* addr) {
     }
 
     frame_new->function_name = call_name;
+    if (is_native) {
+        frame_new->allocateLocalRegisterSet(scheduler->registerCountOf(call_name, scheduler->getEntryPointOf(call_name)));
+    }
     place(target, new ProcessType(scheduler->spawn(std::move(frame_new), this)));
 
     return addr;
@@ -88,6 +92,9 @@ byte* Process::opreceive(byte* addr) {
         place(target, message_queue.front().release());
         message_queue.pop();
         return_addr = addr;
+        if (tracer) {
+            tracer->received(this);
+        }
     } else {
         suspend();
     }
@@ -97,7 +104,7 @@ byte* Process::opreceive(byte* addr) {
 byte* Process::opwatchdog(byte* addr) {
     /*  Run watchdog instruction.
      */
-    string call_name = viua::operand::extractString(addr);
+    const string& call_name = fetchSymbol(addr).name;
 
     bool is_native = scheduler->isNativeFunction(call_name);
     bool is_foreign = scheduler->isForeignFunction(call_name);
@@ -110,6 +117,7 @@ byte* Process::opwatchdog(byte* addr) {
     }
 
     frame_new->function_name = call_name;
+    frame_new->allocateLocalRegisterSet(scheduler->registerCountOf(call_name, scheduler->getEntryPointOf(call_name)));
     scheduler->spawnWatchdog(std::move(frame_new));
 
     return addr;
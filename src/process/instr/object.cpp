@@ -67,7 +67,7 @@ byte* Process::opmsg(byte* addr) {
         return_register_index = static_cast<Integer*>(fetch(static_cast<unsigned>(return_register_index)))->value();
     }
 
-    string method_name = viua::operand::extractString(addr);
+    const string& method_name = fetchSymbol(addr).name;
 
     Type* obj = frame_new->args->at(0);
     if (Pointer* ptr = dynamic_cast<Pointer*>(obj)) {
@@ -95,16 +95,16 @@ byte* Process::opmsg(byte* addr) {
 
     bool is_native = scheduler->isNativeFunction(function_name);
     bool is_foreign = scheduler->isForeignFunction(function_name);
-    bool is_foreign_method = scheduler->isForeignMethod(function_name);
+    int foreign_method = scheduler->foreignMethodId(function_name);
 
-    if (not (is_native or is_foreign or is_foreign_method)) {
+    if (not (is_native or is_foreign or foreign_method >= 0)) {
         throw new Exception("method '" + method_name + "' resolves to undefined function '" + function_name + "' on class '" + obj->type() + "'");
     }
 
-    if (is_foreign_method) {
+    if (foreign_method >= 0) {
         // FIXME: remove the need for static_cast<>
         // the cast is safe because register indexes cannot be negative, but it looks ugly
-        return callForeignMethod(addr, obj, function_name, return_register_ref, static_cast<unsigned>(return_register_index), method_name);
+        return callForeignMethod(addr, obj, foreign_method, function_name, return_register_ref, static_cast<unsigned>(return_register_index));
     }
 
     auto caller = (is_native ? &Process::callNative : &Process::callForeign);
@@ -40,7 +40,7 @@ byte* Process::opcatch(byte* addr) {
     /** Run catch instruction.
      */
     string type_name = viua::operand::extractString(addr);
-    string catcher_block_name = viua::operand::extractString(addr);
+    const string& catcher_block_name = fetchSymbol(addr).name;
 
     if (not scheduler->isBlock(catcher_block_name)) {
         throw new Exception("registering undefined handler block '" + catcher_block_name + "' to handle " + type_name);
@@ -67,15 +67,20 @@ byte* Process::oppull(byte* addr) {
 byte* Process::openter(byte* addr) {
     /*  Run enter instruction.
      */
-    string block_name = viua::operand::extractString(addr);
-
-    if (not scheduler->isBlock(block_name)) {
+    const viua::cpu::Symbol& symbol = fetchSymbol(addr);
+    const string& block_name = symbol.name;
+
+    byte* block_address = nullptr;
+    if (symbol.block.first) {
+        block_address = symbol.block.first;
+        jump_base = symbol.block.second;
+    } else if (scheduler->isBlock(block_name)) {
+        block_address = adjustJumpBaseForBlock(block_name);
+    } else {
         throw new Exception("cannot enter undefined block: " + block_name);
     }
 
-    byte* block_address = adjustJumpBaseForBlock(block_name);
-
-    try_frame_new->return_address = addr; // address has already been adjusted by extractString()
+    try_frame_new->return_address = addr; // address has already been adjusted by fetchSymbol()
     try_frame_new->associated_frame = frames.back().get();
     try_frame_new->block_name = block_name;
 
@@ -27,6 +27,24 @@
 using namespace std;
 
 
+uint32_t SymbolTable::intern(const string& name) {
+    /** Returns index of given name in the symbol table, adding the name if it is not there yet.
+     */
+    auto found = indexes.find(name);
+    if (found != indexes.end()) {
+        return found->second;
+    }
+    uint32_t index = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    indexes[name] = index;
+    return index;
+}
+
+const vector<string>& SymbolTable::symbols() const {
+    return names;
+}
+
+
 byte* Program::bytecode() {
     /*  Returns pointer to a copy of the bytecode.
      *  Each call produces new copy.
@@ -67,6 +85,24 @@ Program& Program::setscream(bool d) {
     return (*this);
 }
 
+Program& Program::setsymbols(SymbolTable* st) {
+    /** Sets symbol table to which names of functions and blocks used by the program are added.
+     *  The table is shared by all programs (i.e. functions and blocks) making up a module.
+     */
+    symbols = st;
+    return (*this);
+}
+
+uint32_t Program::symbol(const string& name) {
+    /** Returns index of the name in symbol table.
+     *  Instructions inserting symbol operands must record their positions in symbol_references.
+     */
+    if (symbols == nullptr) {
+        throw ("no symbol table to put symbol in: " + name);
+    }
+    return symbols->intern(name);
+}
+
 
 uint64_t Program::size() {
     /*  Returns program size in bytes.
@@ -116,19 +152,19 @@ unsigned long Program::instructionCount() {
 
 
 static OPCODE instructionToOpcode(const string& s) {
-    OPCODE op = NOP;
-    bool found = false;
-    for (auto it : OP_NAMES) {
-        if (it.second == s) {
-            found = true;
-            op = it.first;
-            break;
+    // reverse of OP_NAMES, built once instead of scanning all names for every instruction
+    static const map<string, OPCODE> opcodes = [] {
+        map<string, OPCODE> m;
+        for (const auto& each : OP_NAMES) {
+            m.emplace(each.second, each.first);
         }
-    }
-    if (not found) {
+        return m;
+    }();
+    auto found = opcodes.find(s);
+    if (found == opcodes.end()) {
         throw std::out_of_range("invalid instruction name: " + s);
     }
-    return op;
+    return found->second;
 }
 
 uint64_t Program::countBytes(const vector<string>& lines) {
@@ -162,21 +198,18 @@ uint64_t Program::countBytes(const vector<string>& lines) {
         try {
             OPCODE op = instructionToOpcode(instr);
             inc = OP_SIZES.at(instr);
-            if ((op == ENTER) or (op == LINK) or (op == WATCHDOG) or (op == TAILCALL)) {
+            if ((op == ENTER) or (op == WATCHDOG) or (op == TAILCALL)) {
+                // function or block name
+                inc += SYMBOL_OPERAND_SIZE;
+            } else if (op == LINK) {
                 // clear first chunk
                 line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (function, block or module name)
+                // get second chunk (module name)
                 inc += str::chunk(line).size() + 1;
-            } else if ((op == CALL) or (op == MSG) or (op == PROCESS)) {
-                // clear first chunk (opcode mnemonic)
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (optional register index)
-                string first_op = str::chunk(line);
-                line = str::lstrip(str::sub(line, first_op.size()));
-                // get third chunk (function name if register index was given, empty otherwise)
-                string second_op = str::chunk(line);
-                inc += (second_op.size() ? second_op : first_op).size() + 1;
-            } else if ((op == CLOSURE) or (op == FUNCTION) or (op == CLASS) or (op == PROTOTYPE) or (op == DERIVE) or (op == NEW)) {
+            } else if ((op == CALL) or (op == MSG) or (op == PROCESS) or (op == CLOSURE) or (op == FUNCTION)) {
+                // function or method name
+                inc += SYMBOL_OPERAND_SIZE;
+            } else if ((op == CLASS) or (op == PROTOTYPE) or (op == DERIVE) or (op == NEW)) {
                 // clear first chunk (opcode mnemonic)
                 line = str::lstrip(str::sub(line, instr.size()));
                 // clear second chunk (register index)
@@ -203,9 +236,8 @@ uint64_t Program::countBytes(const vector<string>& lines) {
                 line = str::lstrip(str::sub(line, instr.size()));
                 // get second chunk (the type as a string)
                 inc += (str::extract(line).size() - 2 + 1); // +1: null-terminator, -2: quotes
-                line = str::lstrip(str::sub(line, str::extract(line).size()));
-                // get third chunk (which is a block name)
-                inc += str::chunk(line).size() + 1;
+                // third chunk is a block name
+                inc += SYMBOL_OPERAND_SIZE;
             } else if (op == STRSTORE) {
                 // clear first chunk
                 line = str::lstrip(str::sub(line, instr.size()));
@@ -266,15 +298,20 @@ uint64_t Program::getInstructionBytecodeOffset(uint64_t instr, uint64_t count) {
         }
 
         OPCODE opcode = OPCODE(program[offset]);
-        if ((opcode == IMPORT) or (opcode == ENTER) or (opcode == LINK) or (opcode == WATCHDOG) or (opcode == TAILCALL)) {
+        if ((opcode == ENTER) or (opcode == WATCHDOG) or (opcode == TAILCALL)) {
+            inc += SYMBOL_OPERAND_SIZE;
+        }
+        if ((opcode == IMPORT) or (opcode == LINK)) {
             string s(reinterpret_cast<char*>(program+offset+1));
             if (scream) {
                 cout << '+' << s.size() << " (function/module name at byte " << offset+1 << ": `" << s << "`)";
             }
             inc += s.size()+1;
         }
-        if ((opcode == CALL) or (opcode == PROCESS) or (opcode == CLOSURE) or (opcode == FUNCTION) or
-            (opcode == CLASS) or (opcode == PROTOTYPE) or (opcode == DERIVE) or (opcode == NEW) or (opcode == MSG)) {
+        if ((opcode == CALL) or (opcode == PROCESS) or (opcode == CLOSURE) or (opcode == FUNCTION) or (opcode == MSG)) {
+            inc += SYMBOL_OPERAND_SIZE;
+        }
+        if ((opcode == CLASS) or (opcode == PROTOTYPE) or (opcode == DERIVE) or (opcode == NEW)) {
             string s(reinterpret_cast<char*>(program+offset+sizeof(bool)+sizeof(int)+1));
             if (scream) {
                 cout << '+' << s.size() << " (function/module/class name at byte " << offset+1 << ": `" << s << "`)";
@@ -297,8 +334,7 @@ uint64_t Program::getInstructionBytecodeOffset(uint64_t instr, uint64_t count) {
         if (opcode == CATCH) {
             string exception_name(reinterpret_cast<char*>(program+offset+1));
             inc += exception_name.size()+1;
-            string catch_block_name(reinterpret_cast<char*>(program+offset+1+exception_name.size()+1));
-            inc += catch_block_name.size()+1;
+            inc += SYMBOL_OPERAND_SIZE;
             if (scream) {
                 cout << '+' << exception_name.size() << " (typename at byte " << offset+1 << ": `" << exception_name << "`)" << endl;
             }
@@ -355,6 +391,14 @@ vector<uint64_t> Program::jumps() {
     return jmps;
 }
 
+vector<uint64_t> Program::symbolReferences() {
+    /** Returns vector of bytecode points which contain symbol operands.
+     */
+    vector<uint64_t> refs;
+    for (byte* ref : symbol_references) { refs.push_back( static_cast<uint64_t>(ref-program) ); }
+    return refs;
+}
+
 vector<uint64_t> Program::jumpsAbsolute() {
     /** Returns vector if bytecode points which contain absolute jumps.
      */
@@ -18,6 +18,7 @@
  */
 
 #include <viua/bytecode/opcodes.h>
+#include <viua/bytecode/maps.h>
 #include <viua/support/pointer.h>
 #include <viua/program.h>
 using namespace std;
@@ -561,14 +562,16 @@ Program& Program::openclosemove(int_op target_closure, int_op target_register, i
 Program& Program::opclosure(int_op reg, const string& fn) {
     /*  Inserts closure instuction.
      */
-    addr_ptr = cg::bytecode::opclosure(addr_ptr, reg, fn);
+    addr_ptr = cg::bytecode::opclosure(addr_ptr, reg, symbol(fn));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
 Program& Program::opfunction(int_op reg, const string& fn) {
     /*  Inserts function instuction.
      */
-    addr_ptr = cg::bytecode::opfunction(addr_ptr, reg, fn);
+    addr_ptr = cg::bytecode::opfunction(addr_ptr, reg, symbol(fn));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -637,7 +640,8 @@ Program& Program::opcall(int_op reg, const string& fn_name) {
     /*  Inserts call instruction.
      *  Byte offset is calculated automatically.
      */
-    addr_ptr = cg::bytecode::opcall(addr_ptr, reg, fn_name);
+    addr_ptr = cg::bytecode::opcall(addr_ptr, reg, symbol(fn_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -645,12 +649,14 @@ Program& Program::optailcall(const string& fn_name) {
     /*  Inserts tailcall instruction.
      *  Byte offset is calculated automatically.
      */
-    addr_ptr = cg::bytecode::optailcall(addr_ptr, fn_name);
+    addr_ptr = cg::bytecode::optailcall(addr_ptr, symbol(fn_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
 Program& Program::opprocess(int_op ref, const string& fn_name) {
-    addr_ptr = cg::bytecode::opprocess(addr_ptr, ref, fn_name);
+    addr_ptr = cg::bytecode::opprocess(addr_ptr, ref, symbol(fn_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -665,7 +671,8 @@ Program& Program::opreceive(int_op ref) {
 }
 
 Program& Program::opwatchdog(const string& fn_name) {
-    addr_ptr = cg::bytecode::opwatchdog(addr_ptr, fn_name);
+    addr_ptr = cg::bytecode::opwatchdog(addr_ptr, symbol(fn_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -717,10 +724,11 @@ Program& Program::optry() {
     return (*this);
 }
 
-Program& Program::opcatch(string type_name, string block_name) {
+Program& Program::opcatch(string type_name, const string& block_name) {
     /*  Inserts catch instruction.
      */
-    addr_ptr = cg::bytecode::opcatch(addr_ptr, type_name, block_name);
+    addr_ptr = cg::bytecode::opcatch(addr_ptr, type_name, symbol(block_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -731,11 +739,12 @@ Program& Program::oppull(int_op regno) {
     return (*this);
 }
 
-Program& Program::openter(string block_name) {
+Program& Program::openter(const string& block_name) {
     /*  Inserts enter instruction.
      *  Byte offset is calculated automatically.
      */
-    addr_ptr = cg::bytecode::openter(addr_ptr, block_name);
+    addr_ptr = cg::bytecode::openter(addr_ptr, symbol(block_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -805,7 +814,8 @@ Program& Program::opnew(int_op reg, const string& class_name) {
 Program& Program::opmsg(int_op reg, const string& method_name) {
     /*  Inserts msg instuction.
      */
-    addr_ptr = cg::bytecode::opmsg(addr_ptr, reg, method_name);
+    addr_ptr = cg::bytecode::opmsg(addr_ptr, reg, symbol(method_name));
+    symbol_references.push_back(addr_ptr - SYMBOL_OPERAND_SIZE);
     return (*this);
 }
 
@@ -0,0 +1,286 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <viua/bytecode/maps.h>
+#include <viua/types/type.h>
+#include <viua/cpu/frame.h>
+#include <viua/cpu/registerset.h>
+#include <viua/process.h>
+#include <viua/scheduler/allocations.h>
+using namespace std;
+
+
+/*  Allocation profiles are written as a set of files:
+ *
+ *      <output>                allocations, frees, and live objects (at the time the profile is written) by type,
+ *      <output>.sites          allocations by function and opcode that made them,
+ *      <output>.snapshots      live objects by type, written periodically while the program runs (one line for
+ *                              every type in every snapshot, starting with milliseconds since the start),
+ *
+ *  Sizes are sizes of objects themselves, without memory they own (e.g. characters of strings).
+ *  Tables are sorted by number of allocations, highest first.
+ */
+
+static const string TEMPORARY = "(temporary)";
+static const string UNRESOLVED = "(unresolved)";
+static const string OUTSIDE_OF_PROCESSES = "(outside of processes)";
+
+atomic<viua::scheduler::AllocationProfiler*> viua::scheduler::AllocationProfiler::active(nullptr);
+thread_local const Process* viua::scheduler::AllocationProfiler::allocating_process = nullptr;
+thread_local unsigned viua::scheduler::AllocationProfiler::allocating_opcode = viua::scheduler::AllocationProfiler::NONE;
+
+
+template<typename Key, typename Counts> static vector<pair<Key, Counts>> byAllocations(const map<Key, Counts>& counts) {
+    vector<pair<Key, Counts>> sorted(counts.begin(), counts.end());
+    stable_sort(sorted.begin(), sorted.end(), [](const pair<Key, Counts>& lhs, const pair<Key, Counts>& rhs) {
+        return (lhs.second.allocations > rhs.second.allocations);
+    });
+    return sorted;
+}
+
+
+void viua::scheduler::AllocationProfiler::allocatedAs(void* object, size_t size, const string& type) {
+    AllocationProfiler* profiler = active.load();
+    if (profiler == nullptr) {
+        return;
+    }
+    unique_lock<mutex> lock(profiler->allocations_mutex);
+
+    string function_name = OUTSIDE_OF_PROCESSES;
+    if (allocating_process) {
+        auto trace = allocating_process->trace();
+        if (trace.size()) {
+            function_name = trace.back()->function_name;
+        }
+    }
+    auto& site = profiler->sites[make_tuple(function_name, allocating_opcode)];
+    ++site.allocations;
+    site.allocated_bytes += size;
+
+    auto found = profiler->live.find(object);
+    if (found != profiler->live.end()) {
+        // the object living at the same address was freed without the VM seeing it (e.g. by a native module)
+        if (found->second.type.empty()) {
+            profiler->pending.erase(std::remove(profiler->pending.begin(), profiler->pending.end(), object), profiler->pending.end());
+        } else {
+            auto& counts = profiler->types[found->second.type];
+            ++counts.frees;
+            counts.freed_bytes += found->second.size;
+        }
+    }
+    profiler->live[object] = allocation_t { size, type, this_thread::get_id() };
+    if (type.empty()) {
+        profiler->pending.push_back(object);
+    } else {
+        auto& counts = profiler->types[type];
+        ++counts.allocations;
+        counts.allocated_bytes += size;
+    }
+}
+
+void viua::scheduler::AllocationProfiler::allocated(void* object, size_t size) {
+    allocatedAs(object, size, "");
+}
+
+void viua::scheduler::AllocationProfiler::allocatedFrame(void* object, size_t size) {
+    static const string type = "Frame";
+    allocatedAs(object, size, type);
+}
+
+void viua::scheduler::AllocationProfiler::allocatedRegisterSet(void* object, size_t size) {
+    static const string type = "RegisterSet";
+    allocatedAs(object, size, type);
+}
+
+void viua::scheduler::AllocationProfiler::deallocated(void* object, size_t size) {
+    AllocationProfiler* profiler = active.load();
+    if (profiler == nullptr) {
+        return;
+    }
+    unique_lock<mutex> lock(profiler->allocations_mutex);
+
+    auto found = profiler->live.find(object);
+    if (found == profiler->live.end()) {
+        // objects allocated by native modules are not seen by the profiler
+        return;
+    }
+
+    if (found->second.type.empty()) {
+        profiler->pending.erase(std::remove(profiler->pending.begin(), profiler->pending.end(), object), profiler->pending.end());
+        auto& counts = profiler->types[TEMPORARY];
+        ++counts.allocations;
+        counts.allocated_bytes += size;
+        ++counts.frees;
+        counts.freed_bytes += size;
+    } else {
+        auto& counts = profiler->types[found->second.type];
+        ++counts.frees;
+        counts.freed_bytes += size;
+    }
+    profiler->live.erase(found);
+}
+
+void viua::scheduler::AllocationProfiler::resolve(bool all) {
+    /** Resolves types of pending allocations.
+     *
+     *  Only allocations made by the calling thread are resolved unless all are requested because
+     *  objects allocated by other threads may be still under construction.
+     *  Must be called with allocations mutex held.
+     */
+    auto thread = this_thread::get_id();
+    vector<const void*> still_pending;
+    for (auto object : pending) {
+        auto& allocation = live.at(object);
+        if (not (all or allocation.thread == thread)) {
+            still_pending.push_back(object);
+            continue;
+        }
+        allocation.type = static_cast<const Type*>(object)->type();
+        auto& counts = types[allocation.type];
+        ++counts.allocations;
+        counts.allocated_bytes += allocation.size;
+    }
+    pending.swap(still_pending);
+}
+
+void viua::scheduler::AllocationProfiler::snapshot() {
+    /** Writes numbers of live objects by type.
+     *  Must be called with allocations mutex held.
+     */
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - started).count();
+    map<string, pair<uint64_t, uint64_t>> live_by_type;
+    for (const auto& each : live) {
+        auto& counts = live_by_type[each.second.type.empty() ? UNRESOLVED : each.second.type];
+        ++counts.first;
+        counts.second += each.second.size;
+    }
+    for (const auto& each : live_by_type) {
+        snapshots << elapsed << '\t' << each.second.first << '\t' << each.second.second << '\t' << each.first << '\n';
+    }
+    snapshots.flush();
+}
+
+void viua::scheduler::AllocationProfiler::dispatching(const Process* process, unsigned opcode) {
+    /** Marks allocations made by the calling thread from now on as made by the process.
+     */
+    allocating_process = process;
+    allocating_opcode = opcode;
+}
+
+void viua::scheduler::AllocationProfiler::dispatched() {
+    /** Marks the end of an instruction of the process; objects it allocated are constructed.
+     */
+    allocating_process = nullptr;
+    allocating_opcode = NONE;
+    unique_lock<mutex> lock(allocations_mutex);
+    if (pending.size()) {
+        resolve(false);
+    }
+}
+
+void viua::scheduler::AllocationProfiler::resolvePending() {
+    /** Resolves types of objects allocated by the calling thread.
+     *  Threads that do not execute processes call this when objects they allocated are constructed.
+     */
+    AllocationProfiler* profiler = active.load();
+    if (profiler == nullptr) {
+        return;
+    }
+    unique_lock<mutex> lock(profiler->allocations_mutex);
+    profiler->resolve(false);
+}
+
+void viua::scheduler::AllocationProfiler::snapshotIfDue() {
+    auto now = chrono::steady_clock::now();
+    if ((now - last_snapshot) < interval) {
+        return;
+    }
+    last_snapshot = now;
+    unique_lock<mutex> lock(allocations_mutex);
+    snapshot();
+}
+
+bool viua::scheduler::AllocationProfiler::write() {
+    /** Writes the profile, and returns false if any of its files could not be written.
+     *  Must be called when no other thread allocates objects.
+     */
+    unique_lock<mutex> lock(allocations_mutex);
+    resolve(true);
+    snapshot();
+
+    map<string, pair<uint64_t, uint64_t>> live_by_type;
+    for (const auto& each : live) {
+        auto& counts = live_by_type[each.second.type];
+        ++counts.first;
+        counts.second += each.second.size;
+    }
+
+    ofstream type_table(output_path);
+    type_table << "# allocations\tfrees\tlive\tallocated bytes\tlive bytes\ttype\n";
+    for (const auto& each : byAllocations(types)) {
+        const auto& counts = each.second;
+        type_table << counts.allocations << '\t' << counts.frees << '\t' << live_by_type[each.first].first << '\t';
+        type_table << counts.allocated_bytes << '\t' << live_by_type[each.first].second << '\t' << each.first << '\n';
+    }
+
+    ofstream site_table(output_path + ".sites");
+    site_table << "# allocations\tallocated bytes\tfunction\topcode\n";
+    for (const auto& each : byAllocations(sites)) {
+        unsigned opcode = get<1>(each.first);
+        auto name = OP_NAMES.find(static_cast<OPCODE>(opcode));
+        site_table << each.second.allocations << '\t' << each.second.allocated_bytes << '\t' << get<0>(each.first) << '\t';
+        site_table << ((opcode == NONE or name == OP_NAMES.end()) ? "-" : name->second) << '\n';
+    }
+
+    type_table.close();
+    site_table.close();
+    snapshots.close();
+    return (type_table and site_table and snapshots);
+}
+
+viua::scheduler::AllocationProfiler::AllocationProfiler(const string& path, unsigned snapshot_interval):
+    output_path(path),
+    interval(snapshot_interval),
+    started(chrono::steady_clock::now()),
+    last_snapshot(started),
+    snapshots(path + ".snapshots")
+{
+    snapshots << "# milliseconds\tlive\tlive bytes\ttype\n";
+    active = this;
+    Type::allocation_hook = allocated;
+    Type::deallocation_hook = deallocated;
+    Frame::allocation_hook = allocatedFrame;
+    Frame::deallocation_hook = deallocated;
+    RegisterSet::allocation_hook = allocatedRegisterSet;
+    RegisterSet::deallocation_hook = deallocated;
+}
+
+viua::scheduler::AllocationProfiler::~AllocationProfiler() {
+    /*  Hooks are removed before the profiler is deactivated, and
+     *  the profiler must outlive all threads that may allocate (i.e. the CPU).
+     */
+    Type::allocation_hook = nullptr;
+    Type::deallocation_hook = nullptr;
+    Frame::allocation_hook = nullptr;
+    Frame::deallocation_hook = nullptr;
+    RegisterSet::allocation_hook = nullptr;
+    RegisterSet::deallocation_hook = nullptr;
+    active = nullptr;
+}
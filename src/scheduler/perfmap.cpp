@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdexcept>
+#include <viua/cpu/frame.h>
+#include <viua/process.h>
+#include <viua/scheduler/perfmap.h>
+using namespace std;
+
+
+/*  Perf maps contain one line for every trampoline:
+ *
+ *      <start address in hex> <size in hex> viua:<function name>
+ *
+ *  Trampoline calls the function given as its second parameter, passing its first parameter unchanged, and
+ *  sets up a frame so that perf can unwind through it into the interpreter when frame pointers are used:
+ *
+ *      push %rbp
+ *      mov %rsp, %rbp
+ *      call *%rsi
+ *      pop %rbp
+ *      ret
+ */
+
+static const unsigned char TRAMPOLINE_CODE[] = { 0x55, 0x48, 0x89, 0xe5, 0xff, 0xd6, 0x5d, 0xc3 };
+static const unsigned TRAMPOLINE_SLOT_SIZE = 16;
+static const unsigned TRAMPOLINE_PAGE_SIZE = 4096;
+static const unsigned TRAMPOLINES_PER_PAGE = (TRAMPOLINE_PAGE_SIZE / TRAMPOLINE_SLOT_SIZE);
+
+thread_local const Frame* viua::scheduler::PerfMap::cached_frame = nullptr;
+thread_local string viua::scheduler::PerfMap::cached_function;
+thread_local viua::scheduler::PerfMap::Trampoline viua::scheduler::PerfMap::cached_trampoline = nullptr;
+thread_local exception_ptr viua::scheduler::PerfMap::thrown = nullptr;
+
+
+bool viua::scheduler::PerfMap::supported() {
+#if defined(__x86_64__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+byte* viua::scheduler::PerfMap::tickProcess(Process* process) {
+    try {
+        return process->tick();
+    } catch (...) {
+        thrown = current_exception();
+        return nullptr;
+    }
+}
+
+viua::scheduler::PerfMap::Trampoline viua::scheduler::PerfMap::trampolineFor(const string& function_name) {
+    unique_lock<mutex> lock(trampolines_mutex);
+    auto found = trampolines.find(function_name);
+    if (found != trampolines.end()) {
+        return found->second;
+    }
+
+    if (pages.empty() or used_in_last_page == TRAMPOLINES_PER_PAGE) {
+        // pages are filled with trampolines before they are made executable, and are never written again
+        void* page = mmap(nullptr, TRAMPOLINE_PAGE_SIZE, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS), -1, 0);
+        if (page == MAP_FAILED) {
+            throw runtime_error("could not allocate memory for perf trampolines");
+        }
+        memset(page, 0xcc, TRAMPOLINE_PAGE_SIZE);
+        for (unsigned i = 0; i < TRAMPOLINES_PER_PAGE; ++i) {
+            memcpy((static_cast<unsigned char*>(page) + (i * TRAMPOLINE_SLOT_SIZE)), TRAMPOLINE_CODE, sizeof(TRAMPOLINE_CODE));
+        }
+        if (mprotect(page, TRAMPOLINE_PAGE_SIZE, (PROT_READ | PROT_EXEC)) == -1) {
+            munmap(page, TRAMPOLINE_PAGE_SIZE);
+            throw runtime_error("could not make perf trampolines executable");
+        }
+        pages.push_back(page);
+        used_in_last_page = 0;
+    }
+
+    unsigned char* address = (static_cast<unsigned char*>(pages.back()) + (used_in_last_page++ * TRAMPOLINE_SLOT_SIZE));
+    map << hex << reinterpret_cast<uintptr_t>(address) << ' ' << sizeof(TRAMPOLINE_CODE) << dec << " viua:" << function_name << endl;
+
+    Trampoline trampoline = reinterpret_cast<Trampoline>(address);
+    trampolines[function_name] = trampoline;
+    return trampoline;
+}
+
+const string& viua::scheduler::PerfMap::path() const {
+    return map_path;
+}
+
+bool viua::scheduler::PerfMap::good() const {
+    return static_cast<bool>(map);
+}
+
+byte* viua::scheduler::PerfMap::tick(Process* process) {
+    /** Executes next instruction of the process through the trampoline of the function it is in.
+     */
+    const Frame* frame = process->currentFrame();
+    if (frame == nullptr) {
+        return process->tick();
+    }
+    // frames may be allocated at addresses of frames of other functions that have returned
+    if (frame != cached_frame or frame->function_name != cached_function) {
+        cached_frame = frame;
+        cached_function = frame->function_name;
+        cached_trampoline = trampolineFor(cached_function);
+    }
+
+    byte* next_instruction = cached_trampoline(process, tickProcess);
+    if (thrown) {
+        exception_ptr exception = thrown;
+        thrown = nullptr;
+        rethrow_exception(exception);
+    }
+    return next_instruction;
+}
+
+viua::scheduler::PerfMap::PerfMap():
+    map_path("/tmp/perf-" + to_string(getpid()) + ".map"),
+    map(map_path),
+    used_in_last_page(0)
+{
+}
+
+viua::scheduler::PerfMap::~PerfMap() {
+    for (auto page : pages) {
+        munmap(page, TRAMPOLINE_PAGE_SIZE);
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <viua/bytecode/maps.h>
+#include <viua/machine.h>
+#include <viua/process.h>
+#include <viua/scheduler/profiler.h>
+using namespace std;
+
+
+/*  Profiles are written as a set of files:
+ *
+ *      <output>                call stacks in folded format (one stack per line, frames separated by semicolons,
+ *                              followed by the number of samples) that flame graph tools accept,
+ *      <output>.functions      samples taken in each function (self), and in it or functions it called (total),
+ *      <output>.opcodes        samples taken at each opcode,
+ *      <output>.instructions   samples taken at each instruction (function, and offset in bytecode of its module),
+ *      <output>.lines          samples taken at each source line (only of modules assembled with line tables),
+ *
+ *  Tables are sorted by number of samples, highest first.
+ */
+
+template<typename Key> static vector<pair<uint64_t, Key>> bySamples(const map<Key, uint64_t>& counts) {
+    vector<pair<uint64_t, Key>> sorted;
+    for (const auto& each : counts) {
+        sorted.emplace_back(each.second, each.first);
+    }
+    stable_sort(sorted.begin(), sorted.end(), [](const pair<uint64_t, Key>& lhs, const pair<uint64_t, Key>& rhs) {
+        return (lhs.first > rhs.first);
+    });
+    return sorted;
+}
+
+static double percentOf(uint64_t part, uint64_t whole) {
+    return (whole ? (100.0 * static_cast<double>(part) / static_cast<double>(whole)) : 0.0);
+}
+
+
+void viua::scheduler::Profiler::tick() {
+    unique_lock<mutex> lock(timer_mutex);
+    while (not timer_condition.wait_for(lock, chrono::microseconds(interval), [this]() { return stopping; })) {
+        sample_due.store(true, memory_order_relaxed);
+    }
+}
+
+void viua::scheduler::Profiler::sample(const Process* process) {
+    /** Takes a sample of the process that is about to execute its next instruction.
+     */
+    sample_due.store(false, memory_order_relaxed);
+
+    auto trace = process->trace();
+    if (trace.empty() or process->executionAt() == nullptr) {
+        return;
+    }
+    ++samples;
+
+    string stack;
+    set<string> seen;
+    for (decltype(trace)::size_type i = (trace[0]->function_name == ENTRY_FUNCTION_NAME and trace.size() > 1); i < trace.size(); ++i) {
+        const string& function_name = trace[i]->function_name;
+        if (not stack.empty()) {
+            stack += ';';
+        }
+        stack += function_name;
+
+        // recursive calls count only once towards total samples of a function
+        if (seen.insert(function_name).second) {
+            ++get<1>(functions[function_name]);
+        }
+    }
+    ++stacks[stack];
+
+    const string& function_name = trace.back()->function_name;
+    OPCODE opcode = OPCODE(*process->executionAt());
+    uint64_t offset = static_cast<uint64_t>(process->executionAt() - process->executionBase());
+
+    ++get<0>(functions[function_name]);
+    ++opcodes[opcode];
+    ++instructions[make_tuple(function_name, offset, opcode)];
+
+    string file;
+    uint64_t line = 0;
+    if (process->sourceLineOf(process->executionAt(), file, line)) {
+        ++lines[file + ':' + to_string(line)];
+    }
+}
+
+void viua::scheduler::Profiler::stop() {
+    {
+        unique_lock<mutex> lock(timer_mutex);
+        stopping = true;
+    }
+    timer_condition.notify_one();
+    if (timer.joinable()) {
+        timer.join();
+    }
+}
+
+bool viua::scheduler::Profiler::write() const {
+    /** Writes the profile, and returns false if any of its files could not be written.
+     */
+    ofstream folded(output_path);
+    for (const auto& each : stacks) {
+        folded << each.first << ' ' << each.second << '\n';
+    }
+
+    ofstream function_table(output_path + ".functions");
+    function_table << "# samples: " << samples << ", interval: " << interval << "us\n";
+    function_table << "# self\tself%\ttotal\ttotal%\tfunction\n";
+    map<string, uint64_t> self_samples;
+    for (const auto& each : functions) {
+        self_samples[each.first] = get<0>(each.second);
+    }
+    for (const auto& each : bySamples(self_samples)) {
+        uint64_t total = get<1>(functions.at(each.second));
+        function_table << each.first << '\t' << fixed << setprecision(2) << percentOf(each.first, samples) << '\t';
+        function_table << total << '\t' << percentOf(total, samples) << '\t' << each.second << '\n';
+    }
+
+    ofstream opcode_table(output_path + ".opcodes");
+    opcode_table << "# samples\tpercent\topcode\n";
+    for (const auto& each : bySamples(opcodes)) {
+        opcode_table << each.first << '\t' << fixed << setprecision(2) << percentOf(each.first, samples) << '\t' << OP_NAMES.at(each.second) << '\n';
+    }
+
+    ofstream instruction_table(output_path + ".instructions");
+    instruction_table << "# samples\tpercent\tfunction\toffset\topcode\n";
+    for (const auto& each : bySamples(instructions)) {
+        instruction_table << each.first << '\t' << fixed << setprecision(2) << percentOf(each.first, samples) << '\t';
+        instruction_table << get<0>(each.second) << "\t0x" << hex << get<1>(each.second) << dec << '\t' << OP_NAMES.at(get<2>(each.second)) << '\n';
+    }
+
+    ofstream line_table(output_path + ".lines");
+    line_table << "# samples\tpercent\tline\n";
+    for (const auto& each : bySamples(lines)) {
+        line_table << each.first << '\t' << fixed << setprecision(2) << percentOf(each.first, samples) << '\t' << each.second << '\n';
+    }
+
+    folded.close();
+    function_table.close();
+    opcode_table.close();
+    instruction_table.close();
+    line_table.close();
+    return (folded and function_table and opcode_table and instruction_table and line_table);
+}
+
+viua::scheduler::Profiler::Profiler(const string& path, unsigned sampling_interval):
+    output_path(path),
+    interval(sampling_interval),
+    sample_due(false),
+    stopping(false),
+    samples(0)
+{
+    timer = thread(&viua::scheduler::Profiler::tick, this);
+}
+
+viua::scheduler::Profiler::~Profiler() {
+    stop();
+}
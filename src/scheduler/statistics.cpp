@@ -0,0 +1,201 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <map>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include <viua/bytecode/maps.h>
+#include <viua/support/string.h>
+#include <viua/scheduler/statistics.h>
+using namespace std;
+
+
+/*  Statistics are written as a JSON object:
+ *
+ *      {
+ *          "clock": "rdtsc",                   // unit of ticks (steady_clock ticks are nanoseconds)
+ *          "instructions": 1024,               // number of dispatched instructions
+ *          "opcodes": [                        // sorted by count, highest first
+ *              { "opcode": "iadd", "count": 128, "timed": 8, "ticks": 800, "estimated_ticks": 12800 },
+ *              ...
+ *          ],
+ *          "pairs": [                          // sorted by count, highest first
+ *              { "first": "istore", "second": "iadd", "count": 64 },
+ *              ...
+ *          ],
+ *          "calls": [                          // sorted by count, highest first
+ *              { "function": "main/1", "count": 1 },
+ *              ...
+ *          ]
+ *      }
+ */
+
+atomic_bool viua::scheduler::DispatchStatistics::dump_requested(false);
+
+
+static string opcodeName(unsigned opcode) {
+    auto found = OP_NAMES.find(static_cast<OPCODE>(opcode));
+    return (found == OP_NAMES.end() ? ("<opcode " + to_string(opcode) + ">") : found->second);
+}
+
+template<typename Key> static vector<pair<uint64_t, Key>> byCount(const vector<pair<uint64_t, Key>>& counts) {
+    vector<pair<uint64_t, Key>> sorted;
+    for (const auto& each : counts) {
+        if (each.first) {
+            sorted.push_back(each);
+        }
+    }
+    stable_sort(sorted.begin(), sorted.end(), [](const pair<uint64_t, Key>& lhs, const pair<uint64_t, Key>& rhs) {
+        return (lhs.first > rhs.first);
+    });
+    return sorted;
+}
+
+
+const char* viua::scheduler::DispatchStatistics::clock_name() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "rdtsc";
+#else
+    return "steady_clock";
+#endif
+}
+
+uint64_t viua::scheduler::DispatchStatistics::clock() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+void viua::scheduler::DispatchStatistics::timed(OPCODE opcode, uint64_t ticks) {
+    ++timed_opcodes[opcode];
+    timed_ticks[opcode] += ticks;
+}
+
+void viua::scheduler::DispatchStatistics::called(const string& function_name) {
+    ++calls[function_name];
+}
+
+void viua::scheduler::DispatchStatistics::requestDump() {
+    dump_requested.store(true);
+}
+
+bool viua::scheduler::DispatchStatistics::dumpRequested() {
+    /** Returns true if a dump was requested since the last call.
+     */
+    return dump_requested.exchange(false);
+}
+
+bool viua::scheduler::DispatchStatistics::write() const {
+    /** Writes statistics gathered so far, and returns false if they could not be written.
+     */
+    vector<pair<uint64_t, unsigned>> opcode_counts;
+    for (unsigned i = 0; i < OPCODES; ++i) {
+        opcode_counts.emplace_back(opcodes[i], i);
+    }
+    vector<pair<uint64_t, unsigned>> pair_counts;
+    for (unsigned i = 0; i < pairs.size(); ++i) {
+        pair_counts.emplace_back(pairs[i], i);
+    }
+    // function names are sorted first so that functions called equally often are written in a stable order
+    map<string, uint64_t> sorted_calls(calls.begin(), calls.end());
+    vector<pair<uint64_t, string>> call_counts;
+    for (const auto& each : sorted_calls) {
+        call_counts.emplace_back(each.second, each.first);
+    }
+
+    ostringstream out;
+    out << "{\n";
+    out << "    \"clock\": " << str::jsonquote(clock_name()) << ",\n";
+    out << "    \"instructions\": " << dispatched_instructions << ",\n";
+
+    // opcodes that were not timed are estimated to take as much time as an average timed instruction
+    uint64_t all_timed = 0, all_ticks = 0;
+    for (unsigned i = 0; i < OPCODES; ++i) {
+        all_timed += timed_opcodes[i];
+        all_ticks += timed_ticks[i];
+    }
+
+    out << "    \"opcodes\": [";
+    bool first = true;
+    for (const auto& each : byCount(opcode_counts)) {
+        unsigned opcode = each.second;
+        uint64_t timed_count = all_timed, ticks = all_ticks;
+        if (timed_opcodes[opcode]) {
+            timed_count = timed_opcodes[opcode];
+            ticks = timed_ticks[opcode];
+        }
+        uint64_t estimated = (timed_count ? static_cast<uint64_t>(static_cast<double>(ticks) / static_cast<double>(timed_count) * static_cast<double>(each.first)) : 0);
+
+        out << (first ? "\n" : ",\n") << "        { \"opcode\": " << str::jsonquote(opcodeName(opcode)) << ", \"count\": " << each.first;
+        out << ", \"timed\": " << timed_opcodes[opcode] << ", \"ticks\": " << timed_ticks[opcode] << ", \"estimated_ticks\": " << estimated << " }";
+        first = false;
+    }
+    out << (first ? "],\n" : "\n    ],\n");
+
+    out << "    \"pairs\": [";
+    first = true;
+    for (const auto& each : byCount(pair_counts)) {
+        out << (first ? "\n" : ",\n") << "        { \"first\": " << str::jsonquote(opcodeName(each.second / OPCODES));
+        out << ", \"second\": " << str::jsonquote(opcodeName(each.second % OPCODES)) << ", \"count\": " << each.first << " }";
+        first = false;
+    }
+    out << (first ? "],\n" : "\n    ],\n");
+
+    out << "    \"calls\": [";
+    first = true;
+    for (const auto& each : byCount(call_counts)) {
+        out << (first ? "\n" : ",\n") << "        { \"function\": " << str::jsonquote(each.second) << ", \"count\": " << each.first << " }";
+        first = false;
+    }
+    out << (first ? "]\n" : "\n    ]\n");
+    out << "}\n";
+
+    // statistics may be dumped while a reader is looking at the previous dump so the file is replaced atomically
+    string temporary_path = (output_path + '.' + to_string(getpid()));
+    ofstream file(temporary_path);
+    file << out.str();
+    file.close();
+    if ((not file) or rename(temporary_path.c_str(), output_path.c_str()) == -1) {
+        unlink(temporary_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+viua::scheduler::DispatchStatistics::DispatchStatistics(const string& path):
+    output_path(path),
+    dispatched_instructions(0),
+    opcodes(OPCODES, 0),
+    pairs((OPCODES * OPCODES), 0),
+    timed_opcodes(OPCODES, 0),
+    timed_ticks(OPCODES, 0),
+    timings(0),
+    until_timed(TIMING_INTERVAL)
+{
+}
@@ -0,0 +1,212 @@
+/*
+ *  Copyright (C) 2016 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <set>
+#include <algorithm>
+#include <viua/process.h>
+#include <viua/support/string.h>
+#include <viua/scheduler/tracer.h>
+using namespace std;
+
+
+/*  Traces are written as JSON objects in trace event format (accepted by chrome://tracing, and Perfetto):
+ *
+ *      {
+ *          "traceEvents": [
+ *              // quanta are complete events, with instructions executed during the quantum
+ *              { "name": "quantum", "cat": "scheduler", "ph": "X", "ts": 10.250, "dur": 4.125, "pid": 42, "tid": 1,
+ *                "args": { "process": 1, "function": "main/1", "instructions": 16 } },
+ *              // foreign calls are asynchronous events that begin when a call is requested, and
+ *              // end when the calling process is woken up
+ *              { "name": "math::sqrt/1", "cat": "ffi", "ph": "b", "id": "0x1f2e3d", "ts": 14.500, "pid": 42, "tid": 1,
+ *                "args": { "process": 1 } },
+ *              // the rest are instant events
+ *              { "name": "suspend", "cat": "process", "ph": "i", "s": "t", "ts": 14.625, "pid": 42, "tid": 1,
+ *                "args": { "process": 1 } },
+ *              ...
+ *          ],
+ *          "displayTimeUnit": "ns",
+ *          "otherData": { "recorded_events": 1024, "dropped_events": 0 }
+ *      }
+ *
+ *  Timestamps are in microseconds since the tracer was created.
+ *  Processes are identified by ids assigned when they are spawned, and threads by ids assigned when
+ *  they record their first event (thread 1 runs the scheduler).
+ */
+
+atomic<unsigned> viua::scheduler::Tracer::threads(0);
+thread_local unsigned viua::scheduler::Tracer::thread_index = 0;
+
+
+static string microseconds(uint64_t nanoseconds) {
+    ostringstream formatted;
+    formatted << (nanoseconds / 1000) << '.' << setw(3) << setfill('0') << (nanoseconds % 1000);
+    return formatted.str();
+}
+
+
+unsigned viua::scheduler::Tracer::thread() {
+    if (not thread_index) {
+        thread_index = ++threads;
+    }
+    return thread_index;
+}
+
+uint64_t viua::scheduler::Tracer::now() const {
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - started).count());
+}
+
+void viua::scheduler::Tracer::record(Event kind, uint64_t process, uint64_t related, const string& detail, uint64_t timestamp, uint64_t duration) {
+    unsigned recording_thread = thread();
+
+    unique_lock<mutex> lock(events_mutex);
+    event_t& event = events[recorded++ % events.size()];
+    event.kind = kind;
+    event.thread = recording_thread;
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.process = process;
+    event.related = related;
+    event.detail = detail;
+}
+
+void viua::scheduler::Tracer::spawned(const Process* process, const string& function_name, const Process* parent) {
+    record(Event::SPAWN, process->id(), (parent ? parent->id() : 0), function_name, now());
+}
+
+void viua::scheduler::Tracer::quantum(const Process* process, const string& function_name, uint64_t quantum_started, uint64_t instructions) {
+    /** Records a quantum that started at given time (obtained from now()), and has just ended.
+     */
+    record(Event::QUANTUM, process->id(), instructions, function_name, quantum_started, (now() - quantum_started));
+}
+
+void viua::scheduler::Tracer::suspended(const Process* process) {
+    record(Event::SUSPEND, process->id(), 0, "", now());
+}
+
+void viua::scheduler::Tracer::wokenUp(const Process* process) {
+    record(Event::WAKEUP, process->id(), 0, "", now());
+}
+
+void viua::scheduler::Tracer::foreignCallRequested(const Process* process, const string& function_name, const void* request) {
+    record(Event::FFI_REQUEST, process->id(), reinterpret_cast<uintptr_t>(request), function_name, now());
+}
+
+void viua::scheduler::Tracer::foreignCallCompleted(const Process* process, const string& function_name, const void* request) {
+    record(Event::FFI_COMPLETE, process->id(), reinterpret_cast<uintptr_t>(request), function_name, now());
+}
+
+void viua::scheduler::Tracer::sent(const Process* receiver) {
+    record(Event::SEND, receiver->id(), 0, "", now());
+}
+
+void viua::scheduler::Tracer::received(const Process* process) {
+    record(Event::RECEIVE, process->id(), 0, "", now());
+}
+
+void viua::scheduler::Tracer::exited(const Process* process, const string& exception_type) {
+    /** Records termination of a process; exception type is empty if the process finished normally.
+     */
+    record(Event::EXIT, process->id(), 0, exception_type, now());
+}
+
+bool viua::scheduler::Tracer::write() {
+    /** Writes events kept in the buffer, oldest first, and returns false if the trace could not be written.
+     *  Must be called when no other thread records events.
+     */
+    unique_lock<mutex> lock(events_mutex);
+
+    auto pid = getpid();
+    uint64_t kept = min<uint64_t>(recorded, events.size());
+
+    ofstream out(output_path);
+    out << "{\n";
+    out << "    \"traceEvents\": [\n";
+    out << "        { \"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": 1, \"args\": { \"name\": \"viua-vm\" } }";
+
+    set<unsigned> seen_threads;
+    for (uint64_t i = (recorded - kept); i < recorded; ++i) {
+        const event_t& event = events[i % events.size()];
+        if (seen_threads.insert(event.thread).second) {
+            out << ",\n        { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << event.thread;
+            out << ", \"args\": { \"name\": " << (event.thread == 1 ? "\"scheduler\"" : "\"foreign calls\"") << " } }";
+        }
+
+        out << ",\n        { ";
+        switch (event.kind) {
+            case Event::QUANTUM:
+                out << "\"name\": \"quantum\", \"cat\": \"scheduler\", \"ph\": \"X\", \"dur\": " << microseconds(event.duration) << ", ";
+                break;
+            case Event::FFI_REQUEST:
+            case Event::FFI_COMPLETE:
+                out << "\"name\": " << str::jsonquote(event.detail) << ", \"cat\": \"ffi\", \"ph\": " << (event.kind == Event::FFI_REQUEST ? "\"b\"" : "\"e\"");
+                out << ", \"id\": \"0x" << hex << event.related << dec << "\", ";
+                break;
+            default:
+                const char* name = "";
+                switch (event.kind) {
+                    case Event::SPAWN: name = "spawn"; break;
+                    case Event::SUSPEND: name = "suspend"; break;
+                    case Event::WAKEUP: name = "wakeup"; break;
+                    case Event::SEND: name = "send"; break;
+                    case Event::RECEIVE: name = "receive"; break;
+                    case Event::EXIT: name = "exit"; break;
+                    default: break;
+                }
+                out << "\"name\": \"" << name << "\", \"cat\": \"process\", \"ph\": \"i\", \"s\": \"t\", ";
+                break;
+        }
+        out << "\"ts\": " << microseconds(event.timestamp) << ", \"pid\": " << pid << ", \"tid\": " << event.thread;
+
+        out << ", \"args\": { \"process\": " << event.process;
+        if (event.kind == Event::QUANTUM) {
+            out << ", \"function\": " << str::jsonquote(event.detail) << ", \"instructions\": " << event.related;
+        } else if (event.kind == Event::SPAWN) {
+            out << ", \"function\": " << str::jsonquote(event.detail);
+            if (event.related) {
+                out << ", \"parent\": " << event.related;
+            }
+        } else if (event.kind == Event::EXIT and not event.detail.empty()) {
+            out << ", \"exception\": " << str::jsonquote(event.detail);
+        }
+        out << " } }";
+    }
+
+    out << "\n    ],\n";
+    out << "    \"displayTimeUnit\": \"ns\",\n";
+    out << "    \"otherData\": { \"recorded_events\": " << recorded << ", \"dropped_events\": " << (recorded - kept) << " }\n";
+    out << "}\n";
+
+    out.close();
+    return static_cast<bool>(out);
+}
+
+viua::scheduler::Tracer::Tracer(const string& path, unsigned buffer_size):
+    output_path(path),
+    started(chrono::steady_clock::now()),
+    events(buffer_size),
+    recorded(0)
+{
+    // the tracer is created by the thread that runs the scheduler
+    thread();
+}
@@ -29,6 +29,11 @@
 #include <viua/process.h>
 #include <viua/cpu/cpu.h>
 #include <viua/scheduler/vps.h>
+#include <viua/scheduler/profiler.h>
+#include <viua/scheduler/statistics.h>
+#include <viua/scheduler/allocations.h>
+#include <viua/scheduler/tracer.h>
+#include <viua/scheduler/perfmap.h>
 using namespace std;
 
 
@@ -36,7 +41,21 @@ static void printStackTrace(Process *process) {
     auto trace = process->trace();
     cout << "stack trace: from entry point, most recent call last...\n";
     for (unsigned i = (trace.size() and trace[0]->function_name == "__entry"); i < trace.size(); ++i) {
-        cout << "  " << stringifyFunctionInvocation(trace[i]) << "\n";
+        cout << "  " << stringifyFunctionInvocation(trace[i]);
+
+        // callers are at their call instructions (which end where return addresses of called frames point)
+        const byte* executing = nullptr;
+        if ((i+1) < trace.size()) {
+            executing = (trace[i+1]->ret_address() ? (trace[i+1]->ret_address() - 1) : nullptr);
+        } else {
+            executing = (process->thrownFrom() ? process->thrownFrom() : process->executionAt());
+        }
+        string file;
+        uint64_t line = 0;
+        if (executing and process->sourceLineOf(executing, file, line)) {
+            cout << " at " << file << ':' << line;
+        }
+        cout << "\n";
     }
     cout << "\n";
 
@@ -108,6 +127,15 @@ bool viua::scheduler::VirtualProcessScheduler::executeQuant(Process *th, unsigne
         return true;
     }
 
+    bool traced = (tracer and not th->stopped());
+    uint64_t quantum_started = 0, executed_before = 0;
+    string quantum_function;
+    if (traced) {
+        quantum_started = tracer->now();
+        executed_before = th->counter();
+        quantum_function = th->trace().back()->function_name;
+    }
+
     for (unsigned j = 0; (priority == 0 or j < priority); ++j) {
         if (th->stopped()) {
             // remember to break if the process stopped
@@ -119,7 +147,30 @@ bool viua::scheduler::VirtualProcessScheduler::executeQuant(Process *th, unsigne
             // do not execute suspended processes
             break;
         }
-        th->tick();
+        if (profiler and profiler->due()) {
+            profiler->sample(th);
+        }
+        if (statistics and statistics->timeNext()) {
+            // one of every few instructions is timed
+            OPCODE opcode = OPCODE(*th->executionAt());
+            uint64_t started = statistics->clock();
+            if (perf_map) {
+                perf_map->tick(th);
+            } else {
+                th->tick();
+            }
+            statistics->timed(opcode, (statistics->clock() - started));
+            continue;
+        }
+        if (perf_map) {
+            perf_map->tick(th);
+        } else {
+            th->tick();
+        }
+    }
+
+    if (traced and th->counter() != executed_before) {
+        tracer->quantum(th, quantum_function, quantum_started, (th->counter() - executed_before));
     }
 
     return true;
@@ -161,6 +212,14 @@ bool viua::scheduler::VirtualProcessScheduler::isForeignFunction(const string& n
     return attached_cpu->isForeignFunction(name);
 }
 
+bool viua::scheduler::VirtualProcessScheduler::isNonblockingForeignFunction(const string& name) const {
+    return attached_cpu->isNonblockingForeignFunction(name);
+}
+
+bool viua::scheduler::VirtualProcessScheduler::isTypedForeignFunction(const string& name) const {
+    return attached_cpu->isTypedForeignFunction(name);
+}
+
 bool viua::scheduler::VirtualProcessScheduler::isBlock(const string& name) const {
     return attached_cpu->isBlock(name);
 }
@@ -185,6 +244,26 @@ pair<byte*, byte*> viua::scheduler::VirtualProcessScheduler::getEntryPointOf(con
     return attached_cpu->getEntryPointOf(name);
 }
 
+viua::cpu::ModuleSymbols* viua::scheduler::VirtualProcessScheduler::moduleSymbolsAt(const byte* address) const {
+    return attached_cpu->moduleSymbolsAt(address);
+}
+
+uint64_t viua::scheduler::VirtualProcessScheduler::linkGeneration() const {
+    return attached_cpu->linkGeneration();
+}
+
+void viua::scheduler::VirtualProcessScheduler::resolveSymbol(viua::cpu::Symbol& symbol) const {
+    attached_cpu->resolveSymbol(symbol);
+}
+
+uint64_t viua::scheduler::VirtualProcessScheduler::registerCountOf(const std::string& name, pair<byte*, byte*> entry_point) const {
+    return attached_cpu->registerCountOf(name, entry_point);
+}
+
+bool viua::scheduler::VirtualProcessScheduler::sourceLineOf(const byte* address, string& file, uint64_t& line) const {
+    return attached_cpu->sourceLineOf(address, file, line);
+}
+
 void viua::scheduler::VirtualProcessScheduler::registerPrototype(Prototype *proto) {
     attached_cpu->registerPrototype(proto);
 }
@@ -193,8 +272,43 @@ void viua::scheduler::VirtualProcessScheduler::requestForeignFunctionCall(Frame
     attached_cpu->requestForeignFunctionCall(frame, p);
 }
 
-void viua::scheduler::VirtualProcessScheduler::requestForeignMethodCall(const string& name, Type *object, Frame *frame, RegisterSet*, RegisterSet*, Process *p) {
-    attached_cpu->requestForeignMethodCall(name, object, frame, nullptr, nullptr, p);
+void viua::scheduler::VirtualProcessScheduler::callNonblockingForeignFunction(Frame *frame, Process *p) const {
+    attached_cpu->callNonblockingForeignFunction(frame, p);
+}
+
+void viua::scheduler::VirtualProcessScheduler::callTypedForeignFunction(Frame *frame, Process *p) const {
+    attached_cpu->callTypedForeignFunction(frame, p);
+}
+
+int viua::scheduler::VirtualProcessScheduler::foreignMethodId(const string& name) const {
+    return attached_cpu->foreignMethodId(name);
+}
+
+const viua::scheduler::ForeignMethodCallSite* viua::scheduler::VirtualProcessScheduler::foreignMethodCallSite(const byte* name_operand, const string& name) {
+    /** Returns foreign method called at given call site, or nullptr if the call site does not call a foreign method.
+     *
+     *  Negative results are cached together with the link generation in which they were found, and
+     *  are discarded when it changes as foreign methods may be registered later.
+     */
+    auto found = foreign_method_call_sites.find(name_operand);
+    if (found != foreign_method_call_sites.end()) {
+        if (found->second.method >= 0) {
+            return &(found->second);
+        }
+        if (found->second.link_generation == attached_cpu->linkGeneration()) {
+            return nullptr;
+        }
+    }
+
+    ForeignMethodCallSite& call_site = foreign_method_call_sites[name_operand];
+    call_site.method = attached_cpu->foreignMethodId(name);
+    call_site.name = name;
+    call_site.link_generation = attached_cpu->linkGeneration();
+    return (call_site.method < 0 ? nullptr : &call_site);
+}
+
+void viua::scheduler::VirtualProcessScheduler::callForeignMethod(int id, Type *object, Frame *frame, RegisterSet*, RegisterSet*, Process *p) {
+    attached_cpu->callForeignMethod(id, object, frame, nullptr, nullptr, p);
 }
 
 void viua::scheduler::VirtualProcessScheduler::loadNativeLibrary(const string& name) {
@@ -225,6 +339,9 @@ Process* viua::scheduler::VirtualProcessScheduler::process() {
 Process* viua::scheduler::VirtualProcessScheduler::spawn(unique_ptr<Frame> frame, Process *parent) {
     unique_ptr<Process> p(new Process(std::move(frame), this, parent));
     p->begin();
+    if (tracer) {
+        tracer->spawned(p.get(), p->trace()[0]->function_name, parent);
+    }
     processes.push_back(std::move(p));
     return processes.back().get();
 }
@@ -236,6 +353,9 @@ void viua::scheduler::VirtualProcessScheduler::spawnWatchdog(unique_ptr<Frame> f
     watchdog_function = frame->function_name;
     watchdog_process.reset(new Process(std::move(frame), this, nullptr));
     watchdog_process->begin();
+    if (tracer) {
+        tracer->spawned(watchdog_process.get(), watchdog_function, nullptr);
+    }
 }
 
 void viua::scheduler::VirtualProcessScheduler::resurrectWatchdog() {
@@ -243,6 +363,9 @@ void viua::scheduler::VirtualProcessScheduler::resurrectWatchdog() {
     if (active_exception) {
         cout << "watchdog process terminated by: " << active_exception->type() << ": '" << active_exception->str() << "'" << endl;
     }
+    if (tracer) {
+        tracer->exited(watchdog_process.get(), (active_exception ? active_exception->type() : ""));
+    }
 
     watchdog_process.reset(nullptr);
 
@@ -295,6 +418,9 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
         }
 
         if (th->terminated() and not th->joinable() and th->parent() == nullptr) {
+            if (tracer) {
+                tracer->exited(th, th->getActiveException()->type());
+            }
             if (not watchdog_process) {
                 if (th == main_process) {
                     exit_code = 1;
@@ -342,6 +468,9 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
         // schedule for removal thus shortening the vector of running processes_list and
         // speeding up execution
         if (th->stopped() and (not th->joinable())) {
+            if (tracer) {
+                tracer->exited(th, "");
+            }
             dead_processes_list.push_back(std::move(processes.at(i)));
         } else {
             running_processes_list.push_back(std::move(processes.at(i)));
@@ -351,6 +480,13 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
     processes.erase(processes.begin(), processes.end());
     processes.swap(running_processes_list);
 
+    if (statistics and statistics->dumpRequested()) {
+        statistics->write();
+    }
+    if (allocations) {
+        allocations->snapshotIfDue();
+    }
+
     while (watchdog_process and not watchdog_process->suspended()) {
         executeQuant(watchdog_process.get(), 0);
         if (watchdog_process->terminated() or watchdog_process->stopped()) {
@@ -383,6 +519,11 @@ int viua::scheduler::VirtualProcessScheduler::exit() const {
 
 viua::scheduler::VirtualProcessScheduler::VirtualProcessScheduler(CPU *acpu):
     attached_cpu(acpu),
+    profiler(acpu->profiler),
+    statistics(acpu->statistics),
+    allocations(acpu->allocations),
+    tracer(acpu->tracer),
+    perf_map(acpu->perf_map),
     main_process(nullptr),
     current_process_index(0),
     watchdog_process(nullptr),
@@ -17,10 +17,20 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <limits>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <viua/types/type.h>
+#include <viua/types/integer.h>
 #include <viua/types/string.h>
 #include <viua/types/vector.h>
 #include <viua/types/exception.h>
@@ -50,12 +60,229 @@ void io_readtext(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
     frame->regset->set(0, new String(oss.str()));
 }
 
+/*  Functions below operate on raw file descriptors.
+ *  Descriptors created by std::io are non-blocking and reads, writes, and accepts
+ *  performed on them park calling process (not the FFI scheduler) until the descriptor
+ *  becomes ready.
+ */
+static Exception* io_error(const string& what) {
+    return new Exception("IOException", (what + ": " + strerror(errno)));
+}
+
+static int integer_argument(Frame* frame, unsigned i) {
+    if (frame->args->at(i) == nullptr or frame->args->at(i)->type() != "Integer") {
+        throw new Exception("invalid type of parameter " + to_string(i) + ": expected Integer");
+    }
+    return static_cast<Integer*>(frame->args->at(i))->as_integer();
+}
+
+static string string_argument(Frame* frame, unsigned i) {
+    if (frame->args->at(i) == nullptr or frame->args->at(i)->type() != "String") {
+        throw new Exception("invalid type of parameter " + to_string(i) + ": expected String");
+    }
+    return static_cast<String*>(frame->args->at(i))->value();
+}
+
+static sockaddr_un unix_address(const string& path, socklen_t& length) {
+    /*  Paths beginning with '@' name sockets in the abstract namespace.
+     */
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw new Exception("IOException", ("socket path too long: " + path));
+    }
+    memcpy(address.sun_path, path.c_str(), path.size());
+    if (path.size() and path[0] == '@') {
+        address.sun_path[0] = '\0';
+    }
+    length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size());
+    return address;
+}
+
+
+void io_pipe(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
+    int fds[2];
+    if (pipe2(fds, O_NONBLOCK | O_CLOEXEC) == -1) {
+        throw io_error("failed to create pipe");
+    }
+
+    Vector* ends = new Vector();
+    ends->push(new Integer(fds[0]));
+    ends->push(new Integer(fds[1]));
+    frame->regset->set(0, ends);
+}
+
+void io_nonblocking(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
+    int fd = integer_argument(frame, 0);
+    int flags = fcntl(fd, F_GETFL);
+    if (flags == -1 or fcntl(fd, F_SETFL, (flags | O_NONBLOCK)) == -1) {
+        throw io_error("failed to make descriptor non-blocking");
+    }
+}
+
+void io_close(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
+    if (close(integer_argument(frame, 0)) == -1) {
+        throw io_error("failed to close descriptor");
+    }
+}
+
+void io_unix_listen(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
+    socklen_t length = 0;
+    sockaddr_un address = unix_address(string_argument(frame, 0), length);
+
+    int fd = socket(AF_UNIX, (SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC), 0);
+    if (fd == -1) {
+        throw io_error("failed to create socket");
+    }
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), length) == -1 or listen(fd, SOMAXCONN) == -1) {
+        Exception* e = io_error("failed to listen on socket");
+        close(fd);
+        throw e;
+    }
+    frame->regset->set(0, new Integer(fd));
+}
+
+void io_unix_connect(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
+    /*  Connecting a Unix-domain socket blocks while backlog of the listening socket is full so
+     *  this function is not marked as non-blocking and runs on FFI schedulers.
+     *  The socket is made non-blocking only after it is connected.
+     */
+    socklen_t length = 0;
+    sockaddr_un address = unix_address(string_argument(frame, 0), length);
+
+    int fd = socket(AF_UNIX, (SOCK_STREAM | SOCK_CLOEXEC), 0);
+    if (fd == -1) {
+        throw io_error("failed to create socket");
+    }
+    int flags = -1;
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), length) == -1 or (flags = fcntl(fd, F_GETFL)) == -1 or fcntl(fd, F_SETFL, (flags | O_NONBLOCK)) == -1) {
+        Exception* e = io_error("failed to connect socket");
+        close(fd);
+        throw e;
+    }
+    frame->regset->set(0, new Integer(fd));
+}
+
+
+static void read_when_ready(Frame* frame, int fd, size_t size, ForeignCallCompletion* completion) {
+    vector<char> buffer(size);
+    ssize_t n = 0;
+    do {
+        n = read(fd, buffer.data(), size);
+    } while (n == -1 and errno == EINTR);
+
+    if (n >= 0) {
+        // empty string signals end of file
+        frame->regset->set(0, new String(string(buffer.data(), static_cast<size_t>(n))));
+        completion->complete();
+    } else if (errno == EAGAIN or errno == EWOULDBLOCK) {
+        try {
+            completion->reactor()->await(fd, ForeignIOReactor::READABLE, [frame, fd, size, completion]() {
+                read_when_ready(frame, fd, size, completion);
+            });
+        } catch (Type* e) {
+            completion->fail(e);
+        }
+    } else {
+        completion->fail(io_error("failed to read"));
+    }
+}
+
+static void write_when_ready(Frame* frame, int fd, string data, size_t written, ForeignCallCompletion* completion) {
+    while (written < data.size()) {
+        ssize_t n = write(fd, (data.c_str() + written), (data.size() - written));
+        if (n >= 0) {
+            written += static_cast<size_t>(n);
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno == EAGAIN or errno == EWOULDBLOCK) {
+            try {
+                completion->reactor()->await(fd, ForeignIOReactor::WRITABLE, [frame, fd, data, written, completion]() {
+                    write_when_ready(frame, fd, data, written, completion);
+                });
+            } catch (Type* e) {
+                completion->fail(e);
+            }
+            return;
+        } else {
+            completion->fail(io_error("failed to write"));
+            return;
+        }
+    }
+    frame->regset->set(0, new Integer(static_cast<int>(written)));
+    completion->complete();
+}
+
+static void accept_when_ready(Frame* frame, int fd, ForeignCallCompletion* completion) {
+    int client = -1;
+    do {
+        client = accept4(fd, nullptr, nullptr, (SOCK_NONBLOCK | SOCK_CLOEXEC));
+    } while (client == -1 and errno == EINTR);
+
+    if (client != -1) {
+        frame->regset->set(0, new Integer(client));
+        completion->complete();
+    } else if (errno == EAGAIN or errno == EWOULDBLOCK) {
+        try {
+            completion->reactor()->await(fd, ForeignIOReactor::READABLE, [frame, fd, completion]() {
+                accept_when_ready(frame, fd, completion);
+            });
+        } catch (Type* e) {
+            completion->fail(e);
+        }
+    } else {
+        completion->fail(io_error("failed to accept connection"));
+    }
+}
+
+void io_read(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*, ForeignCallCompletion* completion) {
+    int fd = integer_argument(frame, 0);
+    int size = integer_argument(frame, 1);
+    if (size <= 0) {
+        throw new Exception("invalid size of read: " + to_string(size));
+    }
+    read_when_ready(frame, fd, static_cast<size_t>(size), completion);
+}
+
+void io_write(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*, ForeignCallCompletion* completion) {
+    int fd = integer_argument(frame, 0);
+    string data = string_argument(frame, 1);
+    // number of written bytes is returned as an Integer so it must not be truncated
+    if (data.size() > static_cast<size_t>(numeric_limits<int>::max())) {
+        throw new Exception("IOException", ("cannot write more bytes than fit in Integer: " + to_string(data.size())));
+    }
+    write_when_ready(frame, fd, data, 0, completion);
+}
+
+void io_accept(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*, ForeignCallCompletion* completion) {
+    int fd = integer_argument(frame, 0);
+    accept_when_ready(frame, fd, completion);
+}
+
+
 const ForeignFunctionSpec functions[] = {
     { "std::io::getline/0", &io_getline },
     { "std::io::readtext/1", &io_readtext },
+    { "std::io::pipe/0", &io_pipe, true },
+    { "std::io::nonblocking/1", &io_nonblocking, true },
+    { "std::io::close/1", &io_close, true },
+    { "std::io::unix_listen/1", &io_unix_listen, true },
+    { "std::io::unix_connect/1", &io_unix_connect },
+    { NULL, NULL },
+};
+
+const AsyncForeignFunctionSpec async_functions[] = {
+    { "std::io::read/2", &io_read },
+    { "std::io::write/2", &io_write },
+    { "std::io::accept/1", &io_accept },
     { NULL, NULL },
 };
 
 extern "C" const ForeignFunctionSpec* exports() {
     return functions;
 }
+
+extern "C" const AsyncForeignFunctionSpec* async_exports() {
+    return async_functions;
+}
@@ -98,9 +98,9 @@ void random_randint(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
 
 const ForeignFunctionSpec functions[] = {
     { "std::random::device::random", &random_drandom },
-    { "std::random::device::urandom", &random_durandom },
-    { "std::random::random", &random_random },
-    { "std::random::randint", &random_randint },
+    { "std::random::device::urandom", &random_durandom, true },
+    { "std::random::random", &random_random, true },
+    { "std::random::randint", &random_randint, true },
     { NULL, NULL },
 };
 
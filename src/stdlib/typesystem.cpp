@@ -69,9 +69,9 @@ void bases(Frame* frame, RegisterSet*, RegisterSet*, Process*, CPU*) {
 
 
 const ForeignFunctionSpec functions[] = {
-    { "typesystem::typeof/1", &typeof },
-    { "typesystem::inheritanceChain/1", &inheritanceChain },
-    { "typesystem::bases/1", &bases },
+    { "typesystem::typeof/1", &typeof, true },
+    { "typesystem::inheritanceChain/1", &inheritanceChain, true },
+    { "typesystem::bases/1", &bases, true },
     { NULL, NULL },
 };
 
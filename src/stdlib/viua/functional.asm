@@ -59,12 +59,15 @@
     branch 8 element_ok next_iter
 
     .mark: element_ok
+    ; the element is moved into the filtered vector so there is nothing to empty
     vpush 3 7
+    jump next_element
 
     .mark: next_iter
     ; empty the register because vat instruction creates references
     empty 7
 
+    .mark: next_element
     ; increase the counter and go back to the beginning of the loop
     ;     ++i;
     ; }
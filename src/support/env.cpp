@@ -51,6 +51,22 @@ namespace support {
             return paths;
         }
 
+        bool identify(const string& path, vector<uint64_t>& key) {
+            /*  Appends identity of a file (device, inode, size, and modification time) to the key.
+             *  Returns false if the file cannot be stat'ed.
+             */
+            struct stat st;
+            if (stat(path.c_str(), &st) == -1) {
+                return false;
+            }
+            key.push_back(st.st_dev);
+            key.push_back(st.st_ino);
+            key.push_back(static_cast<uint64_t>(st.st_size));
+            key.push_back(static_cast<uint64_t>(st.st_mtim.tv_sec));
+            key.push_back(static_cast<uint64_t>(st.st_mtim.tv_nsec));
+            return true;
+        }
+
         bool isfile(const string& path) {
             struct stat sf;
 
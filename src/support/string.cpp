@@ -21,7 +21,8 @@
 #include <vector>
 #include <string>
 #include <sstream>
-#include <regex>
+#include <iomanip>
+#include <algorithm>
 #include <viua/types/string.h>
 using namespace std;
 
@@ -80,9 +81,12 @@ namespace str {
 
     bool ishex(const std::string& s, bool) {
         /*  Returns true if s is a valid hexadecimal number.
+         *  Regex equivalent: `^0x[0-9a-fA-F]+$`
          */
-        static regex hexadecimal_number("^0x[0-9a-fA-F]+$");
-        return regex_match(s, hexadecimal_number);
+        if (s.size() < 3 or s[0] != '0' or s[1] != 'x') {
+            return false;
+        }
+        return (s.find_first_not_of("0123456789abcdefABCDEF", 2) == string::npos);
     }
 
     bool isfloat(const std::string& s, bool negatives) {
@@ -113,33 +117,27 @@ namespace str {
          */
         if (b == 0 and e == -1) return string(s);
 
-        ostringstream part;
-        part.str("");
-
         unsigned long end;
         if (e < 0) { end = (s.size() - static_cast<unsigned long>(-1 * e) + 1); }
         else { end = static_cast<long unsigned>(e); }
+        end = min(end, s.size());
 
-        for (unsigned long i = b; i < s.size() and i < end; ++i) {
-            part << s[i];
+        if (b >= end) {
+            return string("");
         }
-
-        return part.str();
+        return s.substr(b, (end - b));
     }
 
 
     string chunk(const string& s, bool ignore_leading_ws) {
         /*  Returns part of the string until first whitespace from left side.
          */
-        ostringstream chnk;
-
-        string str = (ignore_leading_ws ? lstrip(s) : s);
-
-        for (unsigned i = 0; i < str.size(); ++i) {
-            if (str[i] == *" " or str[i] == *"\t" or str[i] == *"\v" or str[i] == *"\n") break;
-            chnk << str[i];
+        auto begin = (ignore_leading_ws ? s.find_first_not_of(" \t\v\n") : 0);
+        if (begin == string::npos) {
+            return string("");
         }
-        return chnk.str();
+        auto end = s.find_first_of(" \t\v\n", begin);
+        return s.substr(begin, (end == string::npos ? string::npos : (end - begin)));
     }
 
     vector<string> chunks(const string& s) {
@@ -190,13 +188,13 @@ namespace str {
             return string("");
         }
 
-        ostringstream chnk;
+        string chnk;
         char quote;
-        chnk << (quote = s[0]);
+        chnk += (quote = s[0]);
 
         int backs = 0;
         for (unsigned i = 1; i < s.size(); ++i) {
-            chnk << s[i];
+            chnk += s[i];
             if (s[i] == quote and (backs == 0)) {
                 break;
             }
@@ -209,21 +207,15 @@ namespace str {
             }
         }
 
-        return chnk.str();
+        return chnk;
     }
 
 
     string lstrip(const string& s) {
         /*  Removes whitespace from left side of the string.
          */
-        unsigned i = 0;
-        while (i < s.size()) {
-            if (not (s[i] == ' ' or s[i] == '\t' or s[i] == '\v' or s[i] == '\n')) {
-                break;
-            };
-            ++i;
-        }
-        return sub(s, i);
+        auto i = s.find_first_not_of(" \t\v\n");
+        return (i == string::npos ? string("") : s.substr(i));
     }
 
 
@@ -266,6 +258,26 @@ namespace str {
         return encoded.str();
     }
 
+    string jsonquote(const string& s) {
+        /** Enquote the string as a JSON string literal.
+         *
+         *  Quotes and backslashes are escaped, and control characters are written as \u escapes.
+         */
+        ostringstream encoded;
+        encoded << '"';
+        for (auto c : s) {
+            if (c == '"' or c == '\\') {
+                encoded << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                encoded << "\\u" << hex << setw(4) << setfill('0') << static_cast<unsigned>(c) << dec;
+            } else {
+                encoded << c;
+            }
+        }
+        encoded << '"';
+        return encoded.str();
+    }
+
     string strdecode(const string& s) {
         /** Decode escape sequences in strings.
          *
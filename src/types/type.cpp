@@ -27,6 +27,25 @@
 using namespace std;
 
 
+atomic<void (*)(void*, size_t)> Type::allocation_hook(nullptr);
+atomic<void (*)(void*, size_t)> Type::deallocation_hook(nullptr);
+
+void* Type::operator new(size_t size) {
+    void* allocated = ::operator new(size);
+    if (auto hook = allocation_hook.load()) {
+        hook(allocated, size);
+    }
+    return allocated;
+}
+
+void Type::operator delete(void* allocated, size_t size) {
+    auto hook = deallocation_hook.load();
+    if (hook and allocated) {
+        hook(allocated, size);
+    }
+    ::operator delete(allocated);
+}
+
 Pointer* Type::pointer() {
     return new Pointer(this);
 }
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+
+#
+#   Copyright (C) 2015, 2016 Marek Marecki
+#
+#   This file is part of Viua VM.
+#
+#   Viua VM is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation, either version 3 of the License, or
+#   (at your option) any later version.
+#
+#   Viua VM is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU General Public License for more details.
+#
+#   You should have received a copy of the GNU General Public License
+#   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+"""Benchmarks for Viua virtual machine.
+
+Each benchmark is a sample program from `./sample/benchmarks` that is
+compiled once and run several times.
+Wall-clock time of every run is measured, and the median and the 99th
+percentile (nearest rank, so with few runs it is the slowest run) are
+reported.
+Every program is also run once with `--stats` to count instructions it
+executes, and instructions per second of the median run are reported.
+
+Startup benchmarks are generated: a program linking many large modules
+that calls a single function and exits so that the time spent loading
+modules dominates the run.
+
+Assembler benchmarks are generated too: a single large source file is
+assembled several times, and throughput (in source lines per second) of
+the median run is reported.
+
+Results can be written as JSON, and compared with results of an earlier
+run (a baseline); benchmarks whose median got slower by more than the
+threshold (in percent, 10 by default) are reported as regressions, and
+make the script exit with non-zero code.
+
+Usage:
+
+    python3 ./tests/benchmarks.py [--runs N] [--output FILE] [--baseline FILE] [--threshold PERCENT] [name...]
+"""
+
+import json
+import math
+import os
+import subprocess
+import sys
+import time
+
+
+COMPILED_BENCHMARKS_PATH = './tests/compiled'
+BENCHMARKS_PATH = './sample/benchmarks'
+
+BENCHMARKS = (
+    # name                      # sample path
+    ('int.loop',                'int/loop.asm'),
+    ('calls.recursive',         'calls/recursive.asm'),
+    ('calls.tail',              'calls/tailcall.asm'),
+    ('closures.call',           'closures/call.asm'),
+    ('functional.map_filter',   'functional/map_filter.asm'),
+    ('methods.msg',             'methods/msg_string_size.asm'),
+    ('strings.format',          'strings/format.asm'),
+    ('vectors.push_at_pop',     'vectors/push_at_pop.asm'),
+    ('processes.spawn_join',    'processes/spawn_join.asm'),
+    ('processes.ping_pong',     'processes/ping_pong.asm'),
+    ('ffi.calls.blocking',      'ffi/calls_blocking.asm'),
+    ('ffi.calls.nonblocking',   'ffi/calls_nonblocking.asm'),
+)
+
+STARTUP_BENCHMARKS = (
+    # name                      # linked modules    # functions in each module  # lazy linking
+    ('startup.link.many',       64,                 1000,                       False),
+    ('startup.link.many.lazy',  64,                 1000,                       True),
+)
+
+ASSEMBLER_BENCHMARKS = (
+    # name                      # functions in source
+    ('asm.throughput',          20000),
+)
+
+
+def assemble(asm, out, lib=False):
+    p = subprocess.Popen(('./build/bin/vm/asm',) + (('--lib',) if lib else ()) + ('--out', out, asm), stdout=subprocess.PIPE)
+    output, error = p.communicate()
+    if p.wait() != 0:
+        raise Exception('{0}: {1}'.format(asm, output.decode('utf-8').strip()))
+
+def generate_startup_benchmark(name, modules, functions):
+    """Generates and compiles modules and the program linking them.
+    Returns path to compiled program, and directory with compiled modules.
+    """
+    directory = os.path.join(COMPILED_BENCHMARKS_PATH, 'benchmark_{0}'.format(name))
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+
+    for i in range(modules):
+        module = 'startup_module_{0}'.format(i)
+        asm = os.path.join(directory, '{0}.asm'.format(module))
+        with open(asm, 'w') as ofstream:
+            ofstream.write('.function: {0}::function_0/0\n    istore 0 0\n    return\n.end\n\n'.format(module))
+            for j in range(1, functions):
+                # calls give modules symbols to resolve when they are linked
+                ofstream.write('.function: {0}::function_{1}/0\n    frame 0\n    call 0 {0}::function_{2}/0\n    return\n.end\n\n'.format(module, j, (j-1)))
+        assemble(asm, os.path.join(directory, '{0}.vlib'.format(module)), lib=True)
+
+    asm = os.path.join(directory, 'main.asm')
+    with open(asm, 'w') as ofstream:
+        ofstream.write('.signature: startup_module_0::function_0/0\n\n')
+        ofstream.write('.function: main/0\n')
+        for i in range(modules):
+            ofstream.write('    link startup_module_{0}\n'.format(i))
+        ofstream.write('    frame 0\n    call 1 startup_module_0::function_0/0\n    izero 0\n    return\n.end\n')
+    compiled = os.path.join(COMPILED_BENCHMARKS_PATH, 'benchmark_{0}.bin'.format(name))
+    assemble(asm, compiled)
+
+    return (compiled, directory)
+
+def generate_assembler_benchmark(name, functions):
+    """Generates a large source file exercising expansion of nested
+    instructions, function calls, and jumps.
+    Returns path to the source, and number of lines in it.
+    """
+    if not os.path.isdir(COMPILED_BENCHMARKS_PATH):
+        os.makedirs(COMPILED_BENCHMARKS_PATH)
+
+    asm = os.path.join(COMPILED_BENCHMARKS_PATH, 'benchmark_{0}.asm'.format(name))
+    lines = 0
+    with open(asm, 'w') as ofstream:
+        for i in range(functions):
+            ofstream.write('.function: function_{0}/1\n    arg 1 0\n    istore 2 {0}\n    iadd 3 1 2\n    branch 3 +1 +1\n    print 3\n    move 0 3\n    return\n.end\n\n'.format(i))
+            lines += 10
+        ofstream.write('.function: main/0\n')
+        for i in range(functions):
+            ofstream.write('    frame ^[(param 0 (istore 1 {0}))]\n    call 2 function_{0}/1\n'.format(i))
+            lines += 2
+        ofstream.write('    izero 0\n    return\n.end\n')
+        lines += 4
+
+    return (asm, lines)
+
+def timed_assemble(asm, out):
+    begin = time.perf_counter()
+    assemble(asm, out)
+    end = time.perf_counter()
+    return (end - begin)
+
+def run(path, viuapath=None, lazy=False, options=()):
+    env = dict(os.environ)
+    if viuapath is not None:
+        env['VIUAPATH'] = viuapath
+    if lazy:
+        env['VIUALAZYLINK'] = '1'
+    begin = time.perf_counter()
+    p = subprocess.Popen(('./build/bin/vm/cpu',) + tuple(options) + (path,), stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, env=env)
+    output, error = p.communicate()
+    exit_code = p.wait()
+    end = time.perf_counter()
+    if exit_code != 0:
+        raise Exception('{0} [{1}]: {2}'.format(path, exit_code, error.decode('utf-8').strip()))
+    return (end - begin)
+
+def count_instructions(path, viuapath=None, lazy=False):
+    """Runs a program with statistics enabled, and returns the number of
+    instructions it executed.
+    """
+    statistics_path = '{0}.stats.json'.format(path)
+    run(path, viuapath, lazy, options=('--stats={0}'.format(statistics_path),))
+    with open(statistics_path) as ifstream:
+        return json.load(ifstream)['instructions']
+
+def median(values):
+    values = sorted(values)
+    middle = (len(values) // 2)
+    if len(values) % 2:
+        return values[middle]
+    return (values[middle-1] + values[middle]) / 2
+
+def percentile(values, n):
+    values = sorted(values)
+    return values[max(0, math.ceil(len(values) * n / 100) - 1)]
+
+def summarise(timings, instructions=None, lines=None):
+    result = {
+        'runs': len(timings),
+        'median': median(timings),
+        'p99': percentile(timings, 99),
+        'min': min(timings),
+    }
+    if instructions is not None:
+        result['instructions'] = instructions
+        result['instructions_per_second'] = (instructions / result['median'])
+    if lines is not None:
+        result['lines'] = lines
+        result['lines_per_second'] = (lines / result['median'])
+    return result
+
+def report(name, result, baseline):
+    line = '{0:40} {1:10.4f}s median {2:10.4f}s p99'.format(name, result['median'], result['p99'])
+    if 'instructions_per_second' in result:
+        line += ' {0:14.0f} instructions/s'.format(result['instructions_per_second'])
+    if 'lines_per_second' in result:
+        line += ' {0:14.0f} lines/s'.format(result['lines_per_second'])
+    if name in baseline:
+        line += ' {0:+7.1f}%'.format(result['change'])
+    print(line)
+
+def main(args):
+    runs = 5
+    output = None
+    baseline = {}
+    threshold = 10.0
+    while args and args[0].startswith('--'):
+        option, args = args[0], args[1:]
+        if not args:
+            print('error: missing value for option: {0}'.format(option))
+            return 1
+        if option == '--runs':
+            runs = int(args[0])
+        elif option == '--output':
+            output = args[0]
+        elif option == '--baseline':
+            with open(args[0]) as ifstream:
+                baseline = json.load(ifstream)['benchmarks']
+        elif option == '--threshold':
+            threshold = float(args[0])
+        else:
+            print('error: unknown option: {0}'.format(option))
+            return 1
+        args = args[1:]
+
+    results = {}
+    def record(name, result):
+        if name in baseline:
+            result['baseline'] = baseline[name]['median']
+            result['change'] = ((result['median'] - result['baseline']) / result['baseline'] * 100)
+        results[name] = result
+        report(name, result, baseline)
+
+    for name, sample in BENCHMARKS:
+        if args and name not in args:
+            continue
+        compiled = os.path.join(COMPILED_BENCHMARKS_PATH, 'benchmark_{0}.bin'.format(name))
+        assemble(os.path.join(BENCHMARKS_PATH, sample), compiled)
+        timings = [run(compiled) for i in range(runs)]
+        record(name, summarise(timings, instructions=count_instructions(compiled)))
+
+    for name, modules, functions, lazy in STARTUP_BENCHMARKS:
+        if args and name not in args:
+            continue
+        compiled, viuapath = generate_startup_benchmark(name, modules, functions)
+        timings = [run(compiled, viuapath, lazy) for i in range(runs)]
+        record(name, summarise(timings))
+
+    for name, functions in ASSEMBLER_BENCHMARKS:
+        if args and name not in args:
+            continue
+        asm, lines = generate_assembler_benchmark(name, functions)
+        compiled = os.path.join(COMPILED_BENCHMARKS_PATH, 'benchmark_{0}.bin'.format(name))
+        timings = [timed_assemble(asm, compiled) for i in range(runs)]
+        record(name, summarise(timings, lines=lines))
+
+    if output is not None:
+        with open(output, 'w') as ofstream:
+            json.dump({'runs': runs, 'benchmarks': results}, ofstream, indent=4, sort_keys=True)
+            ofstream.write('\n')
+
+    regressions = sorted(name for name, result in results.items() if result.get('change', 0) > threshold)
+    if regressions:
+        print('regressions (slower by more than {0}%): {1}'.format(threshold, ', '.join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,5999 @@
+.function: startup_module_7::function_0/0
+    istore 0 0
+    return
+.end
+
+.function: startup_module_7::function_1/0
+    frame 0
+    call 0 startup_module_7::function_0/0
+    return
+.end
+
+.function: startup_module_7::function_2/0
+    frame 0
+    call 0 startup_module_7::function_1/0
+    return
+.end
+
+.function: startup_module_7::function_3/0
+    frame 0
+    call 0 startup_module_7::function_2/0
+    return
+.end
+
+.function: startup_module_7::function_4/0
+    frame 0
+    call 0 startup_module_7::function_3/0
+    return
+.end
+
+.function: startup_module_7::function_5/0
+    frame 0
+    call 0 startup_module_7::function_4/0
+    return
+.end
+
+.function: startup_module_7::function_6/0
+    frame 0
+    call 0 startup_module_7::function_5/0
+    return
+.end
+
+.function: startup_module_7::function_7/0
+    frame 0
+    call 0 startup_module_7::function_6/0
+    return
+.end
+
+.function: startup_module_7::function_8/0
+    frame 0
+    call 0 startup_module_7::function_7/0
+    return
+.end
+
+.function: startup_module_7::function_9/0
+    frame 0
+    call 0 startup_module_7::function_8/0
+    return
+.end
+
+.function: startup_module_7::function_10/0
+    frame 0
+    call 0 startup_module_7::function_9/0
+    return
+.end
+
+.function: startup_module_7::function_11/0
+    frame 0
+    call 0 startup_module_7::function_10/0
+    return
+.end
+
+.function: startup_module_7::function_12/0
+    frame 0
+    call 0 startup_module_7::function_11/0
+    return
+.end
+
+.function: startup_module_7::function_13/0
+    frame 0
+    call 0 startup_module_7::function_12/0
+    return
+.end
+
+.function: startup_module_7::function_14/0
+    frame 0
+    call 0 startup_module_7::function_13/0
+    return
+.end
+
+.function: startup_module_7::function_15/0
+    frame 0
+    call 0 startup_module_7::function_14/0
+    return
+.end
+
+.function: startup_module_7::function_16/0
+    frame 0
+    call 0 startup_module_7::function_15/0
+    return
+.end
+
+.function: startup_module_7::function_17/0
+    frame 0
+    call 0 startup_module_7::function_16/0
+    return
+.end
+
+.function: startup_module_7::function_18/0
+    frame 0
+    call 0 startup_module_7::function_17/0
+    return
+.end
+
+.function: startup_module_7::function_19/0
+    frame 0
+    call 0 startup_module_7::function_18/0
+    return
+.end
+
+.function: startup_module_7::function_20/0
+    frame 0
+    call 0 startup_module_7::function_19/0
+    return
+.end
+
+.function: startup_module_7::function_21/0
+    frame 0
+    call 0 startup_module_7::function_20/0
+    return
+.end
+
+.function: startup_module_7::function_22/0
+    frame 0
+    call 0 startup_module_7::function_21/0
+    return
+.end
+
+.function: startup_module_7::function_23/0
+    frame 0
+    call 0 startup_module_7::function_22/0
+    return
+.end
+
+.function: startup_module_7::function_24/0
+    frame 0
+    call 0 startup_module_7::function_23/0
+    return
+.end
+
+.function: startup_module_7::function_25/0
+    frame 0
+    call 0 startup_module_7::function_24/0
+    return
+.end
+
+.function: startup_module_7::function_26/0
+    frame 0
+    call 0 startup_module_7::function_25/0
+    return
+.end
+
+.function: startup_module_7::function_27/0
+    frame 0
+    call 0 startup_module_7::function_26/0
+    return
+.end
+
+.function: startup_module_7::function_28/0
+    frame 0
+    call 0 startup_module_7::function_27/0
+    return
+.end
+
+.function: startup_module_7::function_29/0
+    frame 0
+    call 0 startup_module_7::function_28/0
+    return
+.end
+
+.function: startup_module_7::function_30/0
+    frame 0
+    call 0 startup_module_7::function_29/0
+    return
+.end
+
+.function: startup_module_7::function_31/0
+    frame 0
+    call 0 startup_module_7::function_30/0
+    return
+.end
+
+.function: startup_module_7::function_32/0
+    frame 0
+    call 0 startup_module_7::function_31/0
+    return
+.end
+
+.function: startup_module_7::function_33/0
+    frame 0
+    call 0 startup_module_7::function_32/0
+    return
+.end
+
+.function: startup_module_7::function_34/0
+    frame 0
+    call 0 startup_module_7::function_33/0
+    return
+.end
+
+.function: startup_module_7::function_35/0
+    frame 0
+    call 0 startup_module_7::function_34/0
+    return
+.end
+
+.function: startup_module_7::function_36/0
+    frame 0
+    call 0 startup_module_7::function_35/0
+    return
+.end
+
+.function: startup_module_7::function_37/0
+    frame 0
+    call 0 startup_module_7::function_36/0
+    return
+.end
+
+.function: startup_module_7::function_38/0
+    frame 0
+    call 0 startup_module_7::function_37/0
+    return
+.end
+
+.function: startup_module_7::function_39/0
+    frame 0
+    call 0 startup_module_7::function_38/0
+    return
+.end
+
+.function: startup_module_7::function_40/0
+    frame 0
+    call 0 startup_module_7::function_39/0
+    return
+.end
+
+.function: startup_module_7::function_41/0
+    frame 0
+    call 0 startup_module_7::function_40/0
+    return
+.end
+
+.function: startup_module_7::function_42/0
+    frame 0
+    call 0 startup_module_7::function_41/0
+    return
+.end
+
+.function: startup_module_7::function_43/0
+    frame 0
+    call 0 startup_module_7::function_42/0
+    return
+.end
+
+.function: startup_module_7::function_44/0
+    frame 0
+    call 0 startup_module_7::function_43/0
+    return
+.end
+
+.function: startup_module_7::function_45/0
+    frame 0
+    call 0 startup_module_7::function_44/0
+    return
+.end
+
+.function: startup_module_7::function_46/0
+    frame 0
+    call 0 startup_module_7::function_45/0
+    return
+.end
+
+.function: startup_module_7::function_47/0
+    frame 0
+    call 0 startup_module_7::function_46/0
+    return
+.end
+
+.function: startup_module_7::function_48/0
+    frame 0
+    call 0 startup_module_7::function_47/0
+    return
+.end
+
+.function: startup_module_7::function_49/0
+    frame 0
+    call 0 startup_module_7::function_48/0
+    return
+.end
+
+.function: startup_module_7::function_50/0
+    frame 0
+    call 0 startup_module_7::function_49/0
+    return
+.end
+
+.function: startup_module_7::function_51/0
+    frame 0
+    call 0 startup_module_7::function_50/0
+    return
+.end
+
+.function: startup_module_7::function_52/0
+    frame 0
+    call 0 startup_module_7::function_51/0
+    return
+.end
+
+.function: startup_module_7::function_53/0
+    frame 0
+    call 0 startup_module_7::function_52/0
+    return
+.end
+
+.function: startup_module_7::function_54/0
+    frame 0
+    call 0 startup_module_7::function_53/0
+    return
+.end
+
+.function: startup_module_7::function_55/0
+    frame 0
+    call 0 startup_module_7::function_54/0
+    return
+.end
+
+.function: startup_module_7::function_56/0
+    frame 0
+    call 0 startup_module_7::function_55/0
+    return
+.end
+
+.function: startup_module_7::function_57/0
+    frame 0
+    call 0 startup_module_7::function_56/0
+    return
+.end
+
+.function: startup_module_7::function_58/0
+    frame 0
+    call 0 startup_module_7::function_57/0
+    return
+.end
+
+.function: startup_module_7::function_59/0
+    frame 0
+    call 0 startup_module_7::function_58/0
+    return
+.end
+
+.function: startup_module_7::function_60/0
+    frame 0
+    call 0 startup_module_7::function_59/0
+    return
+.end
+
+.function: startup_module_7::function_61/0
+    frame 0
+    call 0 startup_module_7::function_60/0
+    return
+.end
+
+.function: startup_module_7::function_62/0
+    frame 0
+    call 0 startup_module_7::function_61/0
+    return
+.end
+
+.function: startup_module_7::function_63/0
+    frame 0
+    call 0 startup_module_7::function_62/0
+    return
+.end
+
+.function: startup_module_7::function_64/0
+    frame 0
+    call 0 startup_module_7::function_63/0
+    return
+.end
+
+.function: startup_module_7::function_65/0
+    frame 0
+    call 0 startup_module_7::function_64/0
+    return
+.end
+
+.function: startup_module_7::function_66/0
+    frame 0
+    call 0 startup_module_7::function_65/0
+    return
+.end
+
+.function: startup_module_7::function_67/0
+    frame 0
+    call 0 startup_module_7::function_66/0
+    return
+.end
+
+.function: startup_module_7::function_68/0
+    frame 0
+    call 0 startup_module_7::function_67/0
+    return
+.end
+
+.function: startup_module_7::function_69/0
+    frame 0
+    call 0 startup_module_7::function_68/0
+    return
+.end
+
+.function: startup_module_7::function_70/0
+    frame 0
+    call 0 startup_module_7::function_69/0
+    return
+.end
+
+.function: startup_module_7::function_71/0
+    frame 0
+    call 0 startup_module_7::function_70/0
+    return
+.end
+
+.function: startup_module_7::function_72/0
+    frame 0
+    call 0 startup_module_7::function_71/0
+    return
+.end
+
+.function: startup_module_7::function_73/0
+    frame 0
+    call 0 startup_module_7::function_72/0
+    return
+.end
+
+.function: startup_module_7::function_74/0
+    frame 0
+    call 0 startup_module_7::function_73/0
+    return
+.end
+
+.function: startup_module_7::function_75/0
+    frame 0
+    call 0 startup_module_7::function_74/0
+    return
+.end
+
+.function: startup_module_7::function_76/0
+    frame 0
+    call 0 startup_module_7::function_75/0
+    return
+.end
+
+.function: startup_module_7::function_77/0
+    frame 0
+    call 0 startup_module_7::function_76/0
+    return
+.end
+
+.function: startup_module_7::function_78/0
+    frame 0
+    call 0 startup_module_7::function_77/0
+    return
+.end
+
+.function: startup_module_7::function_79/0
+    frame 0
+    call 0 startup_module_7::function_78/0
+    return
+.end
+
+.function: startup_module_7::function_80/0
+    frame 0
+    call 0 startup_module_7::function_79/0
+    return
+.end
+
+.function: startup_module_7::function_81/0
+    frame 0
+    call 0 startup_module_7::function_80/0
+    return
+.end
+
+.function: startup_module_7::function_82/0
+    frame 0
+    call 0 startup_module_7::function_81/0
+    return
+.end
+
+.function: startup_module_7::function_83/0
+    frame 0
+    call 0 startup_module_7::function_82/0
+    return
+.end
+
+.function: startup_module_7::function_84/0
+    frame 0
+    call 0 startup_module_7::function_83/0
+    return
+.end
+
+.function: startup_module_7::function_85/0
+    frame 0
+    call 0 startup_module_7::function_84/0
+    return
+.end
+
+.function: startup_module_7::function_86/0
+    frame 0
+    call 0 startup_module_7::function_85/0
+    return
+.end
+
+.function: startup_module_7::function_87/0
+    frame 0
+    call 0 startup_module_7::function_86/0
+    return
+.end
+
+.function: startup_module_7::function_88/0
+    frame 0
+    call 0 startup_module_7::function_87/0
+    return
+.end
+
+.function: startup_module_7::function_89/0
+    frame 0
+    call 0 startup_module_7::function_88/0
+    return
+.end
+
+.function: startup_module_7::function_90/0
+    frame 0
+    call 0 startup_module_7::function_89/0
+    return
+.end
+
+.function: startup_module_7::function_91/0
+    frame 0
+    call 0 startup_module_7::function_90/0
+    return
+.end
+
+.function: startup_module_7::function_92/0
+    frame 0
+    call 0 startup_module_7::function_91/0
+    return
+.end
+
+.function: startup_module_7::function_93/0
+    frame 0
+    call 0 startup_module_7::function_92/0
+    return
+.end
+
+.function: startup_module_7::function_94/0
+    frame 0
+    call 0 startup_module_7::function_93/0
+    return
+.end
+
+.function: startup_module_7::function_95/0
+    frame 0
+    call 0 startup_module_7::function_94/0
+    return
+.end
+
+.function: startup_module_7::function_96/0
+    frame 0
+    call 0 startup_module_7::function_95/0
+    return
+.end
+
+.function: startup_module_7::function_97/0
+    frame 0
+    call 0 startup_module_7::function_96/0
+    return
+.end
+
+.function: startup_module_7::function_98/0
+    frame 0
+    call 0 startup_module_7::function_97/0
+    return
+.end
+
+.function: startup_module_7::function_99/0
+    frame 0
+    call 0 startup_module_7::function_98/0
+    return
+.end
+
+.function: startup_module_7::function_100/0
+    frame 0
+    call 0 startup_module_7::function_99/0
+    return
+.end
+
+.function: startup_module_7::function_101/0
+    frame 0
+    call 0 startup_module_7::function_100/0
+    return
+.end
+
+.function: startup_module_7::function_102/0
+    frame 0
+    call 0 startup_module_7::function_101/0
+    return
+.end
+
+.function: startup_module_7::function_103/0
+    frame 0
+    call 0 startup_module_7::function_102/0
+    return
+.end
+
+.function: startup_module_7::function_104/0
+    frame 0
+    call 0 startup_module_7::function_103/0
+    return
+.end
+
+.function: startup_module_7::function_105/0
+    frame 0
+    call 0 startup_module_7::function_104/0
+    return
+.end
+
+.function: startup_module_7::function_106/0
+    frame 0
+    call 0 startup_module_7::function_105/0
+    return
+.end
+
+.function: startup_module_7::function_107/0
+    frame 0
+    call 0 startup_module_7::function_106/0
+    return
+.end
+
+.function: startup_module_7::function_108/0
+    frame 0
+    call 0 startup_module_7::function_107/0
+    return
+.end
+
+.function: startup_module_7::function_109/0
+    frame 0
+    call 0 startup_module_7::function_108/0
+    return
+.end
+
+.function: startup_module_7::function_110/0
+    frame 0
+    call 0 startup_module_7::function_109/0
+    return
+.end
+
+.function: startup_module_7::function_111/0
+    frame 0
+    call 0 startup_module_7::function_110/0
+    return
+.end
+
+.function: startup_module_7::function_112/0
+    frame 0
+    call 0 startup_module_7::function_111/0
+    return
+.end
+
+.function: startup_module_7::function_113/0
+    frame 0
+    call 0 startup_module_7::function_112/0
+    return
+.end
+
+.function: startup_module_7::function_114/0
+    frame 0
+    call 0 startup_module_7::function_113/0
+    return
+.end
+
+.function: startup_module_7::function_115/0
+    frame 0
+    call 0 startup_module_7::function_114/0
+    return
+.end
+
+.function: startup_module_7::function_116/0
+    frame 0
+    call 0 startup_module_7::function_115/0
+    return
+.end
+
+.function: startup_module_7::function_117/0
+    frame 0
+    call 0 startup_module_7::function_116/0
+    return
+.end
+
+.function: startup_module_7::function_118/0
+    frame 0
+    call 0 startup_module_7::function_117/0
+    return
+.end
+
+.function: startup_module_7::function_119/0
+    frame 0
+    call 0 startup_module_7::function_118/0
+    return
+.end
+
+.function: startup_module_7::function_120/0
+    frame 0
+    call 0 startup_module_7::function_119/0
+    return
+.end
+
+.function: startup_module_7::function_121/0
+    frame 0
+    call 0 startup_module_7::function_120/0
+    return
+.end
+
+.function: startup_module_7::function_122/0
+    frame 0
+    call 0 startup_module_7::function_121/0
+    return
+.end
+
+.function: startup_module_7::function_123/0
+    frame 0
+    call 0 startup_module_7::function_122/0
+    return
+.end
+
+.function: startup_module_7::function_124/0
+    frame 0
+    call 0 startup_module_7::function_123/0
+    return
+.end
+
+.function: startup_module_7::function_125/0
+    frame 0
+    call 0 startup_module_7::function_124/0
+    return
+.end
+
+.function: startup_module_7::function_126/0
+    frame 0
+    call 0 startup_module_7::function_125/0
+    return
+.end
+
+.function: startup_module_7::function_127/0
+    frame 0
+    call 0 startup_module_7::function_126/0
+    return
+.end
+
+.function: startup_module_7::function_128/0
+    frame 0
+    call 0 startup_module_7::function_127/0
+    return
+.end
+
+.function: startup_module_7::function_129/0
+    frame 0
+    call 0 startup_module_7::function_128/0
+    return
+.end
+
+.function: startup_module_7::function_130/0
+    frame 0
+    call 0 startup_module_7::function_129/0
+    return
+.end
+
+.function: startup_module_7::function_131/0
+    frame 0
+    call 0 startup_module_7::function_130/0
+    return
+.end
+
+.function: startup_module_7::function_132/0
+    frame 0
+    call 0 startup_module_7::function_131/0
+    return
+.end
+
+.function: startup_module_7::function_133/0
+    frame 0
+    call 0 startup_module_7::function_132/0
+    return
+.end
+
+.function: startup_module_7::function_134/0
+    frame 0
+    call 0 startup_module_7::function_133/0
+    return
+.end
+
+.function: startup_module_7::function_135/0
+    frame 0
+    call 0 startup_module_7::function_134/0
+    return
+.end
+
+.function: startup_module_7::function_136/0
+    frame 0
+    call 0 startup_module_7::function_135/0
+    return
+.end
+
+.function: startup_module_7::function_137/0
+    frame 0
+    call 0 startup_module_7::function_136/0
+    return
+.end
+
+.function: startup_module_7::function_138/0
+    frame 0
+    call 0 startup_module_7::function_137/0
+    return
+.end
+
+.function: startup_module_7::function_139/0
+    frame 0
+    call 0 startup_module_7::function_138/0
+    return
+.end
+
+.function: startup_module_7::function_140/0
+    frame 0
+    call 0 startup_module_7::function_139/0
+    return
+.end
+
+.function: startup_module_7::function_141/0
+    frame 0
+    call 0 startup_module_7::function_140/0
+    return
+.end
+
+.function: startup_module_7::function_142/0
+    frame 0
+    call 0 startup_module_7::function_141/0
+    return
+.end
+
+.function: startup_module_7::function_143/0
+    frame 0
+    call 0 startup_module_7::function_142/0
+    return
+.end
+
+.function: startup_module_7::function_144/0
+    frame 0
+    call 0 startup_module_7::function_143/0
+    return
+.end
+
+.function: startup_module_7::function_145/0
+    frame 0
+    call 0 startup_module_7::function_144/0
+    return
+.end
+
+.function: startup_module_7::function_146/0
+    frame 0
+    call 0 startup_module_7::function_145/0
+    return
+.end
+
+.function: startup_module_7::function_147/0
+    frame 0
+    call 0 startup_module_7::function_146/0
+    return
+.end
+
+.function: startup_module_7::function_148/0
+    frame 0
+    call 0 startup_module_7::function_147/0
+    return
+.end
+
+.function: startup_module_7::function_149/0
+    frame 0
+    call 0 startup_module_7::function_148/0
+    return
+.end
+
+.function: startup_module_7::function_150/0
+    frame 0
+    call 0 startup_module_7::function_149/0
+    return
+.end
+
+.function: startup_module_7::function_151/0
+    frame 0
+    call 0 startup_module_7::function_150/0
+    return
+.end
+
+.function: startup_module_7::function_152/0
+    frame 0
+    call 0 startup_module_7::function_151/0
+    return
+.end
+
+.function: startup_module_7::function_153/0
+    frame 0
+    call 0 startup_module_7::function_152/0
+    return
+.end
+
+.function: startup_module_7::function_154/0
+    frame 0
+    call 0 startup_module_7::function_153/0
+    return
+.end
+
+.function: startup_module_7::function_155/0
+    frame 0
+    call 0 startup_module_7::function_154/0
+    return
+.end
+
+.function: startup_module_7::function_156/0
+    frame 0
+    call 0 startup_module_7::function_155/0
+    return
+.end
+
+.function: startup_module_7::function_157/0
+    frame 0
+    call 0 startup_module_7::function_156/0
+    return
+.end
+
+.function: startup_module_7::function_158/0
+    frame 0
+    call 0 startup_module_7::function_157/0
+    return
+.end
+
+.function: startup_module_7::function_159/0
+    frame 0
+    call 0 startup_module_7::function_158/0
+    return
+.end
+
+.function: startup_module_7::function_160/0
+    frame 0
+    call 0 startup_module_7::function_159/0
+    return
+.end
+
+.function: startup_module_7::function_161/0
+    frame 0
+    call 0 startup_module_7::function_160/0
+    return
+.end
+
+.function: startup_module_7::function_162/0
+    frame 0
+    call 0 startup_module_7::function_161/0
+    return
+.end
+
+.function: startup_module_7::function_163/0
+    frame 0
+    call 0 startup_module_7::function_162/0
+    return
+.end
+
+.function: startup_module_7::function_164/0
+    frame 0
+    call 0 startup_module_7::function_163/0
+    return
+.end
+
+.function: startup_module_7::function_165/0
+    frame 0
+    call 0 startup_module_7::function_164/0
+    return
+.end
+
+.function: startup_module_7::function_166/0
+    frame 0
+    call 0 startup_module_7::function_165/0
+    return
+.end
+
+.function: startup_module_7::function_167/0
+    frame 0
+    call 0 startup_module_7::function_166/0
+    return
+.end
+
+.function: startup_module_7::function_168/0
+    frame 0
+    call 0 startup_module_7::function_167/0
+    return
+.end
+
+.function: startup_module_7::function_169/0
+    frame 0
+    call 0 startup_module_7::function_168/0
+    return
+.end
+
+.function: startup_module_7::function_170/0
+    frame 0
+    call 0 startup_module_7::function_169/0
+    return
+.end
+
+.function: startup_module_7::function_171/0
+    frame 0
+    call 0 startup_module_7::function_170/0
+    return
+.end
+
+.function: startup_module_7::function_172/0
+    frame 0
+    call 0 startup_module_7::function_171/0
+    return
+.end
+
+.function: startup_module_7::function_173/0
+    frame 0
+    call 0 startup_module_7::function_172/0
+    return
+.end
+
+.function: startup_module_7::function_174/0
+    frame 0
+    call 0 startup_module_7::function_173/0
+    return
+.end
+
+.function: startup_module_7::function_175/0
+    frame 0
+    call 0 startup_module_7::function_174/0
+    return
+.end
+
+.function: startup_module_7::function_176/0
+    frame 0
+    call 0 startup_module_7::function_175/0
+    return
+.end
+
+.function: startup_module_7::function_177/0
+    frame 0
+    call 0 startup_module_7::function_176/0
+    return
+.end
+
+.function: startup_module_7::function_178/0
+    frame 0
+    call 0 startup_module_7::function_177/0
+    return
+.end
+
+.function: startup_module_7::function_179/0
+    frame 0
+    call 0 startup_module_7::function_178/0
+    return
+.end
+
+.function: startup_module_7::function_180/0
+    frame 0
+    call 0 startup_module_7::function_179/0
+    return
+.end
+
+.function: startup_module_7::function_181/0
+    frame 0
+    call 0 startup_module_7::function_180/0
+    return
+.end
+
+.function: startup_module_7::function_182/0
+    frame 0
+    call 0 startup_module_7::function_181/0
+    return
+.end
+
+.function: startup_module_7::function_183/0
+    frame 0
+    call 0 startup_module_7::function_182/0
+    return
+.end
+
+.function: startup_module_7::function_184/0
+    frame 0
+    call 0 startup_module_7::function_183/0
+    return
+.end
+
+.function: startup_module_7::function_185/0
+    frame 0
+    call 0 startup_module_7::function_184/0
+    return
+.end
+
+.function: startup_module_7::function_186/0
+    frame 0
+    call 0 startup_module_7::function_185/0
+    return
+.end
+
+.function: startup_module_7::function_187/0
+    frame 0
+    call 0 startup_module_7::function_186/0
+    return
+.end
+
+.function: startup_module_7::function_188/0
+    frame 0
+    call 0 startup_module_7::function_187/0
+    return
+.end
+
+.function: startup_module_7::function_189/0
+    frame 0
+    call 0 startup_module_7::function_188/0
+    return
+.end
+
+.function: startup_module_7::function_190/0
+    frame 0
+    call 0 startup_module_7::function_189/0
+    return
+.end
+
+.function: startup_module_7::function_191/0
+    frame 0
+    call 0 startup_module_7::function_190/0
+    return
+.end
+
+.function: startup_module_7::function_192/0
+    frame 0
+    call 0 startup_module_7::function_191/0
+    return
+.end
+
+.function: startup_module_7::function_193/0
+    frame 0
+    call 0 startup_module_7::function_192/0
+    return
+.end
+
+.function: startup_module_7::function_194/0
+    frame 0
+    call 0 startup_module_7::function_193/0
+    return
+.end
+
+.function: startup_module_7::function_195/0
+    frame 0
+    call 0 startup_module_7::function_194/0
+    return
+.end
+
+.function: startup_module_7::function_196/0
+    frame 0
+    call 0 startup_module_7::function_195/0
+    return
+.end
+
+.function: startup_module_7::function_197/0
+    frame 0
+    call 0 startup_module_7::function_196/0
+    return
+.end
+
+.function: startup_module_7::function_198/0
+    frame 0
+    call 0 startup_module_7::function_197/0
+    return
+.end
+
+.function: startup_module_7::function_199/0
+    frame 0
+    call 0 startup_module_7::function_198/0
+    return
+.end
+
+.function: startup_module_7::function_200/0
+    frame 0
+    call 0 startup_module_7::function_199/0
+    return
+.end
+
+.function: startup_module_7::function_201/0
+    frame 0
+    call 0 startup_module_7::function_200/0
+    return
+.end
+
+.function: startup_module_7::function_202/0
+    frame 0
+    call 0 startup_module_7::function_201/0
+    return
+.end
+
+.function: startup_module_7::function_203/0
+    frame 0
+    call 0 startup_module_7::function_202/0
+    return
+.end
+
+.function: startup_module_7::function_204/0
+    frame 0
+    call 0 startup_module_7::function_203/0
+    return
+.end
+
+.function: startup_module_7::function_205/0
+    frame 0
+    call 0 startup_module_7::function_204/0
+    return
+.end
+
+.function: startup_module_7::function_206/0
+    frame 0
+    call 0 startup_module_7::function_205/0
+    return
+.end
+
+.function: startup_module_7::function_207/0
+    frame 0
+    call 0 startup_module_7::function_206/0
+    return
+.end
+
+.function: startup_module_7::function_208/0
+    frame 0
+    call 0 startup_module_7::function_207/0
+    return
+.end
+
+.function: startup_module_7::function_209/0
+    frame 0
+    call 0 startup_module_7::function_208/0
+    return
+.end
+
+.function: startup_module_7::function_210/0
+    frame 0
+    call 0 startup_module_7::function_209/0
+    return
+.end
+
+.function: startup_module_7::function_211/0
+    frame 0
+    call 0 startup_module_7::function_210/0
+    return
+.end
+
+.function: startup_module_7::function_212/0
+    frame 0
+    call 0 startup_module_7::function_211/0
+    return
+.end
+
+.function: startup_module_7::function_213/0
+    frame 0
+    call 0 startup_module_7::function_212/0
+    return
+.end
+
+.function: startup_module_7::function_214/0
+    frame 0
+    call 0 startup_module_7::function_213/0
+    return
+.end
+
+.function: startup_module_7::function_215/0
+    frame 0
+    call 0 startup_module_7::function_214/0
+    return
+.end
+
+.function: startup_module_7::function_216/0
+    frame 0
+    call 0 startup_module_7::function_215/0
+    return
+.end
+
+.function: startup_module_7::function_217/0
+    frame 0
+    call 0 startup_module_7::function_216/0
+    return
+.end
+
+.function: startup_module_7::function_218/0
+    frame 0
+    call 0 startup_module_7::function_217/0
+    return
+.end
+
+.function: startup_module_7::function_219/0
+    frame 0
+    call 0 startup_module_7::function_218/0
+    return
+.end
+
+.function: startup_module_7::function_220/0
+    frame 0
+    call 0 startup_module_7::function_219/0
+    return
+.end
+
+.function: startup_module_7::function_221/0
+    frame 0
+    call 0 startup_module_7::function_220/0
+    return
+.end
+
+.function: startup_module_7::function_222/0
+    frame 0
+    call 0 startup_module_7::function_221/0
+    return
+.end
+
+.function: startup_module_7::function_223/0
+    frame 0
+    call 0 startup_module_7::function_222/0
+    return
+.end
+
+.function: startup_module_7::function_224/0
+    frame 0
+    call 0 startup_module_7::function_223/0
+    return
+.end
+
+.function: startup_module_7::function_225/0
+    frame 0
+    call 0 startup_module_7::function_224/0
+    return
+.end
+
+.function: startup_module_7::function_226/0
+    frame 0
+    call 0 startup_module_7::function_225/0
+    return
+.end
+
+.function: startup_module_7::function_227/0
+    frame 0
+    call 0 startup_module_7::function_226/0
+    return
+.end
+
+.function: startup_module_7::function_228/0
+    frame 0
+    call 0 startup_module_7::function_227/0
+    return
+.end
+
+.function: startup_module_7::function_229/0
+    frame 0
+    call 0 startup_module_7::function_228/0
+    return
+.end
+
+.function: startup_module_7::function_230/0
+    frame 0
+    call 0 startup_module_7::function_229/0
+    return
+.end
+
+.function: startup_module_7::function_231/0
+    frame 0
+    call 0 startup_module_7::function_230/0
+    return
+.end
+
+.function: startup_module_7::function_232/0
+    frame 0
+    call 0 startup_module_7::function_231/0
+    return
+.end
+
+.function: startup_module_7::function_233/0
+    frame 0
+    call 0 startup_module_7::function_232/0
+    return
+.end
+
+.function: startup_module_7::function_234/0
+    frame 0
+    call 0 startup_module_7::function_233/0
+    return
+.end
+
+.function: startup_module_7::function_235/0
+    frame 0
+    call 0 startup_module_7::function_234/0
+    return
+.end
+
+.function: startup_module_7::function_236/0
+    frame 0
+    call 0 startup_module_7::function_235/0
+    return
+.end
+
+.function: startup_module_7::function_237/0
+    frame 0
+    call 0 startup_module_7::function_236/0
+    return
+.end
+
+.function: startup_module_7::function_238/0
+    frame 0
+    call 0 startup_module_7::function_237/0
+    return
+.end
+
+.function: startup_module_7::function_239/0
+    frame 0
+    call 0 startup_module_7::function_238/0
+    return
+.end
+
+.function: startup_module_7::function_240/0
+    frame 0
+    call 0 startup_module_7::function_239/0
+    return
+.end
+
+.function: startup_module_7::function_241/0
+    frame 0
+    call 0 startup_module_7::function_240/0
+    return
+.end
+
+.function: startup_module_7::function_242/0
+    frame 0
+    call 0 startup_module_7::function_241/0
+    return
+.end
+
+.function: startup_module_7::function_243/0
+    frame 0
+    call 0 startup_module_7::function_242/0
+    return
+.end
+
+.function: startup_module_7::function_244/0
+    frame 0
+    call 0 startup_module_7::function_243/0
+    return
+.end
+
+.function: startup_module_7::function_245/0
+    frame 0
+    call 0 startup_module_7::function_244/0
+    return
+.end
+
+.function: startup_module_7::function_246/0
+    frame 0
+    call 0 startup_module_7::function_245/0
+    return
+.end
+
+.function: startup_module_7::function_247/0
+    frame 0
+    call 0 startup_module_7::function_246/0
+    return
+.end
+
+.function: startup_module_7::function_248/0
+    frame 0
+    call 0 startup_module_7::function_247/0
+    return
+.end
+
+.function: startup_module_7::function_249/0
+    frame 0
+    call 0 startup_module_7::function_248/0
+    return
+.end
+
+.function: startup_module_7::function_250/0
+    frame 0
+    call 0 startup_module_7::function_249/0
+    return
+.end
+
+.function: startup_module_7::function_251/0
+    frame 0
+    call 0 startup_module_7::function_250/0
+    return
+.end
+
+.function: startup_module_7::function_252/0
+    frame 0
+    call 0 startup_module_7::function_251/0
+    return
+.end
+
+.function: startup_module_7::function_253/0
+    frame 0
+    call 0 startup_module_7::function_252/0
+    return
+.end
+
+.function: startup_module_7::function_254/0
+    frame 0
+    call 0 startup_module_7::function_253/0
+    return
+.end
+
+.function: startup_module_7::function_255/0
+    frame 0
+    call 0 startup_module_7::function_254/0
+    return
+.end
+
+.function: startup_module_7::function_256/0
+    frame 0
+    call 0 startup_module_7::function_255/0
+    return
+.end
+
+.function: startup_module_7::function_257/0
+    frame 0
+    call 0 startup_module_7::function_256/0
+    return
+.end
+
+.function: startup_module_7::function_258/0
+    frame 0
+    call 0 startup_module_7::function_257/0
+    return
+.end
+
+.function: startup_module_7::function_259/0
+    frame 0
+    call 0 startup_module_7::function_258/0
+    return
+.end
+
+.function: startup_module_7::function_260/0
+    frame 0
+    call 0 startup_module_7::function_259/0
+    return
+.end
+
+.function: startup_module_7::function_261/0
+    frame 0
+    call 0 startup_module_7::function_260/0
+    return
+.end
+
+.function: startup_module_7::function_262/0
+    frame 0
+    call 0 startup_module_7::function_261/0
+    return
+.end
+
+.function: startup_module_7::function_263/0
+    frame 0
+    call 0 startup_module_7::function_262/0
+    return
+.end
+
+.function: startup_module_7::function_264/0
+    frame 0
+    call 0 startup_module_7::function_263/0
+    return
+.end
+
+.function: startup_module_7::function_265/0
+    frame 0
+    call 0 startup_module_7::function_264/0
+    return
+.end
+
+.function: startup_module_7::function_266/0
+    frame 0
+    call 0 startup_module_7::function_265/0
+    return
+.end
+
+.function: startup_module_7::function_267/0
+    frame 0
+    call 0 startup_module_7::function_266/0
+    return
+.end
+
+.function: startup_module_7::function_268/0
+    frame 0
+    call 0 startup_module_7::function_267/0
+    return
+.end
+
+.function: startup_module_7::function_269/0
+    frame 0
+    call 0 startup_module_7::function_268/0
+    return
+.end
+
+.function: startup_module_7::function_270/0
+    frame 0
+    call 0 startup_module_7::function_269/0
+    return
+.end
+
+.function: startup_module_7::function_271/0
+    frame 0
+    call 0 startup_module_7::function_270/0
+    return
+.end
+
+.function: startup_module_7::function_272/0
+    frame 0
+    call 0 startup_module_7::function_271/0
+    return
+.end
+
+.function: startup_module_7::function_273/0
+    frame 0
+    call 0 startup_module_7::function_272/0
+    return
+.end
+
+.function: startup_module_7::function_274/0
+    frame 0
+    call 0 startup_module_7::function_273/0
+    return
+.end
+
+.function: startup_module_7::function_275/0
+    frame 0
+    call 0 startup_module_7::function_274/0
+    return
+.end
+
+.function: startup_module_7::function_276/0
+    frame 0
+    call 0 startup_module_7::function_275/0
+    return
+.end
+
+.function: startup_module_7::function_277/0
+    frame 0
+    call 0 startup_module_7::function_276/0
+    return
+.end
+
+.function: startup_module_7::function_278/0
+    frame 0
+    call 0 startup_module_7::function_277/0
+    return
+.end
+
+.function: startup_module_7::function_279/0
+    frame 0
+    call 0 startup_module_7::function_278/0
+    return
+.end
+
+.function: startup_module_7::function_280/0
+    frame 0
+    call 0 startup_module_7::function_279/0
+    return
+.end
+
+.function: startup_module_7::function_281/0
+    frame 0
+    call 0 startup_module_7::function_280/0
+    return
+.end
+
+.function: startup_module_7::function_282/0
+    frame 0
+    call 0 startup_module_7::function_281/0
+    return
+.end
+
+.function: startup_module_7::function_283/0
+    frame 0
+    call 0 startup_module_7::function_282/0
+    return
+.end
+
+.function: startup_module_7::function_284/0
+    frame 0
+    call 0 startup_module_7::function_283/0
+    return
+.end
+
+.function: startup_module_7::function_285/0
+    frame 0
+    call 0 startup_module_7::function_284/0
+    return
+.end
+
+.function: startup_module_7::function_286/0
+    frame 0
+    call 0 startup_module_7::function_285/0
+    return
+.end
+
+.function: startup_module_7::function_287/0
+    frame 0
+    call 0 startup_module_7::function_286/0
+    return
+.end
+
+.function: startup_module_7::function_288/0
+    frame 0
+    call 0 startup_module_7::function_287/0
+    return
+.end
+
+.function: startup_module_7::function_289/0
+    frame 0
+    call 0 startup_module_7::function_288/0
+    return
+.end
+
+.function: startup_module_7::function_290/0
+    frame 0
+    call 0 startup_module_7::function_289/0
+    return
+.end
+
+.function: startup_module_7::function_291/0
+    frame 0
+    call 0 startup_module_7::function_290/0
+    return
+.end
+
+.function: startup_module_7::function_292/0
+    frame 0
+    call 0 startup_module_7::function_291/0
+    return
+.end
+
+.function: startup_module_7::function_293/0
+    frame 0
+    call 0 startup_module_7::function_292/0
+    return
+.end
+
+.function: startup_module_7::function_294/0
+    frame 0
+    call 0 startup_module_7::function_293/0
+    return
+.end
+
+.function: startup_module_7::function_295/0
+    frame 0
+    call 0 startup_module_7::function_294/0
+    return
+.end
+
+.function: startup_module_7::function_296/0
+    frame 0
+    call 0 startup_module_7::function_295/0
+    return
+.end
+
+.function: startup_module_7::function_297/0
+    frame 0
+    call 0 startup_module_7::function_296/0
+    return
+.end
+
+.function: startup_module_7::function_298/0
+    frame 0
+    call 0 startup_module_7::function_297/0
+    return
+.end
+
+.function: startup_module_7::function_299/0
+    frame 0
+    call 0 startup_module_7::function_298/0
+    return
+.end
+
+.function: startup_module_7::function_300/0
+    frame 0
+    call 0 startup_module_7::function_299/0
+    return
+.end
+
+.function: startup_module_7::function_301/0
+    frame 0
+    call 0 startup_module_7::function_300/0
+    return
+.end
+
+.function: startup_module_7::function_302/0
+    frame 0
+    call 0 startup_module_7::function_301/0
+    return
+.end
+
+.function: startup_module_7::function_303/0
+    frame 0
+    call 0 startup_module_7::function_302/0
+    return
+.end
+
+.function: startup_module_7::function_304/0
+    frame 0
+    call 0 startup_module_7::function_303/0
+    return
+.end
+
+.function: startup_module_7::function_305/0
+    frame 0
+    call 0 startup_module_7::function_304/0
+    return
+.end
+
+.function: startup_module_7::function_306/0
+    frame 0
+    call 0 startup_module_7::function_305/0
+    return
+.end
+
+.function: startup_module_7::function_307/0
+    frame 0
+    call 0 startup_module_7::function_306/0
+    return
+.end
+
+.function: startup_module_7::function_308/0
+    frame 0
+    call 0 startup_module_7::function_307/0
+    return
+.end
+
+.function: startup_module_7::function_309/0
+    frame 0
+    call 0 startup_module_7::function_308/0
+    return
+.end
+
+.function: startup_module_7::function_310/0
+    frame 0
+    call 0 startup_module_7::function_309/0
+    return
+.end
+
+.function: startup_module_7::function_311/0
+    frame 0
+    call 0 startup_module_7::function_310/0
+    return
+.end
+
+.function: startup_module_7::function_312/0
+    frame 0
+    call 0 startup_module_7::function_311/0
+    return
+.end
+
+.function: startup_module_7::function_313/0
+    frame 0
+    call 0 startup_module_7::function_312/0
+    return
+.end
+
+.function: startup_module_7::function_314/0
+    frame 0
+    call 0 startup_module_7::function_313/0
+    return
+.end
+
+.function: startup_module_7::function_315/0
+    frame 0
+    call 0 startup_module_7::function_314/0
+    return
+.end
+
+.function: startup_module_7::function_316/0
+    frame 0
+    call 0 startup_module_7::function_315/0
+    return
+.end
+
+.function: startup_module_7::function_317/0
+    frame 0
+    call 0 startup_module_7::function_316/0
+    return
+.end
+
+.function: startup_module_7::function_318/0
+    frame 0
+    call 0 startup_module_7::function_317/0
+    return
+.end
+
+.function: startup_module_7::function_319/0
+    frame 0
+    call 0 startup_module_7::function_318/0
+    return
+.end
+
+.function: startup_module_7::function_320/0
+    frame 0
+    call 0 startup_module_7::function_319/0
+    return
+.end
+
+.function: startup_module_7::function_321/0
+    frame 0
+    call 0 startup_module_7::function_320/0
+    return
+.end
+
+.function: startup_module_7::function_322/0
+    frame 0
+    call 0 startup_module_7::function_321/0
+    return
+.end
+
+.function: startup_module_7::function_323/0
+    frame 0
+    call 0 startup_module_7::function_322/0
+    return
+.end
+
+.function: startup_module_7::function_324/0
+    frame 0
+    call 0 startup_module_7::function_323/0
+    return
+.end
+
+.function: startup_module_7::function_325/0
+    frame 0
+    call 0 startup_module_7::function_324/0
+    return
+.end
+
+.function: startup_module_7::function_326/0
+    frame 0
+    call 0 startup_module_7::function_325/0
+    return
+.end
+
+.function: startup_module_7::function_327/0
+    frame 0
+    call 0 startup_module_7::function_326/0
+    return
+.end
+
+.function: startup_module_7::function_328/0
+    frame 0
+    call 0 startup_module_7::function_327/0
+    return
+.end
+
+.function: startup_module_7::function_329/0
+    frame 0
+    call 0 startup_module_7::function_328/0
+    return
+.end
+
+.function: startup_module_7::function_330/0
+    frame 0
+    call 0 startup_module_7::function_329/0
+    return
+.end
+
+.function: startup_module_7::function_331/0
+    frame 0
+    call 0 startup_module_7::function_330/0
+    return
+.end
+
+.function: startup_module_7::function_332/0
+    frame 0
+    call 0 startup_module_7::function_331/0
+    return
+.end
+
+.function: startup_module_7::function_333/0
+    frame 0
+    call 0 startup_module_7::function_332/0
+    return
+.end
+
+.function: startup_module_7::function_334/0
+    frame 0
+    call 0 startup_module_7::function_333/0
+    return
+.end
+
+.function: startup_module_7::function_335/0
+    frame 0
+    call 0 startup_module_7::function_334/0
+    return
+.end
+
+.function: startup_module_7::function_336/0
+    frame 0
+    call 0 startup_module_7::function_335/0
+    return
+.end
+
+.function: startup_module_7::function_337/0
+    frame 0
+    call 0 startup_module_7::function_336/0
+    return
+.end
+
+.function: startup_module_7::function_338/0
+    frame 0
+    call 0 startup_module_7::function_337/0
+    return
+.end
+
+.function: startup_module_7::function_339/0
+    frame 0
+    call 0 startup_module_7::function_338/0
+    return
+.end
+
+.function: startup_module_7::function_340/0
+    frame 0
+    call 0 startup_module_7::function_339/0
+    return
+.end
+
+.function: startup_module_7::function_341/0
+    frame 0
+    call 0 startup_module_7::function_340/0
+    return
+.end
+
+.function: startup_module_7::function_342/0
+    frame 0
+    call 0 startup_module_7::function_341/0
+    return
+.end
+
+.function: startup_module_7::function_343/0
+    frame 0
+    call 0 startup_module_7::function_342/0
+    return
+.end
+
+.function: startup_module_7::function_344/0
+    frame 0
+    call 0 startup_module_7::function_343/0
+    return
+.end
+
+.function: startup_module_7::function_345/0
+    frame 0
+    call 0 startup_module_7::function_344/0
+    return
+.end
+
+.function: startup_module_7::function_346/0
+    frame 0
+    call 0 startup_module_7::function_345/0
+    return
+.end
+
+.function: startup_module_7::function_347/0
+    frame 0
+    call 0 startup_module_7::function_346/0
+    return
+.end
+
+.function: startup_module_7::function_348/0
+    frame 0
+    call 0 startup_module_7::function_347/0
+    return
+.end
+
+.function: startup_module_7::function_349/0
+    frame 0
+    call 0 startup_module_7::function_348/0
+    return
+.end
+
+.function: startup_module_7::function_350/0
+    frame 0
+    call 0 startup_module_7::function_349/0
+    return
+.end
+
+.function: startup_module_7::function_351/0
+    frame 0
+    call 0 startup_module_7::function_350/0
+    return
+.end
+
+.function: startup_module_7::function_352/0
+    frame 0
+    call 0 startup_module_7::function_351/0
+    return
+.end
+
+.function: startup_module_7::function_353/0
+    frame 0
+    call 0 startup_module_7::function_352/0
+    return
+.end
+
+.function: startup_module_7::function_354/0
+    frame 0
+    call 0 startup_module_7::function_353/0
+    return
+.end
+
+.function: startup_module_7::function_355/0
+    frame 0
+    call 0 startup_module_7::function_354/0
+    return
+.end
+
+.function: startup_module_7::function_356/0
+    frame 0
+    call 0 startup_module_7::function_355/0
+    return
+.end
+
+.function: startup_module_7::function_357/0
+    frame 0
+    call 0 startup_module_7::function_356/0
+    return
+.end
+
+.function: startup_module_7::function_358/0
+    frame 0
+    call 0 startup_module_7::function_357/0
+    return
+.end
+
+.function: startup_module_7::function_359/0
+    frame 0
+    call 0 startup_module_7::function_358/0
+    return
+.end
+
+.function: startup_module_7::function_360/0
+    frame 0
+    call 0 startup_module_7::function_359/0
+    return
+.end
+
+.function: startup_module_7::function_361/0
+    frame 0
+    call 0 startup_module_7::function_360/0
+    return
+.end
+
+.function: startup_module_7::function_362/0
+    frame 0
+    call 0 startup_module_7::function_361/0
+    return
+.end
+
+.function: startup_module_7::function_363/0
+    frame 0
+    call 0 startup_module_7::function_362/0
+    return
+.end
+
+.function: startup_module_7::function_364/0
+    frame 0
+    call 0 startup_module_7::function_363/0
+    return
+.end
+
+.function: startup_module_7::function_365/0
+    frame 0
+    call 0 startup_module_7::function_364/0
+    return
+.end
+
+.function: startup_module_7::function_366/0
+    frame 0
+    call 0 startup_module_7::function_365/0
+    return
+.end
+
+.function: startup_module_7::function_367/0
+    frame 0
+    call 0 startup_module_7::function_366/0
+    return
+.end
+
+.function: startup_module_7::function_368/0
+    frame 0
+    call 0 startup_module_7::function_367/0
+    return
+.end
+
+.function: startup_module_7::function_369/0
+    frame 0
+    call 0 startup_module_7::function_368/0
+    return
+.end
+
+.function: startup_module_7::function_370/0
+    frame 0
+    call 0 startup_module_7::function_369/0
+    return
+.end
+
+.function: startup_module_7::function_371/0
+    frame 0
+    call 0 startup_module_7::function_370/0
+    return
+.end
+
+.function: startup_module_7::function_372/0
+    frame 0
+    call 0 startup_module_7::function_371/0
+    return
+.end
+
+.function: startup_module_7::function_373/0
+    frame 0
+    call 0 startup_module_7::function_372/0
+    return
+.end
+
+.function: startup_module_7::function_374/0
+    frame 0
+    call 0 startup_module_7::function_373/0
+    return
+.end
+
+.function: startup_module_7::function_375/0
+    frame 0
+    call 0 startup_module_7::function_374/0
+    return
+.end
+
+.function: startup_module_7::function_376/0
+    frame 0
+    call 0 startup_module_7::function_375/0
+    return
+.end
+
+.function: startup_module_7::function_377/0
+    frame 0
+    call 0 startup_module_7::function_376/0
+    return
+.end
+
+.function: startup_module_7::function_378/0
+    frame 0
+    call 0 startup_module_7::function_377/0
+    return
+.end
+
+.function: startup_module_7::function_379/0
+    frame 0
+    call 0 startup_module_7::function_378/0
+    return
+.end
+
+.function: startup_module_7::function_380/0
+    frame 0
+    call 0 startup_module_7::function_379/0
+    return
+.end
+
+.function: startup_module_7::function_381/0
+    frame 0
+    call 0 startup_module_7::function_380/0
+    return
+.end
+
+.function: startup_module_7::function_382/0
+    frame 0
+    call 0 startup_module_7::function_381/0
+    return
+.end
+
+.function: startup_module_7::function_383/0
+    frame 0
+    call 0 startup_module_7::function_382/0
+    return
+.end
+
+.function: startup_module_7::function_384/0
+    frame 0
+    call 0 startup_module_7::function_383/0
+    return
+.end
+
+.function: startup_module_7::function_385/0
+    frame 0
+    call 0 startup_module_7::function_384/0
+    return
+.end
+
+.function: startup_module_7::function_386/0
+    frame 0
+    call 0 startup_module_7::function_385/0
+    return
+.end
+
+.function: startup_module_7::function_387/0
+    frame 0
+    call 0 startup_module_7::function_386/0
+    return
+.end
+
+.function: startup_module_7::function_388/0
+    frame 0
+    call 0 startup_module_7::function_387/0
+    return
+.end
+
+.function: startup_module_7::function_389/0
+    frame 0
+    call 0 startup_module_7::function_388/0
+    return
+.end
+
+.function: startup_module_7::function_390/0
+    frame 0
+    call 0 startup_module_7::function_389/0
+    return
+.end
+
+.function: startup_module_7::function_391/0
+    frame 0
+    call 0 startup_module_7::function_390/0
+    return
+.end
+
+.function: startup_module_7::function_392/0
+    frame 0
+    call 0 startup_module_7::function_391/0
+    return
+.end
+
+.function: startup_module_7::function_393/0
+    frame 0
+    call 0 startup_module_7::function_392/0
+    return
+.end
+
+.function: startup_module_7::function_394/0
+    frame 0
+    call 0 startup_module_7::function_393/0
+    return
+.end
+
+.function: startup_module_7::function_395/0
+    frame 0
+    call 0 startup_module_7::function_394/0
+    return
+.end
+
+.function: startup_module_7::function_396/0
+    frame 0
+    call 0 startup_module_7::function_395/0
+    return
+.end
+
+.function: startup_module_7::function_397/0
+    frame 0
+    call 0 startup_module_7::function_396/0
+    return
+.end
+
+.function: startup_module_7::function_398/0
+    frame 0
+    call 0 startup_module_7::function_397/0
+    return
+.end
+
+.function: startup_module_7::function_399/0
+    frame 0
+    call 0 startup_module_7::function_398/0
+    return
+.end
+
+.function: startup_module_7::function_400/0
+    frame 0
+    call 0 startup_module_7::function_399/0
+    return
+.end
+
+.function: startup_module_7::function_401/0
+    frame 0
+    call 0 startup_module_7::function_400/0
+    return
+.end
+
+.function: startup_module_7::function_402/0
+    frame 0
+    call 0 startup_module_7::function_401/0
+    return
+.end
+
+.function: startup_module_7::function_403/0
+    frame 0
+    call 0 startup_module_7::function_402/0
+    return
+.end
+
+.function: startup_module_7::function_404/0
+    frame 0
+    call 0 startup_module_7::function_403/0
+    return
+.end
+
+.function: startup_module_7::function_405/0
+    frame 0
+    call 0 startup_module_7::function_404/0
+    return
+.end
+
+.function: startup_module_7::function_406/0
+    frame 0
+    call 0 startup_module_7::function_405/0
+    return
+.end
+
+.function: startup_module_7::function_407/0
+    frame 0
+    call 0 startup_module_7::function_406/0
+    return
+.end
+
+.function: startup_module_7::function_408/0
+    frame 0
+    call 0 startup_module_7::function_407/0
+    return
+.end
+
+.function: startup_module_7::function_409/0
+    frame 0
+    call 0 startup_module_7::function_408/0
+    return
+.end
+
+.function: startup_module_7::function_410/0
+    frame 0
+    call 0 startup_module_7::function_409/0
+    return
+.end
+
+.function: startup_module_7::function_411/0
+    frame 0
+    call 0 startup_module_7::function_410/0
+    return
+.end
+
+.function: startup_module_7::function_412/0
+    frame 0
+    call 0 startup_module_7::function_411/0
+    return
+.end
+
+.function: startup_module_7::function_413/0
+    frame 0
+    call 0 startup_module_7::function_412/0
+    return
+.end
+
+.function: startup_module_7::function_414/0
+    frame 0
+    call 0 startup_module_7::function_413/0
+    return
+.end
+
+.function: startup_module_7::function_415/0
+    frame 0
+    call 0 startup_module_7::function_414/0
+    return
+.end
+
+.function: startup_module_7::function_416/0
+    frame 0
+    call 0 startup_module_7::function_415/0
+    return
+.end
+
+.function: startup_module_7::function_417/0
+    frame 0
+    call 0 startup_module_7::function_416/0
+    return
+.end
+
+.function: startup_module_7::function_418/0
+    frame 0
+    call 0 startup_module_7::function_417/0
+    return
+.end
+
+.function: startup_module_7::function_419/0
+    frame 0
+    call 0 startup_module_7::function_418/0
+    return
+.end
+
+.function: startup_module_7::function_420/0
+    frame 0
+    call 0 startup_module_7::function_419/0
+    return
+.end
+
+.function: startup_module_7::function_421/0
+    frame 0
+    call 0 startup_module_7::function_420/0
+    return
+.end
+
+.function: startup_module_7::function_422/0
+    frame 0
+    call 0 startup_module_7::function_421/0
+    return
+.end
+
+.function: startup_module_7::function_423/0
+    frame 0
+    call 0 startup_module_7::function_422/0
+    return
+.end
+
+.function: startup_module_7::function_424/0
+    frame 0
+    call 0 startup_module_7::function_423/0
+    return
+.end
+
+.function: startup_module_7::function_425/0
+    frame 0
+    call 0 startup_module_7::function_424/0
+    return
+.end
+
+.function: startup_module_7::function_426/0
+    frame 0
+    call 0 startup_module_7::function_425/0
+    return
+.end
+
+.function: startup_module_7::function_427/0
+    frame 0
+    call 0 startup_module_7::function_426/0
+    return
+.end
+
+.function: startup_module_7::function_428/0
+    frame 0
+    call 0 startup_module_7::function_427/0
+    return
+.end
+
+.function: startup_module_7::function_429/0
+    frame 0
+    call 0 startup_module_7::function_428/0
+    return
+.end
+
+.function: startup_module_7::function_430/0
+    frame 0
+    call 0 startup_module_7::function_429/0
+    return
+.end
+
+.function: startup_module_7::function_431/0
+    frame 0
+    call 0 startup_module_7::function_430/0
+    return
+.end
+
+.function: startup_module_7::function_432/0
+    frame 0
+    call 0 startup_module_7::function_431/0
+    return
+.end
+
+.function: startup_module_7::function_433/0
+    frame 0
+    call 0 startup_module_7::function_432/0
+    return
+.end
+
+.function: startup_module_7::function_434/0
+    frame 0
+    call 0 startup_module_7::function_433/0
+    return
+.end
+
+.function: startup_module_7::function_435/0
+    frame 0
+    call 0 startup_module_7::function_434/0
+    return
+.end
+
+.function: startup_module_7::function_436/0
+    frame 0
+    call 0 startup_module_7::function_435/0
+    return
+.end
+
+.function: startup_module_7::function_437/0
+    frame 0
+    call 0 startup_module_7::function_436/0
+    return
+.end
+
+.function: startup_module_7::function_438/0
+    frame 0
+    call 0 startup_module_7::function_437/0
+    return
+.end
+
+.function: startup_module_7::function_439/0
+    frame 0
+    call 0 startup_module_7::function_438/0
+    return
+.end
+
+.function: startup_module_7::function_440/0
+    frame 0
+    call 0 startup_module_7::function_439/0
+    return
+.end
+
+.function: startup_module_7::function_441/0
+    frame 0
+    call 0 startup_module_7::function_440/0
+    return
+.end
+
+.function: startup_module_7::function_442/0
+    frame 0
+    call 0 startup_module_7::function_441/0
+    return
+.end
+
+.function: startup_module_7::function_443/0
+    frame 0
+    call 0 startup_module_7::function_442/0
+    return
+.end
+
+.function: startup_module_7::function_444/0
+    frame 0
+    call 0 startup_module_7::function_443/0
+    return
+.end
+
+.function: startup_module_7::function_445/0
+    frame 0
+    call 0 startup_module_7::function_444/0
+    return
+.end
+
+.function: startup_module_7::function_446/0
+    frame 0
+    call 0 startup_module_7::function_445/0
+    return
+.end
+
+.function: startup_module_7::function_447/0
+    frame 0
+    call 0 startup_module_7::function_446/0
+    return
+.end
+
+.function: startup_module_7::function_448/0
+    frame 0
+    call 0 startup_module_7::function_447/0
+    return
+.end
+
+.function: startup_module_7::function_449/0
+    frame 0
+    call 0 startup_module_7::function_448/0
+    return
+.end
+
+.function: startup_module_7::function_450/0
+    frame 0
+    call 0 startup_module_7::function_449/0
+    return
+.end
+
+.function: startup_module_7::function_451/0
+    frame 0
+    call 0 startup_module_7::function_450/0
+    return
+.end
+
+.function: startup_module_7::function_452/0
+    frame 0
+    call 0 startup_module_7::function_451/0
+    return
+.end
+
+.function: startup_module_7::function_453/0
+    frame 0
+    call 0 startup_module_7::function_452/0
+    return
+.end
+
+.function: startup_module_7::function_454/0
+    frame 0
+    call 0 startup_module_7::function_453/0
+    return
+.end
+
+.function: startup_module_7::function_455/0
+    frame 0
+    call 0 startup_module_7::function_454/0
+    return
+.end
+
+.function: startup_module_7::function_456/0
+    frame 0
+    call 0 startup_module_7::function_455/0
+    return
+.end
+
+.function: startup_module_7::function_457/0
+    frame 0
+    call 0 startup_module_7::function_456/0
+    return
+.end
+
+.function: startup_module_7::function_458/0
+    frame 0
+    call 0 startup_module_7::function_457/0
+    return
+.end
+
+.function: startup_module_7::function_459/0
+    frame 0
+    call 0 startup_module_7::function_458/0
+    return
+.end
+
+.function: startup_module_7::function_460/0
+    frame 0
+    call 0 startup_module_7::function_459/0
+    return
+.end
+
+.function: startup_module_7::function_461/0
+    frame 0
+    call 0 startup_module_7::function_460/0
+    return
+.end
+
+.function: startup_module_7::function_462/0
+    frame 0
+    call 0 startup_module_7::function_461/0
+    return
+.end
+
+.function: startup_module_7::function_463/0
+    frame 0
+    call 0 startup_module_7::function_462/0
+    return
+.end
+
+.function: startup_module_7::function_464/0
+    frame 0
+    call 0 startup_module_7::function_463/0
+    return
+.end
+
+.function: startup_module_7::function_465/0
+    frame 0
+    call 0 startup_module_7::function_464/0
+    return
+.end
+
+.function: startup_module_7::function_466/0
+    frame 0
+    call 0 startup_module_7::function_465/0
+    return
+.end
+
+.function: startup_module_7::function_467/0
+    frame 0
+    call 0 startup_module_7::function_466/0
+    return
+.end
+
+.function: startup_module_7::function_468/0
+    frame 0
+    call 0 startup_module_7::function_467/0
+    return
+.end
+
+.function: startup_module_7::function_469/0
+    frame 0
+    call 0 startup_module_7::function_468/0
+    return
+.end
+
+.function: startup_module_7::function_470/0
+    frame 0
+    call 0 startup_module_7::function_469/0
+    return
+.end
+
+.function: startup_module_7::function_471/0
+    frame 0
+    call 0 startup_module_7::function_470/0
+    return
+.end
+
+.function: startup_module_7::function_472/0
+    frame 0
+    call 0 startup_module_7::function_471/0
+    return
+.end
+
+.function: startup_module_7::function_473/0
+    frame 0
+    call 0 startup_module_7::function_472/0
+    return
+.end
+
+.function: startup_module_7::function_474/0
+    frame 0
+    call 0 startup_module_7::function_473/0
+    return
+.end
+
+.function: startup_module_7::function_475/0
+    frame 0
+    call 0 startup_module_7::function_474/0
+    return
+.end
+
+.function: startup_module_7::function_476/0
+    frame 0
+    call 0 startup_module_7::function_475/0
+    return
+.end
+
+.function: startup_module_7::function_477/0
+    frame 0
+    call 0 startup_module_7::function_476/0
+    return
+.end
+
+.function: startup_module_7::function_478/0
+    frame 0
+    call 0 startup_module_7::function_477/0
+    return
+.end
+
+.function: startup_module_7::function_479/0
+    frame 0
+    call 0 startup_module_7::function_478/0
+    return
+.end
+
+.function: startup_module_7::function_480/0
+    frame 0
+    call 0 startup_module_7::function_479/0
+    return
+.end
+
+.function: startup_module_7::function_481/0
+    frame 0
+    call 0 startup_module_7::function_480/0
+    return
+.end
+
+.function: startup_module_7::function_482/0
+    frame 0
+    call 0 startup_module_7::function_481/0
+    return
+.end
+
+.function: startup_module_7::function_483/0
+    frame 0
+    call 0 startup_module_7::function_482/0
+    return
+.end
+
+.function: startup_module_7::function_484/0
+    frame 0
+    call 0 startup_module_7::function_483/0
+    return
+.end
+
+.function: startup_module_7::function_485/0
+    frame 0
+    call 0 startup_module_7::function_484/0
+    return
+.end
+
+.function: startup_module_7::function_486/0
+    frame 0
+    call 0 startup_module_7::function_485/0
+    return
+.end
+
+.function: startup_module_7::function_487/0
+    frame 0
+    call 0 startup_module_7::function_486/0
+    return
+.end
+
+.function: startup_module_7::function_488/0
+    frame 0
+    call 0 startup_module_7::function_487/0
+    return
+.end
+
+.function: startup_module_7::function_489/0
+    frame 0
+    call 0 startup_module_7::function_488/0
+    return
+.end
+
+.function: startup_module_7::function_490/0
+    frame 0
+    call 0 startup_module_7::function_489/0
+    return
+.end
+
+.function: startup_module_7::function_491/0
+    frame 0
+    call 0 startup_module_7::function_490/0
+    return
+.end
+
+.function: startup_module_7::function_492/0
+    frame 0
+    call 0 startup_module_7::function_491/0
+    return
+.end
+
+.function: startup_module_7::function_493/0
+    frame 0
+    call 0 startup_module_7::function_492/0
+    return
+.end
+
+.function: startup_module_7::function_494/0
+    frame 0
+    call 0 startup_module_7::function_493/0
+    return
+.end
+
+.function: startup_module_7::function_495/0
+    frame 0
+    call 0 startup_module_7::function_494/0
+    return
+.end
+
+.function: startup_module_7::function_496/0
+    frame 0
+    call 0 startup_module_7::function_495/0
+    return
+.end
+
+.function: startup_module_7::function_497/0
+    frame 0
+    call 0 startup_module_7::function_496/0
+    return
+.end
+
+.function: startup_module_7::function_498/0
+    frame 0
+    call 0 startup_module_7::function_497/0
+    return
+.end
+
+.function: startup_module_7::function_499/0
+    frame 0
+    call 0 startup_module_7::function_498/0
+    return
+.end
+
+.function: startup_module_7::function_500/0
+    frame 0
+    call 0 startup_module_7::function_499/0
+    return
+.end
+
+.function: startup_module_7::function_501/0
+    frame 0
+    call 0 startup_module_7::function_500/0
+    return
+.end
+
+.function: startup_module_7::function_502/0
+    frame 0
+    call 0 startup_module_7::function_501/0
+    return
+.end
+
+.function: startup_module_7::function_503/0
+    frame 0
+    call 0 startup_module_7::function_502/0
+    return
+.end
+
+.function: startup_module_7::function_504/0
+    frame 0
+    call 0 startup_module_7::function_503/0
+    return
+.end
+
+.function: startup_module_7::function_505/0
+    frame 0
+    call 0 startup_module_7::function_504/0
+    return
+.end
+
+.function: startup_module_7::function_506/0
+    frame 0
+    call 0 startup_module_7::function_505/0
+    return
+.end
+
+.function: startup_module_7::function_507/0
+    frame 0
+    call 0 startup_module_7::function_506/0
+    return
+.end
+
+.function: startup_module_7::function_508/0
+    frame 0
+    call 0 startup_module_7::function_507/0
+    return
+.end
+
+.function: startup_module_7::function_509/0
+    frame 0
+    call 0 startup_module_7::function_508/0
+    return
+.end
+
+.function: startup_module_7::function_510/0
+    frame 0
+    call 0 startup_module_7::function_509/0
+    return
+.end
+
+.function: startup_module_7::function_511/0
+    frame 0
+    call 0 startup_module_7::function_510/0
+    return
+.end
+
+.function: startup_module_7::function_512/0
+    frame 0
+    call 0 startup_module_7::function_511/0
+    return
+.end
+
+.function: startup_module_7::function_513/0
+    frame 0
+    call 0 startup_module_7::function_512/0
+    return
+.end
+
+.function: startup_module_7::function_514/0
+    frame 0
+    call 0 startup_module_7::function_513/0
+    return
+.end
+
+.function: startup_module_7::function_515/0
+    frame 0
+    call 0 startup_module_7::function_514/0
+    return
+.end
+
+.function: startup_module_7::function_516/0
+    frame 0
+    call 0 startup_module_7::function_515/0
+    return
+.end
+
+.function: startup_module_7::function_517/0
+    frame 0
+    call 0 startup_module_7::function_516/0
+    return
+.end
+
+.function: startup_module_7::function_518/0
+    frame 0
+    call 0 startup_module_7::function_517/0
+    return
+.end
+
+.function: startup_module_7::function_519/0
+    frame 0
+    call 0 startup_module_7::function_518/0
+    return
+.end
+
+.function: startup_module_7::function_520/0
+    frame 0
+    call 0 startup_module_7::function_519/0
+    return
+.end
+
+.function: startup_module_7::function_521/0
+    frame 0
+    call 0 startup_module_7::function_520/0
+    return
+.end
+
+.function: startup_module_7::function_522/0
+    frame 0
+    call 0 startup_module_7::function_521/0
+    return
+.end
+
+.function: startup_module_7::function_523/0
+    frame 0
+    call 0 startup_module_7::function_522/0
+    return
+.end
+
+.function: startup_module_7::function_524/0
+    frame 0
+    call 0 startup_module_7::function_523/0
+    return
+.end
+
+.function: startup_module_7::function_525/0
+    frame 0
+    call 0 startup_module_7::function_524/0
+    return
+.end
+
+.function: startup_module_7::function_526/0
+    frame 0
+    call 0 startup_module_7::function_525/0
+    return
+.end
+
+.function: startup_module_7::function_527/0
+    frame 0
+    call 0 startup_module_7::function_526/0
+    return
+.end
+
+.function: startup_module_7::function_528/0
+    frame 0
+    call 0 startup_module_7::function_527/0
+    return
+.end
+
+.function: startup_module_7::function_529/0
+    frame 0
+    call 0 startup_module_7::function_528/0
+    return
+.end
+
+.function: startup_module_7::function_530/0
+    frame 0
+    call 0 startup_module_7::function_529/0
+    return
+.end
+
+.function: startup_module_7::function_531/0
+    frame 0
+    call 0 startup_module_7::function_530/0
+    return
+.end
+
+.function: startup_module_7::function_532/0
+    frame 0
+    call 0 startup_module_7::function_531/0
+    return
+.end
+
+.function: startup_module_7::function_533/0
+    frame 0
+    call 0 startup_module_7::function_532/0
+    return
+.end
+
+.function: startup_module_7::function_534/0
+    frame 0
+    call 0 startup_module_7::function_533/0
+    return
+.end
+
+.function: startup_module_7::function_535/0
+    frame 0
+    call 0 startup_module_7::function_534/0
+    return
+.end
+
+.function: startup_module_7::function_536/0
+    frame 0
+    call 0 startup_module_7::function_535/0
+    return
+.end
+
+.function: startup_module_7::function_537/0
+    frame 0
+    call 0 startup_module_7::function_536/0
+    return
+.end
+
+.function: startup_module_7::function_538/0
+    frame 0
+    call 0 startup_module_7::function_537/0
+    return
+.end
+
+.function: startup_module_7::function_539/0
+    frame 0
+    call 0 startup_module_7::function_538/0
+    return
+.end
+
+.function: startup_module_7::function_540/0
+    frame 0
+    call 0 startup_module_7::function_539/0
+    return
+.end
+
+.function: startup_module_7::function_541/0
+    frame 0
+    call 0 startup_module_7::function_540/0
+    return
+.end
+
+.function: startup_module_7::function_542/0
+    frame 0
+    call 0 startup_module_7::function_541/0
+    return
+.end
+
+.function: startup_module_7::function_543/0
+    frame 0
+    call 0 startup_module_7::function_542/0
+    return
+.end
+
+.function: startup_module_7::function_544/0
+    frame 0
+    call 0 startup_module_7::function_543/0
+    return
+.end
+
+.function: startup_module_7::function_545/0
+    frame 0
+    call 0 startup_module_7::function_544/0
+    return
+.end
+
+.function: startup_module_7::function_546/0
+    frame 0
+    call 0 startup_module_7::function_545/0
+    return
+.end
+
+.function: startup_module_7::function_547/0
+    frame 0
+    call 0 startup_module_7::function_546/0
+    return
+.end
+
+.function: startup_module_7::function_548/0
+    frame 0
+    call 0 startup_module_7::function_547/0
+    return
+.end
+
+.function: startup_module_7::function_549/0
+    frame 0
+    call 0 startup_module_7::function_548/0
+    return
+.end
+
+.function: startup_module_7::function_550/0
+    frame 0
+    call 0 startup_module_7::function_549/0
+    return
+.end
+
+.function: startup_module_7::function_551/0
+    frame 0
+    call 0 startup_module_7::function_550/0
+    return
+.end
+
+.function: startup_module_7::function_552/0
+    frame 0
+    call 0 startup_module_7::function_551/0
+    return
+.end
+
+.function: startup_module_7::function_553/0
+    frame 0
+    call 0 startup_module_7::function_552/0
+    return
+.end
+
+.function: startup_module_7::function_554/0
+    frame 0
+    call 0 startup_module_7::function_553/0
+    return
+.end
+
+.function: startup_module_7::function_555/0
+    frame 0
+    call 0 startup_module_7::function_554/0
+    return
+.end
+
+.function: startup_module_7::function_556/0
+    frame 0
+    call 0 startup_module_7::function_555/0
+    return
+.end
+
+.function: startup_module_7::function_557/0
+    frame 0
+    call 0 startup_module_7::function_556/0
+    return
+.end
+
+.function: startup_module_7::function_558/0
+    frame 0
+    call 0 startup_module_7::function_557/0
+    return
+.end
+
+.function: startup_module_7::function_559/0
+    frame 0
+    call 0 startup_module_7::function_558/0
+    return
+.end
+
+.function: startup_module_7::function_560/0
+    frame 0
+    call 0 startup_module_7::function_559/0
+    return
+.end
+
+.function: startup_module_7::function_561/0
+    frame 0
+    call 0 startup_module_7::function_560/0
+    return
+.end
+
+.function: startup_module_7::function_562/0
+    frame 0
+    call 0 startup_module_7::function_561/0
+    return
+.end
+
+.function: startup_module_7::function_563/0
+    frame 0
+    call 0 startup_module_7::function_562/0
+    return
+.end
+
+.function: startup_module_7::function_564/0
+    frame 0
+    call 0 startup_module_7::function_563/0
+    return
+.end
+
+.function: startup_module_7::function_565/0
+    frame 0
+    call 0 startup_module_7::function_564/0
+    return
+.end
+
+.function: startup_module_7::function_566/0
+    frame 0
+    call 0 startup_module_7::function_565/0
+    return
+.end
+
+.function: startup_module_7::function_567/0
+    frame 0
+    call 0 startup_module_7::function_566/0
+    return
+.end
+
+.function: startup_module_7::function_568/0
+    frame 0
+    call 0 startup_module_7::function_567/0
+    return
+.end
+
+.function: startup_module_7::function_569/0
+    frame 0
+    call 0 startup_module_7::function_568/0
+    return
+.end
+
+.function: startup_module_7::function_570/0
+    frame 0
+    call 0 startup_module_7::function_569/0
+    return
+.end
+
+.function: startup_module_7::function_571/0
+    frame 0
+    call 0 startup_module_7::function_570/0
+    return
+.end
+
+.function: startup_module_7::function_572/0
+    frame 0
+    call 0 startup_module_7::function_571/0
+    return
+.end
+
+.function: startup_module_7::function_573/0
+    frame 0
+    call 0 startup_module_7::function_572/0
+    return
+.end
+
+.function: startup_module_7::function_574/0
+    frame 0
+    call 0 startup_module_7::function_573/0
+    return
+.end
+
+.function: startup_module_7::function_575/0
+    frame 0
+    call 0 startup_module_7::function_574/0
+    return
+.end
+
+.function: startup_module_7::function_576/0
+    frame 0
+    call 0 startup_module_7::function_575/0
+    return
+.end
+
+.function: startup_module_7::function_577/0
+    frame 0
+    call 0 startup_module_7::function_576/0
+    return
+.end
+
+.function: startup_module_7::function_578/0
+    frame 0
+    call 0 startup_module_7::function_577/0
+    return
+.end
+
+.function: startup_module_7::function_579/0
+    frame 0
+    call 0 startup_module_7::function_578/0
+    return
+.end
+
+.function: startup_module_7::function_580/0
+    frame 0
+    call 0 startup_module_7::function_579/0
+    return
+.end
+
+.function: startup_module_7::function_581/0
+    frame 0
+    call 0 startup_module_7::function_580/0
+    return
+.end
+
+.function: startup_module_7::function_582/0
+    frame 0
+    call 0 startup_module_7::function_581/0
+    return
+.end
+
+.function: startup_module_7::function_583/0
+    frame 0
+    call 0 startup_module_7::function_582/0
+    return
+.end
+
+.function: startup_module_7::function_584/0
+    frame 0
+    call 0 startup_module_7::function_583/0
+    return
+.end
+
+.function: startup_module_7::function_585/0
+    frame 0
+    call 0 startup_module_7::function_584/0
+    return
+.end
+
+.function: startup_module_7::function_586/0
+    frame 0
+    call 0 startup_module_7::function_585/0
+    return
+.end
+
+.function: startup_module_7::function_587/0
+    frame 0
+    call 0 startup_module_7::function_586/0
+    return
+.end
+
+.function: startup_module_7::function_588/0
+    frame 0
+    call 0 startup_module_7::function_587/0
+    return
+.end
+
+.function: startup_module_7::function_589/0
+    frame 0
+    call 0 startup_module_7::function_588/0
+    return
+.end
+
+.function: startup_module_7::function_590/0
+    frame 0
+    call 0 startup_module_7::function_589/0
+    return
+.end
+
+.function: startup_module_7::function_591/0
+    frame 0
+    call 0 startup_module_7::function_590/0
+    return
+.end
+
+.function: startup_module_7::function_592/0
+    frame 0
+    call 0 startup_module_7::function_591/0
+    return
+.end
+
+.function: startup_module_7::function_593/0
+    frame 0
+    call 0 startup_module_7::function_592/0
+    return
+.end
+
+.function: startup_module_7::function_594/0
+    frame 0
+    call 0 startup_module_7::function_593/0
+    return
+.end
+
+.function: startup_module_7::function_595/0
+    frame 0
+    call 0 startup_module_7::function_594/0
+    return
+.end
+
+.function: startup_module_7::function_596/0
+    frame 0
+    call 0 startup_module_7::function_595/0
+    return
+.end
+
+.function: startup_module_7::function_597/0
+    frame 0
+    call 0 startup_module_7::function_596/0
+    return
+.end
+
+.function: startup_module_7::function_598/0
+    frame 0
+    call 0 startup_module_7::function_597/0
+    return
+.end
+
+.function: startup_module_7::function_599/0
+    frame 0
+    call 0 startup_module_7::function_598/0
+    return
+.end
+
+.function: startup_module_7::function_600/0
+    frame 0
+    call 0 startup_module_7::function_599/0
+    return
+.end
+
+.function: startup_module_7::function_601/0
+    frame 0
+    call 0 startup_module_7::function_600/0
+    return
+.end
+
+.function: startup_module_7::function_602/0
+    frame 0
+    call 0 startup_module_7::function_601/0
+    return
+.end
+
+.function: startup_module_7::function_603/0
+    frame 0
+    call 0 startup_module_7::function_602/0
+    return
+.end
+
+.function: startup_module_7::function_604/0
+    frame 0
+    call 0 startup_module_7::function_603/0
+    return
+.end
+
+.function: startup_module_7::function_605/0
+    frame 0
+    call 0 startup_module_7::function_604/0
+    return
+.end
+
+.function: startup_module_7::function_606/0
+    frame 0
+    call 0 startup_module_7::function_605/0
+    return
+.end
+
+.function: startup_module_7::function_607/0
+    frame 0
+    call 0 startup_module_7::function_606/0
+    return
+.end
+
+.function: startup_module_7::function_608/0
+    frame 0
+    call 0 startup_module_7::function_607/0
+    return
+.end
+
+.function: startup_module_7::function_609/0
+    frame 0
+    call 0 startup_module_7::function_608/0
+    return
+.end
+
+.function: startup_module_7::function_610/0
+    frame 0
+    call 0 startup_module_7::function_609/0
+    return
+.end
+
+.function: startup_module_7::function_611/0
+    frame 0
+    call 0 startup_module_7::function_610/0
+    return
+.end
+
+.function: startup_module_7::function_612/0
+    frame 0
+    call 0 startup_module_7::function_611/0
+    return
+.end
+
+.function: startup_module_7::function_613/0
+    frame 0
+    call 0 startup_module_7::function_612/0
+    return
+.end
+
+.function: startup_module_7::function_614/0
+    frame 0
+    call 0 startup_module_7::function_613/0
+    return
+.end
+
+.function: startup_module_7::function_615/0
+    frame 0
+    call 0 startup_module_7::function_614/0
+    return
+.end
+
+.function: startup_module_7::function_616/0
+    frame 0
+    call 0 startup_module_7::function_615/0
+    return
+.end
+
+.function: startup_module_7::function_617/0
+    frame 0
+    call 0 startup_module_7::function_616/0
+    return
+.end
+
+.function: startup_module_7::function_618/0
+    frame 0
+    call 0 startup_module_7::function_617/0
+    return
+.end
+
+.function: startup_module_7::function_619/0
+    frame 0
+    call 0 startup_module_7::function_618/0
+    return
+.end
+
+.function: startup_module_7::function_620/0
+    frame 0
+    call 0 startup_module_7::function_619/0
+    return
+.end
+
+.function: startup_module_7::function_621/0
+    frame 0
+    call 0 startup_module_7::function_620/0
+    return
+.end
+
+.function: startup_module_7::function_622/0
+    frame 0
+    call 0 startup_module_7::function_621/0
+    return
+.end
+
+.function: startup_module_7::function_623/0
+    frame 0
+    call 0 startup_module_7::function_622/0
+    return
+.end
+
+.function: startup_module_7::function_624/0
+    frame 0
+    call 0 startup_module_7::function_623/0
+    return
+.end
+
+.function: startup_module_7::function_625/0
+    frame 0
+    call 0 startup_module_7::function_624/0
+    return
+.end
+
+.function: startup_module_7::function_626/0
+    frame 0
+    call 0 startup_module_7::function_625/0
+    return
+.end
+
+.function: startup_module_7::function_627/0
+    frame 0
+    call 0 startup_module_7::function_626/0
+    return
+.end
+
+.function: startup_module_7::function_628/0
+    frame 0
+    call 0 startup_module_7::function_627/0
+    return
+.end
+
+.function: startup_module_7::function_629/0
+    frame 0
+    call 0 startup_module_7::function_628/0
+    return
+.end
+
+.function: startup_module_7::function_630/0
+    frame 0
+    call 0 startup_module_7::function_629/0
+    return
+.end
+
+.function: startup_module_7::function_631/0
+    frame 0
+    call 0 startup_module_7::function_630/0
+    return
+.end
+
+.function: startup_module_7::function_632/0
+    frame 0
+    call 0 startup_module_7::function_631/0
+    return
+.end
+
+.function: startup_module_7::function_633/0
+    frame 0
+    call 0 startup_module_7::function_632/0
+    return
+.end
+
+.function: startup_module_7::function_634/0
+    frame 0
+    call 0 startup_module_7::function_633/0
+    return
+.end
+
+.function: startup_module_7::function_635/0
+    frame 0
+    call 0 startup_module_7::function_634/0
+    return
+.end
+
+.function: startup_module_7::function_636/0
+    frame 0
+    call 0 startup_module_7::function_635/0
+    return
+.end
+
+.function: startup_module_7::function_637/0
+    frame 0
+    call 0 startup_module_7::function_636/0
+    return
+.end
+
+.function: startup_module_7::function_638/0
+    frame 0
+    call 0 startup_module_7::function_637/0
+    return
+.end
+
+.function: startup_module_7::function_639/0
+    frame 0
+    call 0 startup_module_7::function_638/0
+    return
+.end
+
+.function: startup_module_7::function_640/0
+    frame 0
+    call 0 startup_module_7::function_639/0
+    return
+.end
+
+.function: startup_module_7::function_641/0
+    frame 0
+    call 0 startup_module_7::function_640/0
+    return
+.end
+
+.function: startup_module_7::function_642/0
+    frame 0
+    call 0 startup_module_7::function_641/0
+    return
+.end
+
+.function: startup_module_7::function_643/0
+    frame 0
+    call 0 startup_module_7::function_642/0
+    return
+.end
+
+.function: startup_module_7::function_644/0
+    frame 0
+    call 0 startup_module_7::function_643/0
+    return
+.end
+
+.function: startup_module_7::function_645/0
+    frame 0
+    call 0 startup_module_7::function_644/0
+    return
+.end
+
+.function: startup_module_7::function_646/0
+    frame 0
+    call 0 startup_module_7::function_645/0
+    return
+.end
+
+.function: startup_module_7::function_647/0
+    frame 0
+    call 0 startup_module_7::function_646/0
+    return
+.end
+
+.function: startup_module_7::function_648/0
+    frame 0
+    call 0 startup_module_7::function_647/0
+    return
+.end
+
+.function: startup_module_7::function_649/0
+    frame 0
+    call 0 startup_module_7::function_648/0
+    return
+.end
+
+.function: startup_module_7::function_650/0
+    frame 0
+    call 0 startup_module_7::function_649/0
+    return
+.end
+
+.function: startup_module_7::function_651/0
+    frame 0
+    call 0 startup_module_7::function_650/0
+    return
+.end
+
+.function: startup_module_7::function_652/0
+    frame 0
+    call 0 startup_module_7::function_651/0
+    return
+.end
+
+.function: startup_module_7::function_653/0
+    frame 0
+    call 0 startup_module_7::function_652/0
+    return
+.end
+
+.function: startup_module_7::function_654/0
+    frame 0
+    call 0 startup_module_7::function_653/0
+    return
+.end
+
+.function: startup_module_7::function_655/0
+    frame 0
+    call 0 startup_module_7::function_654/0
+    return
+.end
+
+.function: startup_module_7::function_656/0
+    frame 0
+    call 0 startup_module_7::function_655/0
+    return
+.end
+
+.function: startup_module_7::function_657/0
+    frame 0
+    call 0 startup_module_7::function_656/0
+    return
+.end
+
+.function: startup_module_7::function_658/0
+    frame 0
+    call 0 startup_module_7::function_657/0
+    return
+.end
+
+.function: startup_module_7::function_659/0
+    frame 0
+    call 0 startup_module_7::function_658/0
+    return
+.end
+
+.function: startup_module_7::function_660/0
+    frame 0
+    call 0 startup_module_7::function_659/0
+    return
+.end
+
+.function: startup_module_7::function_661/0
+    frame 0
+    call 0 startup_module_7::function_660/0
+    return
+.end
+
+.function: startup_module_7::function_662/0
+    frame 0
+    call 0 startup_module_7::function_661/0
+    return
+.end
+
+.function: startup_module_7::function_663/0
+    frame 0
+    call 0 startup_module_7::function_662/0
+    return
+.end
+
+.function: startup_module_7::function_664/0
+    frame 0
+    call 0 startup_module_7::function_663/0
+    return
+.end
+
+.function: startup_module_7::function_665/0
+    frame 0
+    call 0 startup_module_7::function_664/0
+    return
+.end
+
+.function: startup_module_7::function_666/0
+    frame 0
+    call 0 startup_module_7::function_665/0
+    return
+.end
+
+.function: startup_module_7::function_667/0
+    frame 0
+    call 0 startup_module_7::function_666/0
+    return
+.end
+
+.function: startup_module_7::function_668/0
+    frame 0
+    call 0 startup_module_7::function_667/0
+    return
+.end
+
+.function: startup_module_7::function_669/0
+    frame 0
+    call 0 startup_module_7::function_668/0
+    return
+.end
+
+.function: startup_module_7::function_670/0
+    frame 0
+    call 0 startup_module_7::function_669/0
+    return
+.end
+
+.function: startup_module_7::function_671/0
+    frame 0
+    call 0 startup_module_7::function_670/0
+    return
+.end
+
+.function: startup_module_7::function_672/0
+    frame 0
+    call 0 startup_module_7::function_671/0
+    return
+.end
+
+.function: startup_module_7::function_673/0
+    frame 0
+    call 0 startup_module_7::function_672/0
+    return
+.end
+
+.function: startup_module_7::function_674/0
+    frame 0
+    call 0 startup_module_7::function_673/0
+    return
+.end
+
+.function: startup_module_7::function_675/0
+    frame 0
+    call 0 startup_module_7::function_674/0
+    return
+.end
+
+.function: startup_module_7::function_676/0
+    frame 0
+    call 0 startup_module_7::function_675/0
+    return
+.end
+
+.function: startup_module_7::function_677/0
+    frame 0
+    call 0 startup_module_7::function_676/0
+    return
+.end
+
+.function: startup_module_7::function_678/0
+    frame 0
+    call 0 startup_module_7::function_677/0
+    return
+.end
+
+.function: startup_module_7::function_679/0
+    frame 0
+    call 0 startup_module_7::function_678/0
+    return
+.end
+
+.function: startup_module_7::function_680/0
+    frame 0
+    call 0 startup_module_7::function_679/0
+    return
+.end
+
+.function: startup_module_7::function_681/0
+    frame 0
+    call 0 startup_module_7::function_680/0
+    return
+.end
+
+.function: startup_module_7::function_682/0
+    frame 0
+    call 0 startup_module_7::function_681/0
+    return
+.end
+
+.function: startup_module_7::function_683/0
+    frame 0
+    call 0 startup_module_7::function_682/0
+    return
+.end
+
+.function: startup_module_7::function_684/0
+    frame 0
+    call 0 startup_module_7::function_683/0
+    return
+.end
+
+.function: startup_module_7::function_685/0
+    frame 0
+    call 0 startup_module_7::function_684/0
+    return
+.end
+
+.function: startup_module_7::function_686/0
+    frame 0
+    call 0 startup_module_7::function_685/0
+    return
+.end
+
+.function: startup_module_7::function_687/0
+    frame 0
+    call 0 startup_module_7::function_686/0
+    return
+.end
+
+.function: startup_module_7::function_688/0
+    frame 0
+    call 0 startup_module_7::function_687/0
+    return
+.end
+
+.function: startup_module_7::function_689/0
+    frame 0
+    call 0 startup_module_7::function_688/0
+    return
+.end
+
+.function: startup_module_7::function_690/0
+    frame 0
+    call 0 startup_module_7::function_689/0
+    return
+.end
+
+.function: startup_module_7::function_691/0
+    frame 0
+    call 0 startup_module_7::function_690/0
+    return
+.end
+
+.function: startup_module_7::function_692/0
+    frame 0
+    call 0 startup_module_7::function_691/0
+    return
+.end
+
+.function: startup_module_7::function_693/0
+    frame 0
+    call 0 startup_module_7::function_692/0
+    return
+.end
+
+.function: startup_module_7::function_694/0
+    frame 0
+    call 0 startup_module_7::function_693/0
+    return
+.end
+
+.function: startup_module_7::function_695/0
+    frame 0
+    call 0 startup_module_7::function_694/0
+    return
+.end
+
+.function: startup_module_7::function_696/0
+    frame 0
+    call 0 startup_module_7::function_695/0
+    return
+.end
+
+.function: startup_module_7::function_697/0
+    frame 0
+    call 0 startup_module_7::function_696/0
+    return
+.end
+
+.function: startup_module_7::function_698/0
+    frame 0
+    call 0 startup_module_7::function_697/0
+    return
+.end
+
+.function: startup_module_7::function_699/0
+    frame 0
+    call 0 startup_module_7::function_698/0
+    return
+.end
+
+.function: startup_module_7::function_700/0
+    frame 0
+    call 0 startup_module_7::function_699/0
+    return
+.end
+
+.function: startup_module_7::function_701/0
+    frame 0
+    call 0 startup_module_7::function_700/0
+    return
+.end
+
+.function: startup_module_7::function_702/0
+    frame 0
+    call 0 startup_module_7::function_701/0
+    return
+.end
+
+.function: startup_module_7::function_703/0
+    frame 0
+    call 0 startup_module_7::function_702/0
+    return
+.end
+
+.function: startup_module_7::function_704/0
+    frame 0
+    call 0 startup_module_7::function_703/0
+    return
+.end
+
+.function: startup_module_7::function_705/0
+    frame 0
+    call 0 startup_module_7::function_704/0
+    return
+.end
+
+.function: startup_module_7::function_706/0
+    frame 0
+    call 0 startup_module_7::function_705/0
+    return
+.end
+
+.function: startup_module_7::function_707/0
+    frame 0
+    call 0 startup_module_7::function_706/0
+    return
+.end
+
+.function: startup_module_7::function_708/0
+    frame 0
+    call 0 startup_module_7::function_707/0
+    return
+.end
+
+.function: startup_module_7::function_709/0
+    frame 0
+    call 0 startup_module_7::function_708/0
+    return
+.end
+
+.function: startup_module_7::function_710/0
+    frame 0
+    call 0 startup_module_7::function_709/0
+    return
+.end
+
+.function: startup_module_7::function_711/0
+    frame 0
+    call 0 startup_module_7::function_710/0
+    return
+.end
+
+.function: startup_module_7::function_712/0
+    frame 0
+    call 0 startup_module_7::function_711/0
+    return
+.end
+
+.function: startup_module_7::function_713/0
+    frame 0
+    call 0 startup_module_7::function_712/0
+    return
+.end
+
+.function: startup_module_7::function_714/0
+    frame 0
+    call 0 startup_module_7::function_713/0
+    return
+.end
+
+.function: startup_module_7::function_715/0
+    frame 0
+    call 0 startup_module_7::function_714/0
+    return
+.end
+
+.function: startup_module_7::function_716/0
+    frame 0
+    call 0 startup_module_7::function_715/0
+    return
+.end
+
+.function: startup_module_7::function_717/0
+    frame 0
+    call 0 startup_module_7::function_716/0
+    return
+.end
+
+.function: startup_module_7::function_718/0
+    frame 0
+    call 0 startup_module_7::function_717/0
+    return
+.end
+
+.function: startup_module_7::function_719/0
+    frame 0
+    call 0 startup_module_7::function_718/0
+    return
+.end
+
+.function: startup_module_7::function_720/0
+    frame 0
+    call 0 startup_module_7::function_719/0
+    return
+.end
+
+.function: startup_module_7::function_721/0
+    frame 0
+    call 0 startup_module_7::function_720/0
+    return
+.end
+
+.function: startup_module_7::function_722/0
+    frame 0
+    call 0 startup_module_7::function_721/0
+    return
+.end
+
+.function: startup_module_7::function_723/0
+    frame 0
+    call 0 startup_module_7::function_722/0
+    return
+.end
+
+.function: startup_module_7::function_724/0
+    frame 0
+    call 0 startup_module_7::function_723/0
+    return
+.end
+
+.function: startup_module_7::function_725/0
+    frame 0
+    call 0 startup_module_7::function_724/0
+    return
+.end
+
+.function: startup_module_7::function_726/0
+    frame 0
+    call 0 startup_module_7::function_725/0
+    return
+.end
+
+.function: startup_module_7::function_727/0
+    frame 0
+    call 0 startup_module_7::function_726/0
+    return
+.end
+
+.function: startup_module_7::function_728/0
+    frame 0
+    call 0 startup_module_7::function_727/0
+    return
+.end
+
+.function: startup_module_7::function_729/0
+    frame 0
+    call 0 startup_module_7::function_728/0
+    return
+.end
+
+.function: startup_module_7::function_730/0
+    frame 0
+    call 0 startup_module_7::function_729/0
+    return
+.end
+
+.function: startup_module_7::function_731/0
+    frame 0
+    call 0 startup_module_7::function_730/0
+    return
+.end
+
+.function: startup_module_7::function_732/0
+    frame 0
+    call 0 startup_module_7::function_731/0
+    return
+.end
+
+.function: startup_module_7::function_733/0
+    frame 0
+    call 0 startup_module_7::function_732/0
+    return
+.end
+
+.function: startup_module_7::function_734/0
+    frame 0
+    call 0 startup_module_7::function_733/0
+    return
+.end
+
+.function: startup_module_7::function_735/0
+    frame 0
+    call 0 startup_module_7::function_734/0
+    return
+.end
+
+.function: startup_module_7::function_736/0
+    frame 0
+    call 0 startup_module_7::function_735/0
+    return
+.end
+
+.function: startup_module_7::function_737/0
+    frame 0
+    call 0 startup_module_7::function_736/0
+    return
+.end
+
+.function: startup_module_7::function_738/0
+    frame 0
+    call 0 startup_module_7::function_737/0
+    return
+.end
+
+.function: startup_module_7::function_739/0
+    frame 0
+    call 0 startup_module_7::function_738/0
+    return
+.end
+
+.function: startup_module_7::function_740/0
+    frame 0
+    call 0 startup_module_7::function_739/0
+    return
+.end
+
+.function: startup_module_7::function_741/0
+    frame 0
+    call 0 startup_module_7::function_740/0
+    return
+.end
+
+.function: startup_module_7::function_742/0
+    frame 0
+    call 0 startup_module_7::function_741/0
+    return
+.end
+
+.function: startup_module_7::function_743/0
+    frame 0
+    call 0 startup_module_7::function_742/0
+    return
+.end
+
+.function: startup_module_7::function_744/0
+    frame 0
+    call 0 startup_module_7::function_743/0
+    return
+.end
+
+.function: startup_module_7::function_745/0
+    frame 0
+    call 0 startup_module_7::function_744/0
+    return
+.end
+
+.function: startup_module_7::function_746/0
+    frame 0
+    call 0 startup_module_7::function_745/0
+    return
+.end
+
+.function: startup_module_7::function_747/0
+    frame 0
+    call 0 startup_module_7::function_746/0
+    return
+.end
+
+.function: startup_module_7::function_748/0
+    frame 0
+    call 0 startup_module_7::function_747/0
+    return
+.end
+
+.function: startup_module_7::function_749/0
+    frame 0
+    call 0 startup_module_7::function_748/0
+    return
+.end
+
+.function: startup_module_7::function_750/0
+    frame 0
+    call 0 startup_module_7::function_749/0
+    return
+.end
+
+.function: startup_module_7::function_751/0
+    frame 0
+    call 0 startup_module_7::function_750/0
+    return
+.end
+
+.function: startup_module_7::function_752/0
+    frame 0
+    call 0 startup_module_7::function_751/0
+    return
+.end
+
+.function: startup_module_7::function_753/0
+    frame 0
+    call 0 startup_module_7::function_752/0
+    return
+.end
+
+.function: startup_module_7::function_754/0
+    frame 0
+    call 0 startup_module_7::function_753/0
+    return
+.end
+
+.function: startup_module_7::function_755/0
+    frame 0
+    call 0 startup_module_7::function_754/0
+    return
+.end
+
+.function: startup_module_7::function_756/0
+    frame 0
+    call 0 startup_module_7::function_755/0
+    return
+.end
+
+.function: startup_module_7::function_757/0
+    frame 0
+    call 0 startup_module_7::function_756/0
+    return
+.end
+
+.function: startup_module_7::function_758/0
+    frame 0
+    call 0 startup_module_7::function_757/0
+    return
+.end
+
+.function: startup_module_7::function_759/0
+    frame 0
+    call 0 startup_module_7::function_758/0
+    return
+.end
+
+.function: startup_module_7::function_760/0
+    frame 0
+    call 0 startup_module_7::function_759/0
+    return
+.end
+
+.function: startup_module_7::function_761/0
+    frame 0
+    call 0 startup_module_7::function_760/0
+    return
+.end
+
+.function: startup_module_7::function_762/0
+    frame 0
+    call 0 startup_module_7::function_761/0
+    return
+.end
+
+.function: startup_module_7::function_763/0
+    frame 0
+    call 0 startup_module_7::function_762/0
+    return
+.end
+
+.function: startup_module_7::function_764/0
+    frame 0
+    call 0 startup_module_7::function_763/0
+    return
+.end
+
+.function: startup_module_7::function_765/0
+    frame 0
+    call 0 startup_module_7::function_764/0
+    return
+.end
+
+.function: startup_module_7::function_766/0
+    frame 0
+    call 0 startup_module_7::function_765/0
+    return
+.end
+
+.function: startup_module_7::function_767/0
+    frame 0
+    call 0 startup_module_7::function_766/0
+    return
+.end
+
+.function: startup_module_7::function_768/0
+    frame 0
+    call 0 startup_module_7::function_767/0
+    return
+.end
+
+.function: startup_module_7::function_769/0
+    frame 0
+    call 0 startup_module_7::function_768/0
+    return
+.end
+
+.function: startup_module_7::function_770/0
+    frame 0
+    call 0 startup_module_7::function_769/0
+    return
+.end
+
+.function: startup_module_7::function_771/0
+    frame 0
+    call 0 startup_module_7::function_770/0
+    return
+.end
+
+.function: startup_module_7::function_772/0
+    frame 0
+    call 0 startup_module_7::function_771/0
+    return
+.end
+
+.function: startup_module_7::function_773/0
+    frame 0
+    call 0 startup_module_7::function_772/0
+    return
+.end
+
+.function: startup_module_7::function_774/0
+    frame 0
+    call 0 startup_module_7::function_773/0
+    return
+.end
+
+.function: startup_module_7::function_775/0
+    frame 0
+    call 0 startup_module_7::function_774/0
+    return
+.end
+
+.function: startup_module_7::function_776/0
+    frame 0
+    call 0 startup_module_7::function_775/0
+    return
+.end
+
+.function: startup_module_7::function_777/0
+    frame 0
+    call 0 startup_module_7::function_776/0
+    return
+.end
+
+.function: startup_module_7::function_778/0
+    frame 0
+    call 0 startup_module_7::function_777/0
+    return
+.end
+
+.function: startup_module_7::function_779/0
+    frame 0
+    call 0 startup_module_7::function_778/0
+    return
+.end
+
+.function: startup_module_7::function_780/0
+    frame 0
+    call 0 startup_module_7::function_779/0
+    return
+.end
+
+.function: startup_module_7::function_781/0
+    frame 0
+    call 0 startup_module_7::function_780/0
+    return
+.end
+
+.function: startup_module_7::function_782/0
+    frame 0
+    call 0 startup_module_7::function_781/0
+    return
+.end
+
+.function: startup_module_7::function_783/0
+    frame 0
+    call 0 startup_module_7::function_782/0
+    return
+.end
+
+.function: startup_module_7::function_784/0
+    frame 0
+    call 0 startup_module_7::function_783/0
+    return
+.end
+
+.function: startup_module_7::function_785/0
+    frame 0
+    call 0 startup_module_7::function_784/0
+    return
+.end
+
+.function: startup_module_7::function_786/0
+    frame 0
+    call 0 startup_module_7::function_785/0
+    return
+.end
+
+.function: startup_module_7::function_787/0
+    frame 0
+    call 0 startup_module_7::function_786/0
+    return
+.end
+
+.function: startup_module_7::function_788/0
+    frame 0
+    call 0 startup_module_7::function_787/0
+    return
+.end
+
+.function: startup_module_7::function_789/0
+    frame 0
+    call 0 startup_module_7::function_788/0
+    return
+.end
+
+.function: startup_module_7::function_790/0
+    frame 0
+    call 0 startup_module_7::function_789/0
+    return
+.end
+
+.function: startup_module_7::function_791/0
+    frame 0
+    call 0 startup_module_7::function_790/0
+    return
+.end
+
+.function: startup_module_7::function_792/0
+    frame 0
+    call 0 startup_module_7::function_791/0
+    return
+.end
+
+.function: startup_module_7::function_793/0
+    frame 0
+    call 0 startup_module_7::function_792/0
+    return
+.end
+
+.function: startup_module_7::function_794/0
+    frame 0
+    call 0 startup_module_7::function_793/0
+    return
+.end
+
+.function: startup_module_7::function_795/0
+    frame 0
+    call 0 startup_module_7::function_794/0
+    return
+.end
+
+.function: startup_module_7::function_796/0
+    frame 0
+    call 0 startup_module_7::function_795/0
+    return
+.end
+
+.function: startup_module_7::function_797/0
+    frame 0
+    call 0 startup_module_7::function_796/0
+    return
+.end
+
+.function: startup_module_7::function_798/0
+    frame 0
+    call 0 startup_module_7::function_797/0
+    return
+.end
+
+.function: startup_module_7::function_799/0
+    frame 0
+    call 0 startup_module_7::function_798/0
+    return
+.end
+
+.function: startup_module_7::function_800/0
+    frame 0
+    call 0 startup_module_7::function_799/0
+    return
+.end
+
+.function: startup_module_7::function_801/0
+    frame 0
+    call 0 startup_module_7::function_800/0
+    return
+.end
+
+.function: startup_module_7::function_802/0
+    frame 0
+    call 0 startup_module_7::function_801/0
+    return
+.end
+
+.function: startup_module_7::function_803/0
+    frame 0
+    call 0 startup_module_7::function_802/0
+    return
+.end
+
+.function: startup_module_7::function_804/0
+    frame 0
+    call 0 startup_module_7::function_803/0
+    return
+.end
+
+.function: startup_module_7::function_805/0
+    frame 0
+    call 0 startup_module_7::function_804/0
+    return
+.end
+
+.function: startup_module_7::function_806/0
+    frame 0
+    call 0 startup_module_7::function_805/0
+    return
+.end
+
+.function: startup_module_7::function_807/0
+    frame 0
+    call 0 startup_module_7::function_806/0
+    return
+.end
+
+.function: startup_module_7::function_808/0
+    frame 0
+    call 0 startup_module_7::function_807/0
+    return
+.end
+
+.function: startup_module_7::function_809/0
+    frame 0
+    call 0 startup_module_7::function_808/0
+    return
+.end
+
+.function: startup_module_7::function_810/0
+    frame 0
+    call 0 startup_module_7::function_809/0
+    return
+.end
+
+.function: startup_module_7::function_811/0
+    frame 0
+    call 0 startup_module_7::function_810/0
+    return
+.end
+
+.function: startup_module_7::function_812/0
+    frame 0
+    call 0 startup_module_7::function_811/0
+    return
+.end
+
+.function: startup_module_7::function_813/0
+    frame 0
+    call 0 startup_module_7::function_812/0
+    return
+.end
+
+.function: startup_module_7::function_814/0
+    frame 0
+    call 0 startup_module_7::function_813/0
+    return
+.end
+
+.function: startup_module_7::function_815/0
+    frame 0
+    call 0 startup_module_7::function_814/0
+    return
+.end
+
+.function: startup_module_7::function_816/0
+    frame 0
+    call 0 startup_module_7::function_815/0
+    return
+.end
+
+.function: startup_module_7::function_817/0
+    frame 0
+    call 0 startup_module_7::function_816/0
+    return
+.end
+
+.function: startup_module_7::function_818/0
+    frame 0
+    call 0 startup_module_7::function_817/0
+    return
+.end
+
+.function: startup_module_7::function_819/0
+    frame 0
+    call 0 startup_module_7::function_818/0
+    return
+.end
+
+.function: startup_module_7::function_820/0
+    frame 0
+    call 0 startup_module_7::function_819/0
+    return
+.end
+
+.function: startup_module_7::function_821/0
+    frame 0
+    call 0 startup_module_7::function_820/0
+    return
+.end
+
+.function: startup_module_7::function_822/0
+    frame 0
+    call 0 startup_module_7::function_821/0
+    return
+.end
+
+.function: startup_module_7::function_823/0
+    frame 0
+    call 0 startup_module_7::function_822/0
+    return
+.end
+
+.function: startup_module_7::function_824/0
+    frame 0
+    call 0 startup_module_7::function_823/0
+    return
+.end
+
+.function: startup_module_7::function_825/0
+    frame 0
+    call 0 startup_module_7::function_824/0
+    return
+.end
+
+.function: startup_module_7::function_826/0
+    frame 0
+    call 0 startup_module_7::function_825/0
+    return
+.end
+
+.function: startup_module_7::function_827/0
+    frame 0
+    call 0 startup_module_7::function_826/0
+    return
+.end
+
+.function: startup_module_7::function_828/0
+    frame 0
+    call 0 startup_module_7::function_827/0
+    return
+.end
+
+.function: startup_module_7::function_829/0
+    frame 0
+    call 0 startup_module_7::function_828/0
+    return
+.end
+
+.function: startup_module_7::function_830/0
+    frame 0
+    call 0 startup_module_7::function_829/0
+    return
+.end
+
+.function: startup_module_7::function_831/0
+    frame 0
+    call 0 startup_module_7::function_830/0
+    return
+.end
+
+.function: startup_module_7::function_832/0
+    frame 0
+    call 0 startup_module_7::function_831/0
+    return
+.end
+
+.function: startup_module_7::function_833/0
+    frame 0
+    call 0 startup_module_7::function_832/0
+    return
+.end
+
+.function: startup_module_7::function_834/0
+    frame 0
+    call 0 startup_module_7::function_833/0
+    return
+.end
+
+.function: startup_module_7::function_835/0
+    frame 0
+    call 0 startup_module_7::function_834/0
+    return
+.end
+
+.function: startup_module_7::function_836/0
+    frame 0
+    call 0 startup_module_7::function_835/0
+    return
+.end
+
+.function: startup_module_7::function_837/0
+    frame 0
+    call 0 startup_module_7::function_836/0
+    return
+.end
+
+.function: startup_module_7::function_838/0
+    frame 0
+    call 0 startup_module_7::function_837/0
+    return
+.end
+
+.function: startup_module_7::function_839/0
+    frame 0
+    call 0 startup_module_7::function_838/0
+    return
+.end
+
+.function: startup_module_7::function_840/0
+    frame 0
+    call 0 startup_module_7::function_839/0
+    return
+.end
+
+.function: startup_module_7::function_841/0
+    frame 0
+    call 0 startup_module_7::function_840/0
+    return
+.end
+
+.function: startup_module_7::function_842/0
+    frame 0
+    call 0 startup_module_7::function_841/0
+    return
+.end
+
+.function: startup_module_7::function_843/0
+    frame 0
+    call 0 startup_module_7::function_842/0
+    return
+.end
+
+.function: startup_module_7::function_844/0
+    frame 0
+    call 0 startup_module_7::function_843/0
+    return
+.end
+
+.function: startup_module_7::function_845/0
+    frame 0
+    call 0 startup_module_7::function_844/0
+    return
+.end
+
+.function: startup_module_7::function_846/0
+    frame 0
+    call 0 startup_module_7::function_845/0
+    return
+.end
+
+.function: startup_module_7::function_847/0
+    frame 0
+    call 0 startup_module_7::function_846/0
+    return
+.end
+
+.function: startup_module_7::function_848/0
+    frame 0
+    call 0 startup_module_7::function_847/0
+    return
+.end
+
+.function: startup_module_7::function_849/0
+    frame 0
+    call 0 startup_module_7::function_848/0
+    return
+.end
+
+.function: startup_module_7::function_850/0
+    frame 0
+    call 0 startup_module_7::function_849/0
+    return
+.end
+
+.function: startup_module_7::function_851/0
+    frame 0
+    call 0 startup_module_7::function_850/0
+    return
+.end
+
+.function: startup_module_7::function_852/0
+    frame 0
+    call 0 startup_module_7::function_851/0
+    return
+.end
+
+.function: startup_module_7::function_853/0
+    frame 0
+    call 0 startup_module_7::function_852/0
+    return
+.end
+
+.function: startup_module_7::function_854/0
+    frame 0
+    call 0 startup_module_7::function_853/0
+    return
+.end
+
+.function: startup_module_7::function_855/0
+    frame 0
+    call 0 startup_module_7::function_854/0
+    return
+.end
+
+.function: startup_module_7::function_856/0
+    frame 0
+    call 0 startup_module_7::function_855/0
+    return
+.end
+
+.function: startup_module_7::function_857/0
+    frame 0
+    call 0 startup_module_7::function_856/0
+    return
+.end
+
+.function: startup_module_7::function_858/0
+    frame 0
+    call 0 startup_module_7::function_857/0
+    return
+.end
+
+.function: startup_module_7::function_859/0
+    frame 0
+    call 0 startup_module_7::function_858/0
+    return
+.end
+
+.function: startup_module_7::function_860/0
+    frame 0
+    call 0 startup_module_7::function_859/0
+    return
+.end
+
+.function: startup_module_7::function_861/0
+    frame 0
+    call 0 startup_module_7::function_860/0
+    return
+.end
+
+.function: startup_module_7::function_862/0
+    frame 0
+    call 0 startup_module_7::function_861/0
+    return
+.end
+
+.function: startup_module_7::function_863/0
+    frame 0
+    call 0 startup_module_7::function_862/0
+    return
+.end
+
+.function: startup_module_7::function_864/0
+    frame 0
+    call 0 startup_module_7::function_863/0
+    return
+.end
+
+.function: startup_module_7::function_865/0
+    frame 0
+    call 0 startup_module_7::function_864/0
+    return
+.end
+
+.function: startup_module_7::function_866/0
+    frame 0
+    call 0 startup_module_7::function_865/0
+    return
+.end
+
+.function: startup_module_7::function_867/0
+    frame 0
+    call 0 startup_module_7::function_866/0
+    return
+.end
+
+.function: startup_module_7::function_868/0
+    frame 0
+    call 0 startup_module_7::function_867/0
+    return
+.end
+
+.function: startup_module_7::function_869/0
+    frame 0
+    call 0 startup_module_7::function_868/0
+    return
+.end
+
+.function: startup_module_7::function_870/0
+    frame 0
+    call 0 startup_module_7::function_869/0
+    return
+.end
+
+.function: startup_module_7::function_871/0
+    frame 0
+    call 0 startup_module_7::function_870/0
+    return
+.end
+
+.function: startup_module_7::function_872/0
+    frame 0
+    call 0 startup_module_7::function_871/0
+    return
+.end
+
+.function: startup_module_7::function_873/0
+    frame 0
+    call 0 startup_module_7::function_872/0
+    return
+.end
+
+.function: startup_module_7::function_874/0
+    frame 0
+    call 0 startup_module_7::function_873/0
+    return
+.end
+
+.function: startup_module_7::function_875/0
+    frame 0
+    call 0 startup_module_7::function_874/0
+    return
+.end
+
+.function: startup_module_7::function_876/0
+    frame 0
+    call 0 startup_module_7::function_875/0
+    return
+.end
+
+.function: startup_module_7::function_877/0
+    frame 0
+    call 0 startup_module_7::function_876/0
+    return
+.end
+
+.function: startup_module_7::function_878/0
+    frame 0
+    call 0 startup_module_7::function_877/0
+    return
+.end
+
+.function: startup_module_7::function_879/0
+    frame 0
+    call 0 startup_module_7::function_878/0
+    return
+.end
+
+.function: startup_module_7::function_880/0
+    frame 0
+    call 0 startup_module_7::function_879/0
+    return
+.end
+
+.function: startup_module_7::function_881/0
+    frame 0
+    call 0 startup_module_7::function_880/0
+    return
+.end
+
+.function: startup_module_7::function_882/0
+    frame 0
+    call 0 startup_module_7::function_881/0
+    return
+.end
+
+.function: startup_module_7::function_883/0
+    frame 0
+    call 0 startup_module_7::function_882/0
+    return
+.end
+
+.function: startup_module_7::function_884/0
+    frame 0
+    call 0 startup_module_7::function_883/0
+    return
+.end
+
+.function: startup_module_7::function_885/0
+    frame 0
+    call 0 startup_module_7::function_884/0
+    return
+.end
+
+.function: startup_module_7::function_886/0
+    frame 0
+    call 0 startup_module_7::function_885/0
+    return
+.end
+
+.function: startup_module_7::function_887/0
+    frame 0
+    call 0 startup_module_7::function_886/0
+    return
+.end
+
+.function: startup_module_7::function_888/0
+    frame 0
+    call 0 startup_module_7::function_887/0
+    return
+.end
+
+.function: startup_module_7::function_889/0
+    frame 0
+    call 0 startup_module_7::function_888/0
+    return
+.end
+
+.function: startup_module_7::function_890/0
+    frame 0
+    call 0 startup_module_7::function_889/0
+    return
+.end
+
+.function: startup_module_7::function_891/0
+    frame 0
+    call 0 startup_module_7::function_890/0
+    return
+.end
+
+.function: startup_module_7::function_892/0
+    frame 0
+    call 0 startup_module_7::function_891/0
+    return
+.end
+
+.function: startup_module_7::function_893/0
+    frame 0
+    call 0 startup_module_7::function_892/0
+    return
+.end
+
+.function: startup_module_7::function_894/0
+    frame 0
+    call 0 startup_module_7::function_893/0
+    return
+.end
+
+.function: startup_module_7::function_895/0
+    frame 0
+    call 0 startup_module_7::function_894/0
+    return
+.end
+
+.function: startup_module_7::function_896/0
+    frame 0
+    call 0 startup_module_7::function_895/0
+    return
+.end
+
+.function: startup_module_7::function_897/0
+    frame 0
+    call 0 startup_module_7::function_896/0
+    return
+.end
+
+.function: startup_module_7::function_898/0
+    frame 0
+    call 0 startup_module_7::function_897/0
+    return
+.end
+
+.function: startup_module_7::function_899/0
+    frame 0
+    call 0 startup_module_7::function_898/0
+    return
+.end
+
+.function: startup_module_7::function_900/0
+    frame 0
+    call 0 startup_module_7::function_899/0
+    return
+.end
+
+.function: startup_module_7::function_901/0
+    frame 0
+    call 0 startup_module_7::function_900/0
+    return
+.end
+
+.function: startup_module_7::function_902/0
+    frame 0
+    call 0 startup_module_7::function_901/0
+    return
+.end
+
+.function: startup_module_7::function_903/0
+    frame 0
+    call 0 startup_module_7::function_902/0
+    return
+.end
+
+.function: startup_module_7::function_904/0
+    frame 0
+    call 0 startup_module_7::function_903/0
+    return
+.end
+
+.function: startup_module_7::function_905/0
+    frame 0
+    call 0 startup_module_7::function_904/0
+    return
+.end
+
+.function: startup_module_7::function_906/0
+    frame 0
+    call 0 startup_module_7::function_905/0
+    return
+.end
+
+.function: startup_module_7::function_907/0
+    frame 0
+    call 0 startup_module_7::function_906/0
+    return
+.end
+
+.function: startup_module_7::function_908/0
+    frame 0
+    call 0 startup_module_7::function_907/0
+    return
+.end
+
+.function: startup_module_7::function_909/0
+    frame 0
+    call 0 startup_module_7::function_908/0
+    return
+.end
+
+.function: startup_module_7::function_910/0
+    frame 0
+    call 0 startup_module_7::function_909/0
+    return
+.end
+
+.function: startup_module_7::function_911/0
+    frame 0
+    call 0 startup_module_7::function_910/0
+    return
+.end
+
+.function: startup_module_7::function_912/0
+    frame 0
+    call 0 startup_module_7::function_911/0
+    return
+.end
+
+.function: startup_module_7::function_913/0
+    frame 0
+    call 0 startup_module_7::function_912/0
+    return
+.end
+
+.function: startup_module_7::function_914/0
+    frame 0
+    call 0 startup_module_7::function_913/0
+    return
+.end
+
+.function: startup_module_7::function_915/0
+    frame 0
+    call 0 startup_module_7::function_914/0
+    return
+.end
+
+.function: startup_module_7::function_916/0
+    frame 0
+    call 0 startup_module_7::function_915/0
+    return
+.end
+
+.function: startup_module_7::function_917/0
+    frame 0
+    call 0 startup_module_7::function_916/0
+    return
+.end
+
+.function: startup_module_7::function_918/0
+    frame 0
+    call 0 startup_module_7::function_917/0
+    return
+.end
+
+.function: startup_module_7::function_919/0
+    frame 0
+    call 0 startup_module_7::function_918/0
+    return
+.end
+
+.function: startup_module_7::function_920/0
+    frame 0
+    call 0 startup_module_7::function_919/0
+    return
+.end
+
+.function: startup_module_7::function_921/0
+    frame 0
+    call 0 startup_module_7::function_920/0
+    return
+.end
+
+.function: startup_module_7::function_922/0
+    frame 0
+    call 0 startup_module_7::function_921/0
+    return
+.end
+
+.function: startup_module_7::function_923/0
+    frame 0
+    call 0 startup_module_7::function_922/0
+    return
+.end
+
+.function: startup_module_7::function_924/0
+    frame 0
+    call 0 startup_module_7::function_923/0
+    return
+.end
+
+.function: startup_module_7::function_925/0
+    frame 0
+    call 0 startup_module_7::function_924/0
+    return
+.end
+
+.function: startup_module_7::function_926/0
+    frame 0
+    call 0 startup_module_7::function_925/0
+    return
+.end
+
+.function: startup_module_7::function_927/0
+    frame 0
+    call 0 startup_module_7::function_926/0
+    return
+.end
+
+.function: startup_module_7::function_928/0
+    frame 0
+    call 0 startup_module_7::function_927/0
+    return
+.end
+
+.function: startup_module_7::function_929/0
+    frame 0
+    call 0 startup_module_7::function_928/0
+    return
+.end
+
+.function: startup_module_7::function_930/0
+    frame 0
+    call 0 startup_module_7::function_929/0
+    return
+.end
+
+.function: startup_module_7::function_931/0
+    frame 0
+    call 0 startup_module_7::function_930/0
+    return
+.end
+
+.function: startup_module_7::function_932/0
+    frame 0
+    call 0 startup_module_7::function_931/0
+    return
+.end
+
+.function: startup_module_7::function_933/0
+    frame 0
+    call 0 startup_module_7::function_932/0
+    return
+.end
+
+.function: startup_module_7::function_934/0
+    frame 0
+    call 0 startup_module_7::function_933/0
+    return
+.end
+
+.function: startup_module_7::function_935/0
+    frame 0
+    call 0 startup_module_7::function_934/0
+    return
+.end
+
+.function: startup_module_7::function_936/0
+    frame 0
+    call 0 startup_module_7::function_935/0
+    return
+.end
+
+.function: startup_module_7::function_937/0
+    frame 0
+    call 0 startup_module_7::function_936/0
+    return
+.end
+
+.function: startup_module_7::function_938/0
+    frame 0
+    call 0 startup_module_7::function_937/0
+    return
+.end
+
+.function: startup_module_7::function_939/0
+    frame 0
+    call 0 startup_module_7::function_938/0
+    return
+.end
+
+.function: startup_module_7::function_940/0
+    frame 0
+    call 0 startup_module_7::function_939/0
+    return
+.end
+
+.function: startup_module_7::function_941/0
+    frame 0
+    call 0 startup_module_7::function_940/0
+    return
+.end
+
+.function: startup_module_7::function_942/0
+    frame 0
+    call 0 startup_module_7::function_941/0
+    return
+.end
+
+.function: startup_module_7::function_943/0
+    frame 0
+    call 0 startup_module_7::function_942/0
+    return
+.end
+
+.function: startup_module_7::function_944/0
+    frame 0
+    call 0 startup_module_7::function_943/0
+    return
+.end
+
+.function: startup_module_7::function_945/0
+    frame 0
+    call 0 startup_module_7::function_944/0
+    return
+.end
+
+.function: startup_module_7::function_946/0
+    frame 0
+    call 0 startup_module_7::function_945/0
+    return
+.end
+
+.function: startup_module_7::function_947/0
+    frame 0
+    call 0 startup_module_7::function_946/0
+    return
+.end
+
+.function: startup_module_7::function_948/0
+    frame 0
+    call 0 startup_module_7::function_947/0
+    return
+.end
+
+.function: startup_module_7::function_949/0
+    frame 0
+    call 0 startup_module_7::function_948/0
+    return
+.end
+
+.function: startup_module_7::function_950/0
+    frame 0
+    call 0 startup_module_7::function_949/0
+    return
+.end
+
+.function: startup_module_7::function_951/0
+    frame 0
+    call 0 startup_module_7::function_950/0
+    return
+.end
+
+.function: startup_module_7::function_952/0
+    frame 0
+    call 0 startup_module_7::function_951/0
+    return
+.end
+
+.function: startup_module_7::function_953/0
+    frame 0
+    call 0 startup_module_7::function_952/0
+    return
+.end
+
+.function: startup_module_7::function_954/0
+    frame 0
+    call 0 startup_module_7::function_953/0
+    return
+.end
+
+.function: startup_module_7::function_955/0
+    frame 0
+    call 0 startup_module_7::function_954/0
+    return
+.end
+
+.function: startup_module_7::function_956/0
+    frame 0
+    call 0 startup_module_7::function_955/0
+    return
+.end
+
+.function: startup_module_7::function_957/0
+    frame 0
+    call 0 startup_module_7::function_956/0
+    return
+.end
+
+.function: startup_module_7::function_958/0
+    frame 0
+    call 0 startup_module_7::function_957/0
+    return
+.end
+
+.function: startup_module_7::function_959/0
+    frame 0
+    call 0 startup_module_7::function_958/0
+    return
+.end
+
+.function: startup_module_7::function_960/0
+    frame 0
+    call 0 startup_module_7::function_959/0
+    return
+.end
+
+.function: startup_module_7::function_961/0
+    frame 0
+    call 0 startup_module_7::function_960/0
+    return
+.end
+
+.function: startup_module_7::function_962/0
+    frame 0
+    call 0 startup_module_7::function_961/0
+    return
+.end
+
+.function: startup_module_7::function_963/0
+    frame 0
+    call 0 startup_module_7::function_962/0
+    return
+.end
+
+.function: startup_module_7::function_964/0
+    frame 0
+    call 0 startup_module_7::function_963/0
+    return
+.end
+
+.function: startup_module_7::function_965/0
+    frame 0
+    call 0 startup_module_7::function_964/0
+    return
+.end
+
+.function: startup_module_7::function_966/0
+    frame 0
+    call 0 startup_module_7::function_965/0
+    return
+.end
+
+.function: startup_module_7::function_967/0
+    frame 0
+    call 0 startup_module_7::function_966/0
+    return
+.end
+
+.function: startup_module_7::function_968/0
+    frame 0
+    call 0 startup_module_7::function_967/0
+    return
+.end
+
+.function: startup_module_7::function_969/0
+    frame 0
+    call 0 startup_module_7::function_968/0
+    return
+.end
+
+.function: startup_module_7::function_970/0
+    frame 0
+    call 0 startup_module_7::function_969/0
+    return
+.end
+
+.function: startup_module_7::function_971/0
+    frame 0
+    call 0 startup_module_7::function_970/0
+    return
+.end
+
+.function: startup_module_7::function_972/0
+    frame 0
+    call 0 startup_module_7::function_971/0
+    return
+.end
+
+.function: startup_module_7::function_973/0
+    frame 0
+    call 0 startup_module_7::function_972/0
+    return
+.end
+
+.function: startup_module_7::function_974/0
+    frame 0
+    call 0 startup_module_7::function_973/0
+    return
+.end
+
+.function: startup_module_7::function_975/0
+    frame 0
+    call 0 startup_module_7::function_974/0
+    return
+.end
+
+.function: startup_module_7::function_976/0
+    frame 0
+    call 0 startup_module_7::function_975/0
+    return
+.end
+
+.function: startup_module_7::function_977/0
+    frame 0
+    call 0 startup_module_7::function_976/0
+    return
+.end
+
+.function: startup_module_7::function_978/0
+    frame 0
+    call 0 startup_module_7::function_977/0
+    return
+.end
+
+.function: startup_module_7::function_979/0
+    frame 0
+    call 0 startup_module_7::function_978/0
+    return
+.end
+
+.function: startup_module_7::function_980/0
+    frame 0
+    call 0 startup_module_7::function_979/0
+    return
+.end
+
+.function: startup_module_7::function_981/0
+    frame 0
+    call 0 startup_module_7::function_980/0
+    return
+.end
+
+.function: startup_module_7::function_982/0
+    frame 0
+    call 0 startup_module_7::function_981/0
+    return
+.end
+
+.function: startup_module_7::function_983/0
+    frame 0
+    call 0 startup_module_7::function_982/0
+    return
+.end
+
+.function: startup_module_7::function_984/0
+    frame 0
+    call 0 startup_module_7::function_983/0
+    return
+.end
+
+.function: startup_module_7::function_985/0
+    frame 0
+    call 0 startup_module_7::function_984/0
+    return
+.end
+
+.function: startup_module_7::function_986/0
+    frame 0
+    call 0 startup_module_7::function_985/0
+    return
+.end
+
+.function: startup_module_7::function_987/0
+    frame 0
+    call 0 startup_module_7::function_986/0
+    return
+.end
+
+.function: startup_module_7::function_988/0
+    frame 0
+    call 0 startup_module_7::function_987/0
+    return
+.end
+
+.function: startup_module_7::function_989/0
+    frame 0
+    call 0 startup_module_7::function_988/0
+    return
+.end
+
+.function: startup_module_7::function_990/0
+    frame 0
+    call 0 startup_module_7::function_989/0
+    return
+.end
+
+.function: startup_module_7::function_991/0
+    frame 0
+    call 0 startup_module_7::function_990/0
+    return
+.end
+
+.function: startup_module_7::function_992/0
+    frame 0
+    call 0 startup_module_7::function_991/0
+    return
+.end
+
+.function: startup_module_7::function_993/0
+    frame 0
+    call 0 startup_module_7::function_992/0
+    return
+.end
+
+.function: startup_module_7::function_994/0
+    frame 0
+    call 0 startup_module_7::function_993/0
+    return
+.end
+
+.function: startup_module_7::function_995/0
+    frame 0
+    call 0 startup_module_7::function_994/0
+    return
+.end
+
+.function: startup_module_7::function_996/0
+    frame 0
+    call 0 startup_module_7::function_995/0
+    return
+.end
+
+.function: startup_module_7::function_997/0
+    frame 0
+    call 0 startup_module_7::function_996/0
+    return
+.end
+
+.function: startup_module_7::function_998/0
+    frame 0
+    call 0 startup_module_7::function_997/0
+    return
+.end
+
+.function: startup_module_7::function_999/0
+    frame 0
+    call 0 startup_module_7::function_998/0
+    return
+.end
+
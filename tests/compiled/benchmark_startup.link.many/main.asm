@@ -0,0 +1,72 @@
+.signature: startup_module_0::function_0/0
+
+.function: main/0
+    link startup_module_0
+    link startup_module_1
+    link startup_module_2
+    link startup_module_3
+    link startup_module_4
+    link startup_module_5
+    link startup_module_6
+    link startup_module_7
+    link startup_module_8
+    link startup_module_9
+    link startup_module_10
+    link startup_module_11
+    link startup_module_12
+    link startup_module_13
+    link startup_module_14
+    link startup_module_15
+    link startup_module_16
+    link startup_module_17
+    link startup_module_18
+    link startup_module_19
+    link startup_module_20
+    link startup_module_21
+    link startup_module_22
+    link startup_module_23
+    link startup_module_24
+    link startup_module_25
+    link startup_module_26
+    link startup_module_27
+    link startup_module_28
+    link startup_module_29
+    link startup_module_30
+    link startup_module_31
+    link startup_module_32
+    link startup_module_33
+    link startup_module_34
+    link startup_module_35
+    link startup_module_36
+    link startup_module_37
+    link startup_module_38
+    link startup_module_39
+    link startup_module_40
+    link startup_module_41
+    link startup_module_42
+    link startup_module_43
+    link startup_module_44
+    link startup_module_45
+    link startup_module_46
+    link startup_module_47
+    link startup_module_48
+    link startup_module_49
+    link startup_module_50
+    link startup_module_51
+    link startup_module_52
+    link startup_module_53
+    link startup_module_54
+    link startup_module_55
+    link startup_module_56
+    link startup_module_57
+    link startup_module_58
+    link startup_module_59
+    link startup_module_60
+    link startup_module_61
+    link startup_module_62
+    link startup_module_63
+    frame 0
+    call 1 startup_module_0::function_0/0
+    izero 0
+    return
+.end
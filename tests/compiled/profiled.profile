@@ -0,0 +1 @@
+main/0;count/1 1639
@@ -0,0 +1,12 @@
+.function: main/1
+    istore 1 -17
+    istore 2 0
+    ilt 3 1 2
+    not 3
+    branch 3 0x5d 0x42
+    istore 4 -1
+    imul 1 4 1
+    print 1
+    izero 0
+    return
+.end
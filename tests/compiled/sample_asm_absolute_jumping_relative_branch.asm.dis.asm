@@ -0,0 +1,9 @@
+.function: main/1
+    strstore 1 "Hello World"
+    istore 2 42
+    branch 2 0x5a 0x33
+    strstore 1 "Goodby World, you fail this test"
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/1
+    strstore 1 "Hello World"
+    jump 0x2a
+    print 1
+    jump 0x33
+    jump 0x1b
+    izero 0
+    return
+.end
@@ -0,0 +1,25 @@
+.function: main/1
+    bstore 1 33
+    bstore 2 72
+    bstore 3 101
+    bstore 4 108
+    bstore 5 111
+    bstore 6 32
+    bstore 7 87
+    bstore 8 114
+    bstore 9 100
+    echo 2
+    echo 3
+    echo 4
+    echo 4
+    echo 5
+    echo 6
+    echo 7
+    echo 5
+    echo 8
+    echo 4
+    echo 9
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/1
+    strstore 1 "42"
+    istore 2 27
+    stoi 3 1
+    iadd 3 2 3
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,19 @@
+.function: run_in_a_process/0
+    nop
+    nop
+    nop
+    nop
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 run_in_a_process/0
+    frame 1 16
+    param 0 1
+    msg 2 getPriority/1
+    print 2
+    join 0 1
+    izero 0
+    return
+.end
@@ -0,0 +1,31 @@
+.function: print_lazy/1
+    nop
+    nop
+    nop
+    nop
+    nop
+    arg 1 0
+    print 1
+    return
+.end
+
+.function: print_eager/1
+    arg 1 0
+    print 1
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    strstore 1 "Hello concurrent World! (1)"
+    param 0 1
+    process 3 print_lazy/1
+    frame 1 16
+    strstore 2 "Hello concurrent World! (2)"
+    param 0 2
+    process 4 print_eager/1
+    join 0 3
+    join 0 4
+    izero 0
+    return
+.end
@@ -0,0 +1,33 @@
+.function: running_detached/0
+    izero 0
+    istore 2 4
+    strstore 1 "Hello World! (from long-running detached process) "
+    igte 3 0 2
+    branch 3 0x8b 0x70
+    echo 1
+    print 0
+    iinc 0
+    jump 0x4a
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 running_detached/0
+    nop
+    nop
+    frame 1 16
+    ptr 2 1
+    param 0 2
+    msg 0 detach/1
+    nop
+    frame 1 16
+    param 0 2
+    msg 3 joinable/1
+    print 3
+    join 0 1
+    strstore 3 "main/1 exited"
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,25 @@
+.function: run_in_a_process/0
+    receive 1
+    print 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 run_in_a_process/0
+    frame 1 16
+    param 0 1
+    msg 0 detach/1
+    frame 2 16
+    param 0 1
+    istore 2 40
+    param 1 2
+    msg 0 setPriority/2
+    frame 2 16
+    param 0 1
+    strstore 2 "Hello message passing World!"
+    param 1 2
+    msg 0 pass/2
+    izero 0
+    return
+.end
@@ -0,0 +1,13 @@
+.function: run_in_a_process/0
+    istore 0 42
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 run_in_a_process/0
+    join 2 1
+    print 2
+    izero 0
+    return
+.end
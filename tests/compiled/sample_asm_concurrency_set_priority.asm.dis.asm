@@ -0,0 +1,38 @@
+.function: run_in_a_process/0
+    izero 1
+    istore 2 32
+    igte 4 1 2
+    branch 4 0x47 0x37
+    nop
+    iinc 1
+    jump 0x11
+    strstore 5 "Hello concurrent World!"
+    print 5
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 run_in_a_process/0
+    frame 2 16
+    param 0 1
+    istore 2 40
+    param 1 2
+    msg 0 setPriority/2
+    frame 1 16
+    param 0 1
+    msg 2 getPriority/1
+    print 2
+    izero 3
+    istore 4 16
+    igte 5 3 4
+    branch 5 0x127 0x117
+    nop
+    iinc 3
+    jump 0xf1
+    strstore 6 "Hello sequential World!"
+    print 6
+    join 0 1
+    izero 0
+    return
+.end
@@ -0,0 +1,39 @@
+.function: run_this_in_a_process/1
+    strstore 1 "hi, I am process 0"
+    print 1
+    return
+.end
+
+.function: process_waking_up_the_other_one/1
+    strstore 1 "hi, I am process 1"
+    print 1
+    strstore 6 "waking up process 0"
+    print 6
+    frame 1 16
+    arg 2 0
+    param 0 2
+    msg 0 wakeup/1
+    return
+.end
+
+.function: main/1
+    izero 1
+    frame 1 16
+    param 0 1
+    process 2 run_this_in_a_process/1
+    frame 1 16
+    ptr 3 2
+    param 0 3
+    msg 0 detach/1
+    strstore 6 "suspending process 0"
+    print 6
+    frame 1 16
+    param 0 3
+    msg 0 suspend/1
+    frame 1 16
+    param 0 3
+    process 4 process_waking_up_the_other_one/1
+    join 0 4
+    izero 0
+    return
+.end
@@ -0,0 +1,41 @@
+.block: try_process_exception
+    join 0 1
+    leave
+.end
+
+.block: handle_process_exception
+    strstore 3 "exception transferred from process "
+    echo 3
+    echo 1
+    strstore 3 ": "
+    echo 3
+    pull 3
+    print 3
+    leave
+.end
+
+.function: run_in_a_process/0
+    receive 1
+    throw 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    process 1 run_in_a_process/0
+    frame 2 16
+    param 0 1
+    istore 2 40
+    param 1 2
+    msg 0 setPriority/2
+    frame 2 16
+    param 0 1
+    strstore 2 "Hello exception transferring World!"
+    param 1 2
+    msg 0 pass/2
+    try
+    catch "String" handle_process_exception
+    enter try_process_exception
+    izero 0
+    return
+.end
@@ -0,0 +1,13 @@
+.function: foo/0
+    print 1
+    return
+.end
+
+.function: main/1
+    ress global
+    istore 1 42
+    closure 2 foo/0
+    enclose 2 1 2
+    izero 0
+    return
+.end
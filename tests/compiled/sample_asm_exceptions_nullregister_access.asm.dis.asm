@@ -0,0 +1,20 @@
+.block: exception_handler
+    strstore 1 "exception encountered: "
+    echo 1
+    pull 2
+    print 2
+    leave
+.end
+
+.block: print_block
+    print 1
+    leave
+.end
+
+.function: main/1
+    try
+    catch "Exception" exception_handler
+    enter print_block
+    izero 0
+    return
+.end
@@ -0,0 +1,46 @@
+.block: handle_integer
+    pull 2
+    print 2
+    print 4
+    leave
+.end
+
+.block: main_block
+    istore 1 42
+    istore 4 100
+    frame 1 5
+    param 0 1
+    call 0 secondary/1
+    istore 2 41
+    istore 4 125
+    leave
+.end
+
+.function: tertiary/1
+    arg 3 0
+    istore 4 300
+    throw 3
+    return
+.end
+
+.function: secondary/1
+    arg 2 0
+    istore 4 200
+    frame 1 5
+    param 0 2
+    istore 4 250
+    call 0 tertiary/1
+    istore 4 225
+    return
+.end
+
+.function: main/1
+    istore 4 50
+    try
+    catch "Integer" handle_integer
+    enter main_block
+    print 2
+    print 4
+    izero 0
+    return
+.end
@@ -0,0 +1,81 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: will_be_terminated/0
+    frame 1 16
+    istore 1 512
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    istore 1 42
+    throw 1
+    return
+.end
+
+.function: cycle_burner/2
+    frame 1 16
+    arg 1 1
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World from process "
+    echo 1
+    arg 1 0
+    print 1
+    return
+.end
+
+.function: spawn_process/1
+    ress static
+    isnull 2 1
+    branch 2 0xc8 0xd3
+    istore 1 -1
+    iinc 1
+    frame 2 16
+    param 0 1
+    ress local
+    arg 1 0
+    param 1 1
+    process 1 cycle_burner/2
+    frame 1 16
+    param 0 1
+    msg 0 detach/1
+    return
+.end
+
+.function: main/0
+    link std::misc
+    frame 0 16
+    process 1 will_be_terminated/0
+    frame 1 16
+    param 0 1
+    msg 0 detach/1
+    frame 1 16
+    istore 1 1000
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 100
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 400
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 600
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 128
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 64
+    pamv 0 1
+    call 0 spawn_process/1
+    frame 1 16
+    istore 1 312
+    pamv 0 1
+    call 0 spawn_process/1
+    izero 0
+    return
+.end
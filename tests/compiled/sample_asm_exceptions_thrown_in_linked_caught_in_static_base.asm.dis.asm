@@ -0,0 +1,31 @@
+; external function signatures
+.signature: test_module::test_fun/0
+
+.block: try_calling
+    frame 0 16
+    call 0 test_module::test_fun/0
+    leave
+.end
+
+.block: handle_Integer
+    pull 1
+    strstore 2 "looks "
+    echo 2
+    branch 1 0x53 0x46
+    strstore 2 "truthy"
+    strstore 2 "falsey"
+    echo 2
+    strstore 2 ": "
+    echo 2
+    print 1
+    leave
+.end
+
+.function: main/0
+    link test_module
+    try
+    catch "Integer" handle_Integer
+    enter try_calling
+    izero 0
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    vec 1 0 0
+    vat 2 1 4
+    izero 0
+    return
+.end
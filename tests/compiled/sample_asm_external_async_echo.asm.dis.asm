@@ -0,0 +1,13 @@
+; external function signatures
+.signature: async::echo/1
+
+.function: main/1
+    import "build/test/async"
+    frame 1 16
+    strstore 1 "Hello World!"
+    param 0 1
+    call 2 async::echo/1
+    print 2
+    izero 0
+    return
+.end
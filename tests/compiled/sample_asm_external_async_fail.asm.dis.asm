@@ -0,0 +1,23 @@
+; external function signatures
+.signature: async::fail/0
+
+.block: __try
+    frame 0 16
+    call 0 async::fail/0
+    leave
+.end
+
+.block: __catch_Exception
+    pull 1
+    print 1
+    leave
+.end
+
+.function: main/1
+    import "build/test/async"
+    try
+    catch "Exception" __catch_Exception
+    enter __try
+    izero 0
+    return
+.end
@@ -0,0 +1,75 @@
+; external function signatures
+.signature: printer::print/1
+
+.function: printer_wrapper/1
+    frame 1 16
+    arg 1 0
+    pamv 0 1
+    call 0 printer::print/1
+    return
+.end
+
+.function: process_spawner/1
+    frame 1 16
+    arg 1 0
+    pamv 0 1
+    process 1 printer_wrapper/1
+    frame 1 16
+    param 0 1
+    msg 0 detach/1
+    return
+.end
+
+.function: main/0
+    import "build/test/printer"
+    frame 1 16
+    strstore 1 "Joe"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Robert"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Mike"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Bjarne"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Guido"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Dennis"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Bram"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Herb"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Anthony"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Alan"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Ada"
+    pamv 0 1
+    call 0 process_spawner/1
+    frame 1 16
+    strstore 1 "Charles"
+    pamv 0 1
+    call 0 process_spawner/1
+    izero 0
+    return
+.end
@@ -0,0 +1,13 @@
+; external function signatures
+.signature: math::sqrt/1
+
+.function: main/1
+    import "build/test/math"
+    frame 1 16
+    fstore 1 3
+    param 0 1
+    call 2 math::sqrt/1
+    print 2
+    izero 0
+    return
+.end
@@ -0,0 +1,34 @@
+; external function signatures
+.signature: throwing::oh_noes/0
+
+.block: __try
+    frame 0 16
+    call 0 throwing::oh_noes/0
+    leave
+.end
+
+.block: __catch_Exception
+    pull 1
+    print 1
+    leave
+.end
+
+.function: watchdog_process/0
+    receive 1
+    strstore 3 "exception"
+    remove 3 1 3
+    print 3
+    jump 0x24
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    watchdog watchdog_process/0
+    import "build/test/throwing"
+    try
+    catch "ExceptionX" __catch_Exception
+    enter __try
+    izero 0
+    return
+.end
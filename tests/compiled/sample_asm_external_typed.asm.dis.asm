@@ -0,0 +1,78 @@
+; external function signatures
+.signature: typed::add/2
+.signature: typed::hypot/2
+.signature: typed::length/1
+.signature: typed::upper/1
+.signature: typed::reverse/1
+
+.block: __try
+    frame 2 16
+    strstore 1 "40"
+    param 0 1
+    istore 2 2
+    param 1 2
+    call 3 typed::add/2
+    leave
+.end
+
+.block: __catch_Exception
+    pull 1
+    print 1
+    leave
+.end
+
+.block: __try_overflow
+    frame 2 16
+    istore 1 2147483647
+    param 0 1
+    istore 2 1
+    param 1 2
+    call 3 typed::add/2
+    leave
+.end
+
+.function: main/1
+    import "build/test/typed"
+    frame 2 16
+    istore 1 40
+    param 0 1
+    istore 2 2
+    param 1 2
+    call 3 typed::add/2
+    print 3
+    frame 2 16
+    fstore 1 3
+    param 0 1
+    fstore 2 4
+    param 1 2
+    call 3 typed::hypot/2
+    print 3
+    frame 1 16
+    strstore 1 "Hello World!"
+    param 0 1
+    call 3 typed::length/1
+    print 3
+    frame 1 16
+    param 0 1
+    call 3 typed::upper/1
+    print 3
+    vec 1 0 0
+    bstore 2 72
+    vpush 1 2
+    bstore 2 105
+    vpush 1 2
+    bstore 2 33
+    vpush 1 2
+    frame 1 16
+    param 0 1
+    call 3 typed::reverse/1
+    print 3
+    try
+    catch "Exception" __catch_Exception
+    enter __try
+    try
+    catch "Exception" __catch_Exception
+    enter __try_overflow
+    izero 0
+    return
+.end
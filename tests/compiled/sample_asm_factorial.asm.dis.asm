@@ -0,0 +1,27 @@
+.function: factorial/2
+    arg 2 1
+    arg 1 0
+    imul 2 2 1
+    idec 1
+    istore 3 0
+    ieq 4 1 3
+    branch 4 0x89 0x5d
+    frame 2 16
+    param 0 1
+    param 1 2
+    call 2 factorial/2
+    move 0 2
+    return
+.end
+
+.function: main/1
+    istore 1 8
+    istore 2 1
+    frame 2 16
+    param 0 1
+    param 1 2
+    call 2 factorial/2
+    print 2
+    izero 0
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    fstore 1 4
+    fstore 2 -3.5
+    fadd 3 1 2
+    fstore 4 0
+    fadd 3 3 4
+    print 3
+    izero 0
+    return
+.end
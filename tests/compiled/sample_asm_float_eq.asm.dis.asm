@@ -0,0 +1,8 @@
+.function: main/1
+    fstore 1 0.69
+    fstore 2 0.69
+    feq 1 1 2
+    print 1
+    izero 0
+    return
+.end
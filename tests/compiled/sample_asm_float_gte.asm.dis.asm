@@ -0,0 +1,8 @@
+.function: main/1
+    fstore 1 4
+    fstore 2 3.99
+    fgte 1 1 2
+    print 1
+    izero 0
+    return
+.end
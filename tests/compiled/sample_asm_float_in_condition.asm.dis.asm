@@ -0,0 +1,11 @@
+.function: main/1
+    fstore 1 0.0001
+    istore 2 0
+    istore 3 1
+    ieq 2 2 3
+    branch 1 0x46 0x4c
+    not 2
+    print 2
+    izero 0
+    return
+.end
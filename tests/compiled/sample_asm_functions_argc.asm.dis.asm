@@ -0,0 +1,19 @@
+.function: print_number_of_params/
+    argc 1
+    print 1
+    return
+.end
+
+.function: main/1
+    argc 1
+    print 1
+    izero 2
+    frame 2 16
+    param 0 2
+    param 1 2
+    call 0 print_number_of_params/
+    frame 0 16
+    call 0 print_number_of_params/
+    izero 0
+    return
+.end
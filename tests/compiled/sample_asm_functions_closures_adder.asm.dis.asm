@@ -0,0 +1,37 @@
+.function: adder/1
+    arg 2 0
+    iadd 0 2 1
+    return
+.end
+
+.function: make_adder/1
+    arg 1 0
+    closure 2 adder/1
+    enclose 2 1 1
+    move 0 2
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    istore 1 3
+    param 0 1
+    call 2 make_adder/1
+    frame 1 16
+    istore 3 2
+    param 0 3
+    fcall 4 2
+    print 4
+    frame 1 16
+    istore 3 5
+    param 0 3
+    fcall 4 2
+    print 4
+    frame 1 16
+    istore 3 13
+    param 0 3
+    fcall 4 2
+    print 4
+    izero 0
+    return
+.end
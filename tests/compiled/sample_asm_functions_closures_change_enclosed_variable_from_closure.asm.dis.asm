@@ -0,0 +1,16 @@
+.function: variable_changing_function/0
+    istore 1 42
+    return
+.end
+
+.function: main/1
+    closure 2 variable_changing_function/0
+    strstore 1 "Hello World!"
+    enclose 2 1 1
+    print 1
+    frame 0 16
+    fcall 0 2
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,19 @@
+.function: a_closure/0
+    print 1
+    return
+.end
+
+.function: main/1
+    strstore 1 "Hello World!"
+    closure 2 a_closure/0
+    enclosecopy 2 1 1
+    print 1
+    frame 0 16
+    fcall 0 2
+    istore 1 42
+    print 1
+    frame 0 16
+    fcall 0 2
+    izero 0
+    return
+.end
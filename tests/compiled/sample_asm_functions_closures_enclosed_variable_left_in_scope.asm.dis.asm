@@ -0,0 +1,17 @@
+.function: printer_function/0
+    print 1
+    return
+.end
+
+.function: main/1
+    closure 2 printer_function/0
+    strstore 1 "Hello World!"
+    enclose 2 1 1
+    frame 0 16
+    fcall 0 2
+    istore 1 42
+    frame 0 16
+    fcall 0 2
+    izero 0
+    return
+.end
@@ -0,0 +1,54 @@
+.function: closure_level_3/1
+    arg 4 0
+    iadd 5 1 2
+    iadd 5 3 5
+    iadd 5 4 5
+    move 0 5
+    return
+.end
+
+.function: closure_level_2/1
+    closure 0 closure_level_3/1
+    enclose 0 1 1
+    enclose 0 2 2
+    arg 3 0
+    enclose 0 3 3
+    return
+.end
+
+.function: closure_level_1/1
+    closure 0 closure_level_2/1
+    enclose 0 1 1
+    arg 2 0
+    enclose 0 2 2
+    return
+.end
+
+.function: closure_maker/1
+    closure 0 closure_level_1/1
+    arg 1 0
+    enclose 0 1 1
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    istore 1 1
+    param 0 1
+    call 2 closure_maker/1
+    frame 1 16
+    istore 1 2
+    param 0 1
+    fcall 3 2
+    frame 1 16
+    istore 1 3
+    param 0 1
+    fcall 4 3
+    frame 1 16
+    istore 1 4
+    param 0 1
+    fcall 5 4
+    print 5
+    izero 0
+    return
+.end
@@ -0,0 +1,40 @@
+.function: closure_printer/0
+    print 2
+    return
+.end
+
+.function: closure_setter/1
+    arg 1 0
+    istore 2 @1
+    return
+.end
+
+.function: returns_closures/0
+    vec 1 0 0
+    istore 2 42
+    closure 3 closure_printer/0
+    enclose 3 2 2
+    closure 4 closure_setter/1
+    enclose 4 2 2
+    vpush 1 3
+    vpush 1 4
+    move 0 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 1 returns_closures/0
+    frame 0 16
+    vat 2 1 0
+    fcall 0 2
+    frame 1 16
+    istore 4 69
+    param 0 4
+    vat 3 1 1
+    fcall 0 3
+    frame 0 16
+    fcall 0 2
+    izero 0
+    return
+.end
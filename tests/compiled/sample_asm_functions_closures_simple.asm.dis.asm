@@ -0,0 +1,21 @@
+.function: foo/0
+    print 1
+    return
+.end
+
+.function: returns_closure/0
+    closure 2 foo/0
+    istore 1 42
+    enclose 2 1 1
+    move 0 2
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 1 returns_closure/0
+    frame 0 0
+    fcall 0 1
+    izero 0
+    return
+.end
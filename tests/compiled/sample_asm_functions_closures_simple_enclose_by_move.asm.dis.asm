@@ -0,0 +1,16 @@
+.function: a_closure/0
+    print 1
+    return
+.end
+
+.function: main/1
+    closure 1 a_closure/0
+    strstore 2 "Hello World!"
+    enclosemove 1 1 2
+    isnull 3 2
+    print 3
+    frame 0 16
+    fcall 0 1
+    izero 0
+    return
+.end
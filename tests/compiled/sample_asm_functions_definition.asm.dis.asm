@@ -0,0 +1,6 @@
+.function: main/1
+    istore 1 42
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,19 @@
+.function: print_it/1
+    arg 1 0
+    print 1
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    istore 1 42
+    param 0 1
+    istore 2 1
+    branch 2 0x54 0x5d
+    jump 0x71
+    call 0 print_it/1
+    jump 0x7c
+    call 0 print_it/1
+    izero 0
+    return
+.end
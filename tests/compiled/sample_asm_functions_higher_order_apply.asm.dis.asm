@@ -0,0 +1,27 @@
+.function: square/1
+    arg 1 0
+    imul 0 1 1
+    return
+.end
+
+.function: apply/2
+    frame 1 16
+    arg 2 1
+    pamv 0 2
+    arg 1 0
+    fcall 3 1
+    move 0 3
+    return
+.end
+
+.function: main/1
+    istore 1 5
+    function 2 square/1
+    frame 2 16
+    param 0 2
+    param 1 1
+    call 3 apply/2
+    print 3
+    izero 0
+    return
+.end
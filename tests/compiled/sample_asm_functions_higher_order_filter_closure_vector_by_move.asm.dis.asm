@@ -0,0 +1,62 @@
+.function: is_divisible_by/1
+    arg 1 0
+    ilt 3 1 2
+    branch 3 0x4a 0x31
+    isub 1 1 2
+    jump 0xb
+    copy 0 1
+    not 0
+    return
+.end
+
+.function: is_divisible_by_2/0
+    closure 1 is_divisible_by/1
+    istore 2 2
+    enclosemove 1 2 2
+    move 0 1
+    return
+.end
+
+.function: filter_closure/2
+    arg 1 0
+    arg 2 1
+    vec 3 0 0
+    izero 4
+    vlen 5 2
+    igte 6 4 5
+    branch 6 0x14c 0xeb
+    frame 1 0
+    vat 7 2 @4
+    param 0 7
+    fcall 8 1
+    branch 8 0x132 0x13d
+    vpush 3 7
+    iinc 4
+    jump 0xc5
+    move 0 3
+    return
+.end
+
+.function: main/1
+    vec 1 0 0
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    print 1
+    frame 0 16
+    call 3 is_divisible_by_2/0
+    frame 2 16
+    param 0 3
+    pamv 1 1
+    call 4 filter_closure/2
+    print 4
+    izero 0
+    return
+.end
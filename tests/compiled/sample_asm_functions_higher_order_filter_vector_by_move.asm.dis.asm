@@ -0,0 +1,54 @@
+.function: is_divisible_by_2/1
+    arg 1 0
+    istore 2 2
+    ilt 3 1 2
+    branch 3 0x55 0x3c
+    isub 1 1 2
+    jump 0x16
+    move 0 1
+    not 0
+    return
+.end
+
+.function: filter/2
+    arg 1 0
+    arg 2 1
+    vec 3 0 0
+    izero 4
+    vlen 5 2
+    igte 6 4 5
+    branch 6 0x125 0xc4
+    frame 1 16
+    vat 7 2 @4
+    param 0 7
+    fcall 8 1
+    branch 8 0x10b 0x116
+    vpush 3 7
+    iinc 4
+    jump 0x9e
+    move 0 3
+    return
+.end
+
+.function: main/1
+    vec 1 0 0
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    print 1
+    frame 2 16
+    function 3 is_divisible_by_2/1
+    param 0 3
+    pamv 1 1
+    call 4 filter/2
+    print 4
+    izero 0
+    return
+.end
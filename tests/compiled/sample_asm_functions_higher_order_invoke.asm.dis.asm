@@ -0,0 +1,58 @@
+.function: sum/4
+    arg 4 3
+    arg 3 2
+    arg 1 0
+    arg 2 1
+    iadd 0 1 2
+    iadd 0 3 0
+    iadd 0 4 0
+    return
+.end
+
+.function: invoke/2
+    arg 1 0
+    arg 2 1
+    vlen 4 2
+    frame @4 16
+    izero 3
+    igte 5 3 4
+    branch 5 0xdf 0xb5
+    vat 7 2 @3
+    pamv @3 7
+    iinc 3
+    jump 0x8f
+    fcall 8 1
+    move 0 8
+    return
+.end
+
+.function: main/1
+    vec 1 0 0
+    istore 2 20
+    vpush 1 2
+    istore 3 16
+    vpush 1 3
+    istore 4 8
+    vpush 1 4
+    istore 5 -2
+    vpush 1 5
+    istore 2 20
+    istore 3 16
+    istore 4 8
+    istore 5 -2
+    frame 4 16
+    param 0 2
+    param 1 3
+    param 2 4
+    param 3 5
+    call 6 sum/4
+    print 6
+    frame 2 16
+    function 7 sum/4
+    param 0 7
+    param 1 1
+    call 8 invoke/2
+    print 8
+    izero 0
+    return
+.end
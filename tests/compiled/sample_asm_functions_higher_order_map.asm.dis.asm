@@ -0,0 +1,57 @@
+.function: square/1
+    arg 1 0
+    imul 0 1 1
+    return
+.end
+
+.function: apply/2
+    frame 1 16
+    arg 2 1
+    param 0 2
+    arg 1 0
+    fcall 3 1
+    move 0 3
+    return
+.end
+
+.function: map/2
+    arg 1 0
+    arg 2 1
+    vec 3 0 0
+    izero 4
+    vlen 5 2
+    igte 6 4 5
+    branch 6 0x107 0xbc
+    frame 1 16
+    vat 7 2 @4
+    param 0 7
+    fcall 8 1
+    vpush 3 8
+    iinc 4
+    jump 0x96
+    move 0 3
+    return
+.end
+
+.function: main/1
+    vec 1 0 0
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    print 1
+    frame 2 16
+    function 3 square/1
+    param 0 3
+    param 1 1
+    call 4 map/2
+    print 4
+    izero 0
+    return
+.end
@@ -0,0 +1,17 @@
+.function: set_69/0
+    ress global
+    istore 2 69
+    return
+.end
+
+.function: main/1
+    istore 2 42
+    frame 0 16
+    call 0 set_69/0
+    print 2
+    ress global
+    print 2
+    ress local
+    izero 0
+    return
+.end
@@ -0,0 +1,36 @@
+.function: foo/0
+    istore 1 42
+    print 1
+    return
+.end
+
+.function: bar/0
+    istore 1 69
+    print 1
+    frame 0 16
+    call 0 foo/0
+    return
+.end
+
+.function: baz/0
+    istore 1 1995
+    print 1
+    frame 0 16
+    call 0 bar/0
+    return
+.end
+
+.function: bay/0
+    istore 1 2015
+    print 1
+    frame 0 16
+    call 0 baz/0
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 0 bay/0
+    izero 0
+    return
+.end
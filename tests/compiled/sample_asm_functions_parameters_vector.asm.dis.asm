@@ -0,0 +1,25 @@
+; external block signatures
+.bsignature: misc::argsvector
+
+.function: foo/4
+    link misc
+    try
+    enter misc::argsvector
+    print 1
+    return
+.end
+
+.function: main/1
+    frame 4 16
+    istore 1 0
+    param 0 1
+    istore 2 1
+    param 1 2
+    istore 3 2
+    param 2 3
+    istore 4 3
+    param 3 4
+    call 0 foo/4
+    izero 0
+    return
+.end
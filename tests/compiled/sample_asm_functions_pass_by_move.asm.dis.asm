@@ -0,0 +1,17 @@
+.function: foo/1
+    arg 1 0
+    print 1
+    move 0 1
+    return
+.end
+
+.function: main/1
+    new 1 Object
+    print 1
+    frame 1 16
+    pamv 0 1
+    call 1 foo/1
+    print 1
+    izero 0
+    return
+.end
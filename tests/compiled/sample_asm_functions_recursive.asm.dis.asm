@@ -0,0 +1,24 @@
+.function: recursive/2
+    arg 1 0
+    arg 2 1
+    idec 1
+    ilt 3 1 2
+    branch 3 0x74 0x42
+    print 1
+    frame 2 16
+    param 0 1
+    pamv 1 2
+    call 0 recursive/2
+    return
+.end
+
+.function: main/1
+    frame 2 16
+    istore 1 10
+    param 0 1
+    istore 2 0
+    pamv 1 2
+    call 0 recursive/2
+    izero 0
+    return
+.end
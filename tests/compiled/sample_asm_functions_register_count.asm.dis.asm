@@ -0,0 +1,36 @@
+.block: uses_high_register
+    istore 20 42
+    print 20
+    leave
+.end
+
+.function: enters_block/0
+    try
+    enter uses_high_register
+    return
+.end
+
+.function: uses_named_register/0
+    istore 12 69
+    print 12
+    return
+.end
+
+.function: packs_vector/0
+    istore 1 1
+    istore 2 2
+    vec 0 1 2
+    print 0
+    return
+.end
+
+.function: main/1
+    frame 0 32
+    call 0 enters_block/0
+    frame 0 32
+    call 0 uses_named_register/0
+    frame 0 32
+    call 0 packs_vector/0
+    izero 0
+    return
+.end
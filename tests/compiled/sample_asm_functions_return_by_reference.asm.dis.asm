@@ -0,0 +1,16 @@
+.function: by_reference/0
+    move 0 1
+    return
+.end
+
+.function: main/1
+    istore 1 69
+    closure 2 by_reference/0
+    enclose 2 1 1
+    frame 0 16
+    fcall 3 2
+    istore 3 42
+    print 1
+    izero 0
+    return
+.end
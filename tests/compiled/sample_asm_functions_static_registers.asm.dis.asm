@@ -0,0 +1,35 @@
+.function: counter/1
+    ress static
+    isnull 2 1
+    not 2
+    branch 2 0x5b 0x2c
+    istore 1 0
+    ress local
+    istore 1 0
+    arg 3 0
+    jump 0xbf
+    iinc 1
+    copy 4 1
+    tmpri 1
+    move 1 4
+    ress local
+    tmpro 1
+    arg 3 0
+    ilt 4 1 3
+    not 4
+    branch 4 0xe1 0xbf
+    print 1
+    frame 1 16
+    param 0 3
+    tailcall counter/1
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    istore 1 10
+    param 0 1
+    call 0 counter/1
+    izero 0
+    return
+.end
@@ -0,0 +1,18 @@
+.function: needs_eleven_registers/0
+    istore 10 42
+    print 10
+    return
+.end
+
+.function: tail_calls/0
+    istore 1 1
+    frame 0 0
+    tailcall needs_eleven_registers/0
+.end
+
+.function: main/0
+    frame 0 2
+    call 0 tail_calls/0
+    izero 0
+    return
+.end
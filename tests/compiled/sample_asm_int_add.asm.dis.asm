@@ -0,0 +1,10 @@
+.function: main/1
+    istore 1 4
+    istore 2 -3
+    iadd 3 1 2
+    istore 4 0
+    iadd 3 3 4
+    print 3
+    izero 0
+    return
+.end
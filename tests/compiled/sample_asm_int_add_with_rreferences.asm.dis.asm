@@ -0,0 +1,9 @@
+.function: main/1
+    istore 1 -1
+    istore 2 1
+    istore 3 2
+    iadd 4 1 @3
+    print 4
+    izero 0
+    return
+.end
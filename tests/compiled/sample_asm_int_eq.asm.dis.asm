@@ -0,0 +1,8 @@
+.function: main/1
+    istore 1 1
+    istore 2 1
+    ieq 1 1 2
+    print 1
+    izero 0
+    return
+.end
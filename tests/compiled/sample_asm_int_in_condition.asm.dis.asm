@@ -0,0 +1,11 @@
+.function: main/1
+    istore 1 1
+    istore 2 0
+    istore 3 1
+    ieq 2 2 3
+    branch 1 0x47 0x4d
+    not 2
+    print 2
+    izero 0
+    return
+.end
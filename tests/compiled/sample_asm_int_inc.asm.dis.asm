@@ -0,0 +1,7 @@
+.function: main/1
+    istore 1 0
+    iinc 1
+    print 1
+    izero 0
+    return
+.end
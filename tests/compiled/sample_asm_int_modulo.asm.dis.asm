@@ -0,0 +1,13 @@
+.function: main/1
+    istore 1 166737
+    istore 2 176
+    istore 3 @1
+    ilt 4 1 2
+    branch 4 0x77 0x47
+    idiv 1 1 2
+    imul 1 1 2
+    isub 3 3 1
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    istore 1 4
+    istore 2 3
+    isub 3 1 2
+    print 3
+    izero 0
+    return
+.end
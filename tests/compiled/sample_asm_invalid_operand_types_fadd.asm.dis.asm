@@ -0,0 +1,9 @@
+.function: main/1
+    class 1 Foo
+    register 1
+    new 1 Foo
+    fstore 2 1
+    fadd 3 1 2
+    izero 0
+    return
+.end
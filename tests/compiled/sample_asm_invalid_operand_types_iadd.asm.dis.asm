@@ -0,0 +1,7 @@
+.function: main/1
+    istore 1 1
+    fstore 2 1
+    iadd 3 1 2
+    izero 0
+    return
+.end
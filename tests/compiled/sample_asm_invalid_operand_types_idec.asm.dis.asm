@@ -0,0 +1,6 @@
+.function: main/1
+    function 1 main/1
+    idec 1
+    izero 0
+    return
+.end
@@ -0,0 +1,11 @@
+.function: main/1
+    class 1 Foo
+    register 1
+    new 1 Foo
+    class 2 Bar
+    register 2
+    new 2 Bar
+    igt 3 1 2
+    izero 0
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    class 1 Foo
+    register 1
+    new 1 Foo
+    iinc 1
+    izero 0
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/1
+    strstore 1 "Hello"
+    class 2 Foo
+    register 2
+    new 2 Foo
+    ilte 3 2 1
+    izero 0
+    return
+.end
@@ -0,0 +1,35 @@
+.function: iterfib/1
+    ress static
+    isnull 2 1
+    not 2
+    branch 2 0x68 0x2c
+    vec 1 0 0
+    istore 2 1
+    vpush 1 2
+    istore 2 1
+    vpush 1 2
+    arg 3 0
+    vlen 4 1
+    ilt 5 4 3
+    not 5
+    branch 5 0xee 0xaa
+    vat 6 1 -1
+    vat 7 1 -2
+    iadd 8 6 7
+    vpush 1 8
+    jump 0x73
+    vat 9 1 -1
+    move 0 9
+    return
+.end
+
+.function: main/1
+    istore 3 1134903170
+    frame 1 16
+    istore 1 45
+    param 0 1
+    call 2 iterfib/1
+    print 2
+    izero 0
+    return
+.end
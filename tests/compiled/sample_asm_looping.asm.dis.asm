@@ -0,0 +1,13 @@
+.function: main/1
+    istore 1 0
+    istore 2 10
+    ilt 3 1 2
+    not 3
+    branch 3 0x57 0x42
+    print 1
+    iinc 1
+    jump 0x16
+    print 1
+    izero 0
+    return
+.end
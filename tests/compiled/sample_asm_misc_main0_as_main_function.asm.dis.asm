@@ -0,0 +1,12 @@
+.function: main/0
+    strstore 1 "Hello World!"
+    print 1
+    strstore 1 "received "
+    echo 1
+    argc 1
+    echo 1
+    strstore 1 " arguments"
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,11 @@
+.function: main/1
+    new 1 Object
+    strstore 2 "foo"
+    istore 3 42
+    print 3
+    insert 1 2 3
+    remove 4 1 2
+    print 4
+    izero 0
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    new 1 Object
+    strstore 2 "foo"
+    istore 3 42
+    insert 1 2 3
+    isnull 4 3
+    print 4
+    izero 0
+    return
+.end
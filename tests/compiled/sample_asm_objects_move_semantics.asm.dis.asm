@@ -0,0 +1,11 @@
+.function: main/1
+    new 1 Object
+    new 2 Object
+    print 2
+    strstore 3 "foo"
+    insert 1 3 2
+    remove 4 1 3
+    print 4
+    izero 0
+    return
+.end
@@ -0,0 +1,19 @@
+.function: counter/1
+    arg 1 0
+    izero 2
+    ilt 3 2 1
+    branch 3 0x37 0x4c
+    print 2
+    iinc 2
+    jump 0x11
+    return
+.end
+
+.function: main/1
+    frame 1 16
+    istore 1 3
+    param 0 1
+    call 0 counter/1
+    izero 0
+    return
+.end
@@ -0,0 +1,37 @@
+.function: dummy/0
+    izero 0
+    return
+.end
+
+.function: power_of/2
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieq 4 2 3
+    not 4
+    branch 4 0x63 0x4f
+    istore 6 1
+    jump 0xbf
+    istore 5 1
+    istore 6 @1
+    ilt 4 5 2
+    branch 4 0x9f 0xbf
+    imul 6 6 1
+    nop
+    iinc 5
+    jump 0x79
+    move 0 6
+    return
+.end
+
+.function: main/1
+    frame 2 16
+    istore 1 4
+    param 0 1
+    istore 2 3
+    param 1 2
+    call 1 power_of/2
+    print 1
+    izero 0
+    return
+.end
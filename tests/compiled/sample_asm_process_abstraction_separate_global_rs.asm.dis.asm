@@ -0,0 +1,49 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: global_printer/0
+    ress global
+    receive 2
+    print 1
+    return
+.end
+
+.function: global_writer/2
+    ress global
+    arg 1 1
+    ress local
+    arg 1 0
+    frame 2 16
+    param 0 1
+    izero 3
+    param 1 3
+    msg 0 pass/2
+    return
+.end
+
+.function: main/0
+    link std::misc
+    frame 0 16
+    process 1 global_printer/0
+    frame 1 16
+    param 0 1
+    msg 0 detach/1
+    frame 2 16
+    param 0 1
+    strstore 2 "Hello World"
+    pamv 1 2
+    process 2 global_writer/2
+    frame 1 16
+    param 0 2
+    msg 0 detach/1
+    frame 2 16
+    param 0 1
+    strstore 2 "broken"
+    pamv 1 2
+    process 2 global_writer/2
+    frame 1 16
+    param 0 2
+    msg 0 detach/1
+    izero 0
+    return
+.end
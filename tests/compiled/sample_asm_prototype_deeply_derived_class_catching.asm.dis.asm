@@ -0,0 +1,39 @@
+.block: handler
+    pull 2
+    print 2
+    leave
+.end
+
+.block: throws_derived
+    new 1 DeeplyDerived
+    throw 1
+    leave
+.end
+
+.function: typesystem_setup/0
+    class 1 Base
+    register 1
+    class 1 Derived
+    derive 1 Base
+    register 1
+    class 1 MoreDerived
+    derive 1 Derived
+    register 1
+    class 1 EvenMoreDerived
+    derive 1 MoreDerived
+    register 1
+    class 1 DeeplyDerived
+    derive 1 EvenMoreDerived
+    register 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 0 typesystem_setup/0
+    try
+    catch "Base" handler
+    enter throws_derived
+    izero 0
+    return
+.end
@@ -0,0 +1,24 @@
+.block: handler
+    pull 2
+    print 2
+    leave
+.end
+
+.block: throws_derived
+    new 1 Derived
+    throw 1
+    leave
+.end
+
+.function: main/1
+    class 1 Base
+    register 1
+    class 1 Derived
+    derive 1 Base
+    register 1
+    try
+    catch "Base" handler
+    enter throws_derived
+    izero 0
+    return
+.end
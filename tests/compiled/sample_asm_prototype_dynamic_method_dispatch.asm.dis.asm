@@ -0,0 +1,77 @@
+; external function signatures
+.signature: typesystem::typeof/1
+
+.function: typesystem_setup/0
+    class 1 Base
+    attach 1 fn_base/1 good_day/1
+    register 1
+    class 1 Derived
+    derive 1 Base
+    attach 1 fn_derived/1 hello/1
+    register 1
+    class 1 MoreDerived
+    derive 1 Derived
+    attach 1 fn_more_derived/1 hi/1
+    register 1
+    return
+.end
+
+.function: fn_base/1
+    strstore 1 "Good day from "
+    echo 1
+    frame 1 16
+    arg 2 0
+    param 0 2
+    call 3 typesystem::typeof/1
+    print 3
+    return
+.end
+
+.function: fn_derived/1
+    strstore 1 "Hello from "
+    echo 1
+    frame 1 16
+    arg 2 0
+    param 0 2
+    call 3 typesystem::typeof/1
+    print 3
+    return
+.end
+
+.function: fn_more_derived/1
+    strstore 1 "Hi from "
+    echo 1
+    frame 1 16
+    arg 2 0
+    param 0 2
+    call 3 typesystem::typeof/1
+    print 3
+    return
+.end
+
+.function: main/1
+    import "typesystem"
+    frame 0 16
+    call 0 typesystem_setup/0
+    new 1 Derived
+    frame 1 16
+    param 0 1
+    msg 0 good_day/1
+    frame 1 16
+    param 0 1
+    msg 0 hello/1
+    strstore 3 ""
+    print 3
+    new 2 MoreDerived
+    frame 1 16
+    param 0 2
+    msg 0 good_day/1
+    frame 1 16
+    param 0 2
+    msg 0 hello/1
+    frame 1 16
+    param 0 2
+    msg 0 hi/1
+    izero 0
+    return
+.end
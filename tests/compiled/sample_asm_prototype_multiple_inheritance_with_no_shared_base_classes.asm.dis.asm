@@ -0,0 +1,45 @@
+.block: handler
+    pull 2
+    print 2
+    leave
+.end
+
+.block: throws_derived
+    new 1 Combined
+    throw 1
+    leave
+.end
+
+.function: typesystem_setup/0
+    class 1 BaseA
+    register 1
+    class 1 DerivedA
+    derive 1 BaseA
+    register 1
+    class 1 MoreDerivedA
+    derive 1 DerivedA
+    register 1
+    class 1 BaseB
+    register 1
+    class 1 DerivedB
+    derive 1 BaseB
+    register 1
+    class 1 MoreDerivedB
+    derive 1 DerivedB
+    register 1
+    class 1 Combined
+    derive 1 MoreDerivedA
+    derive 1 MoreDerivedB
+    register 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 0 typesystem_setup/0
+    try
+    catch "BaseA" handler
+    enter throws_derived
+    izero 0
+    return
+.end
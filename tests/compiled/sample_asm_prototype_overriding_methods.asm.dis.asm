@@ -0,0 +1,43 @@
+; external function signatures
+.signature: typesystem::typeof/1
+
+.function: typesystem_setup/0
+    class 1 Base
+    attach 1 Base::saySomething/1 hello/1
+    register 1
+    class 1 Derived
+    derive 1 Base
+    attach 1 Derived::saySomethingMore/1 hello/1
+    register 1
+    return
+.end
+
+.function: Base::saySomething/1
+    strstore 1 "Hello Base World!"
+    print 1
+    return
+.end
+
+.function: Derived::saySomethingMore/1
+    strstore 1 "Hello Derived World!"
+    print 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 0 typesystem_setup/0
+    frame 1 16
+    new 1 Base
+    param 0 1
+    msg 0 hello/1
+    frame 1 16
+    new 2 Derived
+    param 0 2
+    msg 0 hello/1
+    frame 1 16
+    param 0 2
+    call 0 Base::saySomething/1
+    izero 0
+    return
+.end
@@ -0,0 +1,53 @@
+.block: handler
+    pull 2
+    print 2
+    leave
+.end
+
+.block: throws_derived
+    new 1 Combined
+    throw 1
+    leave
+.end
+
+.function: typesystem_setup/0
+    class 0 SharedBase
+    register 0
+    class 1 SharedDerived
+    register 1
+    class 2 BaseA
+    derive 2 SharedBase
+    register 2
+    class 3 DerivedA
+    derive 3 BaseA
+    register 3
+    class 4 MoreDerivedA
+    derive 4 DerivedA
+    derive 4 SharedDerived
+    register 4
+    class 5 BaseB
+    derive 5 SharedBase
+    register 5
+    class 6 DerivedB
+    derive 6 BaseB
+    register 6
+    class 7 MoreDerivedB
+    derive 7 DerivedB
+    derive 7 SharedDerived
+    register 7
+    class 8 Combined
+    derive 8 MoreDerivedA
+    derive 8 MoreDerivedB
+    register 8
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    call 0 typesystem_setup/0
+    try
+    catch "BaseA" handler
+    enter throws_derived
+    izero 0
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/1
+    class 1 Custom
+    print 1
+    register 1
+    new 1 Custom
+    print 1
+    izero 0
+    return
+.end
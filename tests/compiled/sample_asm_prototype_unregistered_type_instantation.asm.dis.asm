@@ -0,0 +1,18 @@
+.block: handler
+    pull 1
+    print 1
+    leave
+.end
+
+.block: unregistered_type_instantation
+    new 1 Nonexistent
+    leave
+.end
+
+.function: main/1
+    try
+    catch "Exception" handler
+    enter unregistered_type_instantation
+    izero 0
+    return
+.end
@@ -0,0 +1,16 @@
+.function: foo/0
+    istore 1 16
+    istore 16 1
+    print 1
+    print @1
+    print 16
+    print @16
+    return
+.end
+
+.function: main/1
+    frame 0 17
+    call 0 foo/0
+    izero 0
+    return
+.end
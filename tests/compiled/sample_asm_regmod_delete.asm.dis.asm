@@ -0,0 +1,8 @@
+.function: main/1
+    istore 1 42
+    delete 1
+    isnull 2 1
+    print 2
+    izero 0
+    return
+.end
@@ -0,0 +1,5 @@
+.function: main/0
+    tmpro 1
+    izero 0
+    return
+.end
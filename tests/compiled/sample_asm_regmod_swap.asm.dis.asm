@@ -0,0 +1,9 @@
+.function: main/1
+    istore 1 0
+    istore 2 1
+    swap 1 2
+    print 1
+    print 2
+    izero 0
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    strstore 1 "Hello World!"
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,15 @@
+.function: main/0
+    vec 1 0 0
+    istore 0 0
+    vpush 1 0
+    istore 0 1
+    vpush 1 0
+    istore 0 2
+    vpush 1 0
+    istore 0 3
+    vpush 1 0
+    istore 0 4
+    vinsert 1 0 5
+    izero 0
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    strstore 2 "answer to life"
+    istore 3 42
+    vec 1 2 8
+    print 1
+    izero 0
+    return
+.end
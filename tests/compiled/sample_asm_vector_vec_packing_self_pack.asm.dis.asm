@@ -0,0 +1,8 @@
+.function: main/0
+    strstore 1 "answer to life"
+    istore 2 42
+    vec 3 1 3
+    print 3
+    izero 0
+    return
+.end
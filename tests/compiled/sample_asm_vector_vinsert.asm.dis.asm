@@ -0,0 +1,21 @@
+.function: main/1
+    vec 1 0 0
+    strstore 5 "sheep!"
+    vinsert 1 5 0
+    strstore 2 "Hurr"
+    vinsert 1 2 0
+    strstore 3 "durr"
+    vinsert 1 3 1
+    strstore 4 "Im'a"
+    vinsert 1 4 2
+    istore 7 0
+    vlen 6 1
+    ilt 8 7 6
+    branch 8 0xba 0xdf
+    vat 9 1 @7
+    print 9
+    iinc 7
+    jump 0x94
+    izero 0
+    return
+.end
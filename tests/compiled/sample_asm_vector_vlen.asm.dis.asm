@@ -0,0 +1,16 @@
+.function: main/1
+    istore 1 0
+    vec 2 0 0
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vpush 2 1
+    vlen 3 2
+    print 3
+    izero 0
+    return
+.end
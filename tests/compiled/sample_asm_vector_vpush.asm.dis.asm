@@ -0,0 +1,13 @@
+.function: main/1
+    vec 2 0 0
+    vlen 3 2
+    print 3
+    strstore 1 "Hello World!"
+    vpush 2 1
+    vlen 3 2
+    print 3
+    vpop 4 2 -1
+    print 4
+    izero 0
+    return
+.end
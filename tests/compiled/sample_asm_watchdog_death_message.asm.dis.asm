@@ -0,0 +1,106 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: watchdog_process/0
+    receive 1
+    strstore 2 "exception"
+    remove 2 1 2
+    strstore 3 "function"
+    remove 3 1 3
+    strstore 4 "[WARNING] process '"
+    echo 4
+    echo 3
+    strstore 4 "' killed by >>>"
+    echo 4
+    echo 2
+    strstore 4 "<<<"
+    print 4
+    jump 0x0
+    return
+.end
+
+.function: a_detached_concurrent_process/0
+    frame 1 16
+    istore 1 32
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World (from detached process)!"
+    print 1
+    frame 1 16
+    istore 1 512
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World (from detached process) after a runaway exception!"
+    print 1
+    frame 1 16
+    istore 1 512
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    frame 1 16
+    strstore 1 "a_detached_concurrent_process"
+    pamv 0 1
+    call 0 log_exiting_detached/1
+    return
+.end
+
+.function: a_joined_concurrent_process/0
+    frame 1 16
+    istore 1 128
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World (from joined process)!"
+    print 1
+    frame 1 16
+    strstore 1 "a_joined_concurrent_process"
+    pamv 0 1
+    call 0 log_exiting_joined/1
+    strstore 2 "OH NOES!"
+    throw 2
+    return
+.end
+
+.function: log_exiting_main/0
+    strstore 2 "process [  main  ]: 'main' exiting"
+    print 2
+    return
+.end
+
+.function: log_exiting_detached/1
+    arg 1 0
+    strstore 2 "process [detached]: '"
+    echo 2
+    echo 1
+    strstore 2 "' exiting"
+    print 2
+    return
+.end
+
+.function: log_exiting_joined/1
+    arg 1 0
+    strstore 2 "process [ joined ]: '"
+    echo 2
+    echo 1
+    strstore 2 "' exiting"
+    print 2
+    return
+.end
+
+.function: main/1
+    link std::misc
+    frame 0 16
+    watchdog watchdog_process/0
+    frame 0 16
+    process 1 a_detached_concurrent_process/0
+    frame 1 16
+    ptr 2 1
+    param 0 2
+    msg 0 detach/1
+    delete 2
+    frame 0 16
+    process 2 a_joined_concurrent_process/0
+    join 0 2
+    frame 0 16
+    call 0 log_exiting_main/0
+    izero 0
+    return
+.end
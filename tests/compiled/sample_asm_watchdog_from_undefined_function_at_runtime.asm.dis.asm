@@ -0,0 +1,54 @@
+; external function signatures
+.signature: undefined_function/0
+
+.function: broken_process/0
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    istore 1 42
+    throw 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    watchdog undefined_function/0
+    frame 0 16
+    process 1 broken_process/0
+    frame 1 16
+    ptr 2 1
+    param 0 2
+    msg 0 detach/1
+    izero 0
+    return
+.end
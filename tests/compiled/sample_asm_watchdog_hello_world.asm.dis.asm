@@ -0,0 +1,64 @@
+.function: watchdog_process/0
+    receive 1
+    strstore 3 "function"
+    remove 4 1 3
+    strstore 5 "process spawned with <"
+    echo 5
+    echo 4
+    strstore 5 "> died"
+    print 5
+    jump 0x0
+    return
+.end
+
+.function: broken_process/0
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    istore 1 42
+    throw 1
+    return
+.end
+
+.function: main/1
+    frame 0 16
+    watchdog watchdog_process/0
+    frame 0 16
+    process 1 broken_process/0
+    frame 1 16
+    ptr 2 1
+    param 0 2
+    msg 0 detach/1
+    izero 0
+    return
+.end
@@ -0,0 +1,135 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: watchdog_process/0
+    receive 1
+    strstore 2 "exception"
+    remove 2 1 2
+    strstore 3 "function"
+    remove 3 1 3
+    strstore 4 "parameters"
+    remove 4 1 4
+    strstore 5 "[WARNING] process '"
+    echo 5
+    echo 3
+    echo 4
+    strstore 5 "' killed by >>>"
+    echo 5
+    echo 2
+    strstore 5 "<<<"
+    print 5
+    frame 2 16
+    vat 5 4 0
+    param 0 5
+    vat 6 4 1
+    iinc 6
+    param 1 6
+    process 7 a_division_executing_process/2
+    frame 1 16
+    ptr 5 7
+    param 0 5
+    msg 0 detach/1
+    jump 0x0
+    return
+.end
+
+.function: a_detached_concurrent_process/0
+    frame 1 16
+    istore 1 32
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World (from detached process)!"
+    print 1
+    frame 1 16
+    istore 1 512
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    strstore 1 "Hello World (from detached process) after a runaway exception!"
+    print 1
+    frame 1 16
+    istore 1 512
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    frame 1 16
+    strstore 1 "a_detached_concurrent_process"
+    pamv 0 1
+    call 0 log_exiting_detached/1
+    return
+.end
+
+.function: a_division_executing_process/2
+    frame 1 16
+    istore 1 128
+    pamv 0 1
+    call 0 std::misc::cycle/1
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieq 4 2 3
+    branch 4 0x300 0x322
+    strstore 4 "cannot divide by zero"
+    throw 4
+    idiv 0 1 2
+    echo 1
+    strstore 4 " / "
+    echo 4
+    echo 2
+    strstore 4 " = "
+    echo 4
+    print 0
+    return
+.end
+
+.function: log_exiting_main/0
+    strstore 2 "process [  main  ]: 'main' exiting"
+    print 2
+    return
+.end
+
+.function: log_exiting_detached/1
+    arg 1 0
+    strstore 2 "process [detached]: '"
+    echo 2
+    echo 1
+    strstore 2 "' exiting"
+    print 2
+    return
+.end
+
+.function: log_exiting_joined/0
+    arg 1 0
+    strstore 2 "process [ joined ]: '"
+    echo 2
+    echo 1
+    strstore 2 "' exiting"
+    print 2
+    return
+.end
+
+.function: main/1
+    link std::misc
+    frame 0 16
+    watchdog watchdog_process/0
+    frame 0 16
+    process 1 a_detached_concurrent_process/0
+    frame 1 16
+    ptr 2 1
+    param 0 2
+    msg 0 detach/1
+    delete 2
+    frame 2 16
+    istore 3 42
+    param 0 3
+    istore 4 0
+    param 1 4
+    process 2 a_division_executing_process/2
+    frame 1 16
+    ptr 3 2
+    param 0 3
+    msg 0 detach/1
+    delete 3
+    frame 0 16
+    call 0 log_exiting_main/0
+    izero 0
+    return
+.end
@@ -0,0 +1,22 @@
+; external function signatures
+.signature: std::functional::apply/2
+
+.function: adder/1
+    arg 0 0
+    istore 1 21
+    iadd 0 0 1
+    return
+.end
+
+.function: main/1
+    link std::functional
+    frame 2 16
+    function 1 adder/1
+    pamv 0 1
+    istore 1 21
+    pamv 1 1
+    call 1 std::functional::apply/2
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,34 @@
+; external function signatures
+.signature: std::functional::filter/2
+
+.function: is_even/1
+    arg 1 0
+    istore 3 2
+    idiv 2 1 3
+    imul 2 2 3
+    ieq 0 1 2
+    return
+.end
+
+.function: main/1
+    link std::functional
+    vec 1 0 0
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    frame 2 16
+    function 3 is_even/1
+    param 0 3
+    param 1 1
+    call 4 std::functional::filter/2
+    print 4
+    izero 0
+    return
+.end
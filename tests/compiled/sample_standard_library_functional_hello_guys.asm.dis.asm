@@ -0,0 +1,34 @@
+; external function signatures
+.signature: std::functional::apply/2
+
+.function: greetings/1
+    strstore 1 "Hello "
+    echo 1
+    arg 1 0
+    echo 1
+    strstore 1 "!"
+    print 1
+    return
+.end
+
+.function: main/1
+    link std::functional
+    function 1 greetings/1
+    frame 2 16
+    param 0 1
+    strstore 2 "World"
+    param 1 2
+    call 0 std::functional::apply/2
+    frame 2 16
+    param 0 1
+    strstore 2 "Joe"
+    param 1 2
+    call 0 std::functional::apply/2
+    frame 2 16
+    param 0 1
+    strstore 2 "Mike"
+    param 1 2
+    call 0 std::functional::apply/2
+    izero 0
+    return
+.end
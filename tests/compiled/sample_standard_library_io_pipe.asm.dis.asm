@@ -0,0 +1,41 @@
+; external function signatures
+.signature: std::io::pipe/0
+.signature: std::io::read/2
+.signature: std::io::write/2
+.signature: std::io::close/1
+
+.function: reader/1
+    frame 2 16
+    arg 1 0
+    param 0 1
+    istore 2 64
+    param 1 2
+    call 3 std::io::read/2
+    print 3
+    frame 1 16
+    param 0 1
+    call 0 std::io::close/1
+    return
+.end
+
+.function: main/1
+    import "io"
+    frame 0 16
+    call 1 std::io::pipe/0
+    frame 1 16
+    vat 2 1 0
+    param 0 2
+    process 3 reader/1
+    frame 2 16
+    vat 4 1 1
+    param 0 4
+    strstore 5 "Hello World!"
+    param 1 5
+    call 0 std::io::write/2
+    frame 1 16
+    param 0 4
+    call 0 std::io::close/1
+    join 0 3
+    izero 0
+    return
+.end
@@ -0,0 +1,62 @@
+; external function signatures
+.signature: std::io::unix_listen/1
+.signature: std::io::unix_connect/1
+.signature: std::io::accept/1
+.signature: std::io::read/2
+.signature: std::io::write/2
+.signature: std::io::close/1
+
+.function: serve_one/1
+    frame 1 16
+    arg 1 0
+    param 0 1
+    call 2 std::io::accept/1
+    frame 2 16
+    param 0 2
+    istore 3 64
+    param 1 3
+    call 4 std::io::read/2
+    frame 2 16
+    param 0 2
+    param 1 4
+    call 0 std::io::write/2
+    frame 1 16
+    param 0 2
+    call 0 std::io::close/1
+    return
+.end
+
+.function: main/1
+    import "io"
+    frame 1 16
+    strstore 2 "@viua-std-io-echo-test"
+    param 0 2
+    call 1 std::io::unix_listen/1
+    frame 1 16
+    param 0 1
+    process 3 serve_one/1
+    frame 1 16
+    strstore 2 "@viua-std-io-echo-test"
+    param 0 2
+    call 4 std::io::unix_connect/1
+    frame 2 16
+    param 0 4
+    strstore 5 "Hello World!"
+    param 1 5
+    call 0 std::io::write/2
+    frame 2 16
+    param 0 4
+    istore 6 64
+    param 1 6
+    call 7 std::io::read/2
+    print 7
+    frame 1 16
+    param 0 4
+    call 0 std::io::close/1
+    join 0 3
+    frame 1 16
+    param 0 1
+    call 0 std::io::close/1
+    izero 0
+    return
+.end
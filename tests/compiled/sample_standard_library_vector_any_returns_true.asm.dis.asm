@@ -0,0 +1,28 @@
+; external function signatures
+.signature: std::vector::any/2
+
+.function: is_not_negative/1
+    arg 1 0
+    izero 2
+    igte 0 1 2
+    return
+.end
+
+.function: main/1
+    link std::vector
+    vec 2 0 0
+    istore 1 -1
+    vpush 2 1
+    istore 1 0
+    vpush 2 1
+    istore 1 1
+    vpush 2 1
+    frame 2 16
+    param 0 2
+    function 4 is_not_negative/1
+    pamv 1 4
+    call 5 std::vector::any/2
+    print 5
+    izero 0
+    return
+.end
@@ -0,0 +1,22 @@
+; external function signatures
+.signature: std::vector::of/2
+
+.function: return_integer/1
+    arg 0 0
+    return
+.end
+
+.function: main/1
+    link std::vector
+    class 1 Foo
+    register 1
+    frame 2 16
+    istore 1 8
+    pamv 0 1
+    function 1 return_integer/1
+    pamv 1 1
+    call 1 std::vector::of/2
+    print 1
+    izero 0
+    return
+.end
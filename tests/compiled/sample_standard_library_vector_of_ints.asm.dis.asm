@@ -0,0 +1,13 @@
+; external function signatures
+.signature: std::vector::of_ints/1
+
+.function: main/1
+    link std::vector
+    frame 1 16
+    istore 1 8
+    pamv 0 1
+    call 1 std::vector::of_ints/1
+    print 1
+    izero 0
+    return
+.end
@@ -0,0 +1,18 @@
+; external function signatures
+.signature: std::vector::of_ints/1
+.signature: std::vector::reverse_in_place/1
+
+.function: main/1
+    link std::vector
+    frame 1 16
+    istore 1 8
+    pamv 0 1
+    call 1 std::vector::of_ints/1
+    print 1
+    frame 1 16
+    param 0 1
+    call 2 std::vector::reverse_in_place/1
+    print 2
+    izero 0
+    return
+.end
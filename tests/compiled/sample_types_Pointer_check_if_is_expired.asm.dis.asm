@@ -0,0 +1,28 @@
+; external function signatures
+.signature: Pointer::expired/1
+
+.function: isExpired/1
+    frame 1 16
+    arg 1 0
+    param 0 1
+    call 2 Pointer::expired/1
+    strstore 3 "expired: "
+    echo 3
+    print 2
+    move 0 2
+    return
+.end
+
+.function: main/1
+    istore 1 42
+    ptr 2 1
+    frame 1 16
+    param 0 2
+    call 0 isExpired/1
+    delete 1
+    frame 1 16
+    param 0 2
+    call 0 isExpired/1
+    izero 0
+    return
+.end
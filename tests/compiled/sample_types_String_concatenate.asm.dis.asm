@@ -0,0 +1,13 @@
+.function: main/1
+    frame 2 16
+    strstore 1 "Hello "
+    param 0 1
+    strstore 2 "World!"
+    param 1 2
+    msg 3 concatenate/2
+    print 1
+    print 2
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,17 @@
+.function: main/1
+    frame 2 16
+    strstore 1 "Hello World!"
+    param 0 1
+    strstore 2 "World!"
+    param 1 2
+    msg 3 endswith/2
+    print 3
+    frame 2 16
+    param 0 1
+    strstore 2 "Fail"
+    param 1 2
+    msg 3 endswith/2
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,15 @@
+.function: main/1
+    vec 1 0 0
+    strstore 2 "formatted"
+    vpush 1 2
+    strstore 2 "World"
+    vpush 1 2
+    frame 2 16
+    strstore 2 "Hello, #{0} #{1}!"
+    param 0 2
+    param 1 1
+    msg 3 format/
+    print 3
+    izero 0
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/1
+    frame 1 16
+    strstore 1 "Hello World!"
+    param 0 1
+    msg 2 size/1
+    print 2
+    izero 0
+    return
+.end
@@ -0,0 +1,25 @@
+.function: main/1
+    frame 1 16
+    strstore 1 "Hello, World!"
+    param 0 1
+    msg 4 substr/
+    print 4
+    frame 3 16
+    strstore 1 "Hello, World!"
+    param 0 1
+    istore 2 0
+    param 1 2
+    istore 3 5
+    param 2 3
+    msg 4 substr/
+    print 4
+    frame 2 16
+    strstore 1 "Hello, World!"
+    param 0 1
+    istore 2 7
+    param 1 2
+    msg 4 substr/
+    print 4
+    izero 0
+    return
+.end
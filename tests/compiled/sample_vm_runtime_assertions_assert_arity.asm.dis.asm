@@ -0,0 +1,28 @@
+.block: try_ArityException
+    frame 4 16
+    strstore 1 "Hello, World!"
+    param 0 1
+    istore 2 3
+    param 1 2
+    istore 3 4
+    param 2 3
+    istore 4 5
+    param 3 4
+    msg 4 substr/
+    print 4
+    leave
+.end
+
+.block: catch_ArityException
+    pull 6
+    print 6
+    leave
+.end
+
+.function: main/1
+    try
+    catch "ArityException" catch_ArityException
+    enter try_ArityException
+    izero 0
+    return
+.end
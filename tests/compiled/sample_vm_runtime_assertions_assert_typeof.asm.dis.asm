@@ -0,0 +1,23 @@
+.block: try_TypeException
+    frame 2 16
+    strstore 1 "Hello, World!"
+    param 0 1
+    param 1 1
+    msg 2 substr/
+    print 2
+    leave
+.end
+
+.block: catch_TypeException
+    pull 6
+    print 6
+    leave
+.end
+
+.function: main/1
+    try
+    catch "TypeException" catch_TypeException
+    enter try_TypeException
+    izero 0
+    return
+.end
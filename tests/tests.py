@@ -280,6 +280,16 @@ def runTest(self, name, expected_output=None, expected_exit_code = 0, output_pro
         self.assertEqual(got_output, (dis_output.strip() if output_processing_function is None else output_processing_function(dis_output)))
         self.assertEqual(excode, dis_excode)
 
+    # every sample program is also a test of the optimiser: its optimised version must behave the same
+    optimised_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.optimised.bin'.format(self.PATH[2:].replace('/', '_'), name))
+    assemble(assembly_path, optimised_path, opts=(('-E', '-W',) if assembly_opts is None else assembly_opts) + ('-O',))
+    opt_excode, opt_output = run(optimised_path, expected_exit_code)
+    if custom_assert is not None:
+        custom_assert(self, opt_excode, (opt_output.strip() if output_processing_function is None else output_processing_function(opt_output)))
+    else:
+        self.assertEqual(got_output, (opt_output.strip() if output_processing_function is None else output_processing_function(opt_output)))
+        self.assertEqual(excode, opt_excode)
+
 def runTestCustomAsserts(self, name, assertions_callback, check_memory_leaks = True):
     assembly_path = os.path.join(self.PATH, name)
     compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.bin'.format(self.PATH[2:].replace('/', '_'), name))
@@ -594,6 +604,24 @@ class SampleProgramsTests(unittest.TestCase):
         """
         runTest(self, 'factorial_accumulator_by_move.asm', '40320')
 
+    def testCalculatingFactorialWithImageCache(self):
+        assembly_path = os.path.join(self.PATH, 'factorial.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'sample_asm_factorial_image_cache.bin')
+        cache_path = os.path.join(COMPILED_SAMPLES_PATH, 'image_cache')
+        if not os.path.isdir(cache_path):
+            os.makedirs(cache_path)
+        assemble(assembly_path, compiled_path)
+        os.environ['VIUACACHE'] = cache_path
+        try:
+            # first run writes the cache, second one uses it
+            for i in range(2):
+                excode, output = run(compiled_path)
+                self.assertEqual('40320', output.strip())
+                self.assertEqual(0, excode)
+        finally:
+            del os.environ['VIUACACHE']
+        self.assertTrue(os.listdir(cache_path))
+
     def testCalculatingFactorialUsingTailcalls(self):
         runTest(self, 'factorial_tailcall.asm', '40320')
 
@@ -636,6 +664,15 @@ class FunctionTests(unittest.TestCase):
     def testCallWithPassByMove(self):
         runTest(self, 'pass_by_move.asm', None, custom_assert=partiallyAppliedSameLines(3))
 
+    def testRegisterSetsAreAsBigAsNeeded(self):
+        runTestSplitlines(self, 'register_count.asm', ['42', '69', '[1, 2]'])
+
+    def testTailCallGrowsRegisterSet(self):
+        runTest(self, 'tailcall_needs_more_registers.asm', '42')
+
+    def testFrameUsedOnBothBranches(self):
+        runTest(self, 'frame_used_on_both_branches.asm', '42')
+
     @unittest.skip('functions not ending with "return" or "tailcall" are forbidden')
     def testNeverendingFunction(self):
         runTestSplitlines(self, 'neverending.asm', ['42', '48'], assembly_opts=())
@@ -836,6 +873,80 @@ class StaticLinkingTests(unittest.TestCase):
         self.assertEqual(['42', ':-)'], output.strip().splitlines())
         self.assertEqual(0, excode)
 
+    def testLinkingDropsUnreachableFunctions(self):
+        compiled_lib_paths = []
+        for lib_name in ('jumplib.asm', 'dead_code_lib.asm',):
+            assembly_lib_path = os.path.join(self.PATH, lib_name)
+            compiled_lib_path = os.path.join(COMPILED_SAMPLES_PATH, (lib_name + '.wlib'))
+            assemble(assembly_lib_path, compiled_lib_path, opts=('--lib',))
+            compiled_lib_paths.append(compiled_lib_path)
+        bin_name = 'dead_code_link.asm'
+        assembly_bin_path = os.path.join(self.PATH, bin_name)
+        compiled_bin_path = os.path.join(COMPILED_SAMPLES_PATH, (bin_name + '.bin'))
+        assemble(assembly_bin_path, compiled_bin_path, links=tuple(compiled_lib_paths))
+        excode, output = run(compiled_bin_path)
+        self.assertEqual(['42', ':-)', '3', '2', '1'], output.strip().splitlines())
+        self.assertEqual(0, excode)
+        disasm_output, error, excode = disassemble(compiled_bin_path)
+        self.assertIn('.function: dead::countdown/1', disasm_output)
+        self.assertIn('.function: dead::print/1', disasm_output)
+        self.assertNotIn('dead::unused/0', disasm_output)
+        self.assertNotIn('dead::also_unused/0', disasm_output)
+
+
+class OptimisationTests(unittest.TestCase):
+    """Tests for optimisations performed by assembler when given `-O` option.
+
+    Every sample program run with `runTest()` is also assembled with optimisations enabled
+    and must behave the same; tests in this class check that optimisations are applied.
+    """
+    PATH = './sample/asm/optimisation'
+
+    def assembleOptimised(self, name, opts=()):
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.O.bin'.format(self.PATH[2:].replace('/', '_'), name))
+        assemble(assembly_path, compiled_path, opts=(('-O',) + opts))
+        excode, output = run(compiled_path)
+        disasm_output, error, dis_excode = disassemble(compiled_path)
+        return (excode, output.strip(), disasm_output)
+
+    def testConstantFolding(self):
+        excode, output, disassembly = self.assembleOptimised('constant_folding.asm')
+        self.assertEqual('294', output)
+        self.assertEqual(0, excode)
+        self.assertIn('istore 5 294', disassembly)
+        self.assertNotIn('iadd', disassembly)
+        self.assertNotIn('imul', disassembly)
+        self.assertNotIn('istore 4 100', disassembly)
+        self.assertNotIn('copy', disassembly)
+
+    def testBranchFolding(self):
+        excode, output, disassembly = self.assembleOptimised('branch_folding.asm')
+        self.assertEqual('greater or equal', output)
+        self.assertEqual(0, excode)
+        self.assertNotIn('branch', disassembly)
+        self.assertNotIn('jump', disassembly)
+        self.assertNotIn('"less"', disassembly)
+
+    def testLoopIsNotFolded(self):
+        runTestSplitlines(self, 'loop.asm', ['0', '1', '2'])
+
+    def testInlining(self):
+        excode, output, disassembly = self.assembleOptimised('inlining.asm')
+        self.assertEqual('42', output)
+        self.assertEqual(0, excode)
+        main = disassembly[disassembly.index('.function: main/1'):]
+        main = main[:main.index('.end')]
+        self.assertNotIn('call', main)
+        self.assertNotIn('frame', main)
+
+    def testInliningThresholdDisablesInlining(self):
+        excode, output, disassembly = self.assembleOptimised('inlining.asm', opts=('--inline-threshold', '0'))
+        self.assertEqual('42', output)
+        self.assertEqual(0, excode)
+        self.assertIn('call 2 square/1', disassembly)
+        self.assertIn('call 3 add/2', disassembly)
+
 
 class JumpingTests(unittest.TestCase):
     """
@@ -1034,6 +1145,33 @@ class AssemblerErrorTests(unittest.TestCase):
         self.assertEqual(1, exit_code)
         self.assertEqual("./sample/asm/errors/call_without_a_frame.asm:28: error: call with 'tailcall' without a frame", output.strip())
 
+    def testCatchWithoutATryFrame(self):
+        name = 'catch_without_a_try_frame.asm'
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.bin'.format(self.PATH[2:].replace('/', '_'), name))
+        output, error, exit_code = assemble(assembly_path, compiled_path, okcodes=(1,0))
+        self.assertEqual(1, exit_code)
+        self.assertEqual("./sample/asm/errors/catch_without_a_try_frame.asm:26: error: use of 'catch' without a try frame", output.strip())
+
+    def testLeftoverTryFrame(self):
+        name = 'leftover_try_frame.asm'
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.bin'.format(self.PATH[2:].replace('/', '_'), name))
+        output, error, exit_code = assemble(assembly_path, compiled_path, okcodes=(1,0))
+        self.assertEqual(1, exit_code)
+        self.assertEqual("./sample/asm/errors/leftover_try_frame.asm:31: error: leftover try frame (created at line 29)", output.strip())
+
+    def testRegisterMayBeEmptyWhenRead(self):
+        name = 'register_may_be_empty_when_read.asm'
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.bin'.format(self.PATH[2:].replace('/', '_'), name))
+        output, error, exit_code = assemble(assembly_path, compiled_path, opts=('--Wuninitialised-register',), okcodes=(1,0))
+        self.assertEqual(0, exit_code)
+        self.assertEqual("./sample/asm/errors/register_may_be_empty_when_read.asm:27: warning: register 2 may be empty when read", output.strip())
+        output, error, exit_code = assemble(assembly_path, compiled_path, opts=('--Euninitialised-register',), okcodes=(1,0))
+        self.assertEqual(1, exit_code)
+        self.assertEqual("./sample/asm/errors/register_may_be_empty_when_read.asm:27: error: register 2 may be empty when read", output.strip())
+
     def testCatchingWithUndefinedBlock(self):
         name = 'catching_with_undefined_block.asm'
         assembly_path = os.path.join(self.PATH, name)
@@ -1319,6 +1457,16 @@ class MiscExceptionTests(unittest.TestCase):
         assemble(os.path.join(self.PATH, source_lib), out=lib_path, opts=('--lib',))
         runTest(self, 'thrown_in_linked_caught_in_static_base.asm', 'looks falsey: 0')
 
+    def testCatchingExceptionThrownInDifferentModuleWhenLinkingLazily(self):
+        source_lib = 'thrown_in_linked_caught_in_static_fun.asm'
+        lib_path = 'test_module.vlib'
+        assemble(os.path.join(self.PATH, source_lib), out=lib_path, opts=('--lib',))
+        os.environ['VIUALAZYLINK'] = '1'
+        try:
+            runTest(self, 'thrown_in_linked_caught_in_static_base.asm', 'looks falsey: 0')
+        finally:
+            del os.environ['VIUALAZYLINK']
+
     def testVectorOutOfRangeRead(self):
         runTestThrowsException(self, 'vector_out_of_range_read.asm', ('OutOfRangeException', 'positive vector index out of range',))
 
@@ -1332,6 +1480,186 @@ class MiscTests(unittest.TestCase):
     def testMain2AsMainFunction(self):
         runTestSplitlines(self, name='main2_as_main_function.asm', expected_output=['Hello World!', 'received 2 arguments'])
 
+    def testParallelAssemblyIsDeterministic(self):
+        for path, opts in (('./sample/asm/linking/static/jumplib.asm', ('--lib',)), ('./sample/asm/prototype/shared_bases.asm', ()),):
+            compiled = []
+            for jobs in ('1', '8',):
+                compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}.jobs_{1}.bin'.format(os.path.basename(path), jobs))
+                assemble(path, compiled_path, opts=(opts + ('--jobs', jobs,)))
+                with open(compiled_path, 'rb') as ifstream:
+                    compiled.append(ifstream.read())
+            self.assertEqual(compiled[0], compiled[1])
+
+    def testObjectCacheReusesOnlyUnchangedFunctions(self):
+        source_path = os.path.join(COMPILED_SAMPLES_PATH, 'object_cache.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'object_cache.bin')
+        cache_path = os.path.join(COMPILED_SAMPLES_PATH, 'object_cache')
+        if not os.path.isdir(cache_path):
+            os.makedirs(cache_path)
+        # objects cached by previous runs of the test suite would be reused by the first assembly
+        for each in os.listdir(cache_path):
+            os.remove(os.path.join(cache_path, each))
+        with open(os.path.join(self.PATH, 'object_cache.asm')) as ifstream:
+            source = ifstream.read()
+        os.environ['VIUACACHE'] = cache_path
+        try:
+            # first assembly writes the cache, second one uses it, and third one must notice the change
+            for answer, expected_cached in ((42, set()), (42, {'answer/0', 'main/0', '__entry'}), (69, {'main/0', '__entry'}),):
+                with open(source_path, 'w') as ofstream:
+                    ofstream.write(source.replace('istore 0 42', 'istore 0 {0}'.format(answer)))
+                output, error, exit_code = assemble(source_path, compiled_path, opts=('-E', '-W', '--verbose',))
+                generated = re.findall('generating bytecode for function "([^"]+)" \\(.*?(, from cache)?\\)', output)
+                self.assertEqual({'answer/0', 'main/0', '__entry'}, {name for name, cached in generated})
+                self.assertEqual(expected_cached, {name for name, cached in generated if cached})
+                excode, output = run(compiled_path)
+                self.assertEqual(str(answer), output.strip())
+                self.assertEqual(0, excode)
+        finally:
+            del os.environ['VIUACACHE']
+
+    def testProfilerWritesProfile(self):
+        source_path = os.path.join(self.PATH, 'counting_loop.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'profiled.bin')
+        profile_path = os.path.join(COMPILED_SAMPLES_PATH, 'profiled.profile')
+        assemble(source_path, compiled_path, opts=('--line-info',))
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--profile={0}'.format(profile_path), '--profile-interval=100', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual('100000', output.decode('utf-8').strip())
+        with open(profile_path) as ifstream:
+            stacks = ifstream.read().splitlines()
+        self.assertTrue(stacks)
+        for each in stacks:
+            # a sample may be taken before the entry function calls main function
+            self.assertTrue(re.match('^(__entry|main/0(;count/1)?) \\d+$', each), each)
+        with open(profile_path + '.functions') as ifstream:
+            functions = [line.split('\t') for line in ifstream.read().splitlines() if not line.startswith('#')]
+        self.assertIn('count/1', [each[-1] for each in functions])
+        for suffix in ('.opcodes', '.instructions',):
+            self.assertTrue(os.path.isfile(profile_path + suffix))
+        with open(profile_path + '.lines') as ifstream:
+            lines = [line.split('\t')[-1] for line in ifstream.read().splitlines() if not line.startswith('#')]
+        self.assertTrue(lines)
+        for each in lines:
+            # lines holding instructions (all but function boundaries, marks, and the blank line)
+            self.assertIn(each, ['{0}:{1}'.format(source_path, n) for n in (21, 22, 24, 25, 26, 28, 29, 33, 34, 35, 36)])
+
+    def testLineInfoInStackTrace(self):
+        source_path = os.path.join(self.PATH, 'line_info.asm')
+        for opts, expected in ((('--line-info',), ['main/0/0() at {0}:29'.format(source_path), 'fail/0/0() at {0}:23'.format(source_path)]), ((), ['main/0/0()', 'fail/0/0()']),):
+            compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'line_info{0}.bin'.format(''.join(opts)))
+            assemble(source_path, compiled_path, opts=opts)
+            p = subprocess.Popen(('./build/bin/vm/cpu', compiled_path), stdout=subprocess.PIPE)
+            output, error = p.communicate()
+            self.assertEqual(1, p.wait())
+            lines = output.decode('utf-8').splitlines()
+            trace = lines[lines.index('stack trace: from entry point, most recent call last...')+1:][:2]
+            self.assertEqual(expected, [each.strip() for each in trace])
+
+    def testDispatchStatistics(self):
+        source_path = os.path.join(self.PATH, 'counting_loop.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'counted.bin')
+        statistics_path = os.path.join(COMPILED_SAMPLES_PATH, 'counted.json')
+        assemble(source_path, compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--stats={0}'.format(statistics_path), compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual('100000', output.decode('utf-8').strip())
+        with open(statistics_path) as ifstream:
+            statistics = json.load(ifstream)
+        opcodes = {each['opcode']: each['count'] for each in statistics['opcodes']}
+        self.assertEqual(statistics['instructions'], sum(opcodes.values()))
+        self.assertEqual(100000, opcodes['iinc'])
+        self.assertEqual(100001, opcodes['ilt'])
+        pairs = {(each['first'], each['second']): each['count'] for each in statistics['pairs']}
+        self.assertEqual(100000, pairs[('iinc', 'jump')])
+        self.assertEqual(100001, pairs[('ilt', 'branch')])
+        calls = {each['function']: each['count'] for each in statistics['calls']}
+        self.assertEqual(1, calls['count/1'])
+        self.assertEqual(1, calls['main/0'])
+
+    def testAllocationProfiler(self):
+        source_path = os.path.join(self.PATH, 'counting_loop.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'allocating.bin')
+        profile_path = os.path.join(COMPILED_SAMPLES_PATH, 'allocating.allocations')
+        assemble(source_path, compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--allocations={0}'.format(profile_path), compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual('100000', output.decode('utf-8').strip())
+        with open(profile_path) as ifstream:
+            types = {line.split('\t')[-1]: [int(each) for each in line.split('\t')[:-1]] for line in ifstream.read().splitlines() if not line.startswith('#')}
+        # every comparison allocates a boolean, and all of them are freed before the program ends
+        self.assertEqual(100001, types['Boolean'][0])
+        self.assertEqual(100001, types['Boolean'][1])
+        self.assertEqual(0, types['Boolean'][2])
+        # frames of the entry function, main function, and counting function
+        self.assertEqual([3, 3, 0], types['Frame'][:3])
+        self.assertTrue(types['RegisterSet'][0])
+        self.assertEqual(types['RegisterSet'][0], types['RegisterSet'][1])
+        with open(profile_path + '.sites') as ifstream:
+            sites = {tuple(line.split('\t')[2:]): int(line.split('\t')[0]) for line in ifstream.read().splitlines() if not line.startswith('#')}
+        self.assertEqual(100001, sites[('count/1', 'ilt')])
+        self.assertIn(('main/0', 'frame'), sites)
+        self.assertTrue(os.path.isfile(profile_path + '.snapshots'))
+
+    def testSchedulerTrace(self):
+        source_path = os.path.join(self.PATH, 'traced.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'traced.bin')
+        trace_path = os.path.join(COMPILED_SAMPLES_PATH, 'traced.trace.json')
+        assemble(source_path, compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--trace={0}'.format(trace_path), compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual('Hello traced World!', output.decode('utf-8').strip())
+        with open(trace_path) as ifstream:
+            trace = json.load(ifstream)
+        self.assertEqual(0, trace['otherData']['dropped_events'])
+        events = [each for each in trace['traceEvents'] if each['ph'] != 'M']
+        spawned = {each['args']['function']: each['args']['process'] for each in events if each['name'] == 'spawn'}
+        worker = spawned['worker/0']
+        worker_events = [each['name'] for each in events if each['args']['process'] == worker and each['ph'] == 'i']
+        # the message is sent before the worker runs, and the worker waits only for the foreign call
+        self.assertEqual(['spawn', 'send', 'receive', 'suspend', 'wakeup', 'exit'], worker_events)
+        foreign_calls = [each for each in events if each['cat'] == 'ffi']
+        self.assertEqual(['b', 'e'], [each['ph'] for each in foreign_calls])
+        self.assertEqual(['printer::print/1'] * 2, [each['name'] for each in foreign_calls])
+        self.assertEqual(foreign_calls[0]['id'], foreign_calls[1]['id'])
+        quanta = [each for each in events if each['name'] == 'quantum']
+        self.assertIn('worker/0', [each['args']['function'] for each in quanta])
+        self.assertTrue(all(each['dur'] >= 0 and each['args']['instructions'] > 0 for each in quanta))
+        # foreign calls complete on a different thread than the one running the scheduler
+        self.assertNotEqual(foreign_calls[0]['tid'], foreign_calls[1]['tid'])
+
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--trace={0}'.format(trace_path), '--trace-buffer=4', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        with open(trace_path) as ifstream:
+            trace = json.load(ifstream)
+        # only the most recent events are kept
+        self.assertEqual(4, len([each for each in trace['traceEvents'] if each['ph'] != 'M']))
+        self.assertEqual(trace['otherData']['recorded_events'] - 4, trace['otherData']['dropped_events'])
+        self.assertEqual('exit', trace['traceEvents'][-1]['name'])
+
+    @unittest.skipUnless(os.uname()[4] == 'x86_64', 'perf trampolines are supported only on x86-64')
+    def testPerfMap(self):
+        source_path = './sample/asm/factorial.asm'
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'factorial.perf.bin')
+        assemble(source_path, compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--perf-map', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual('40320', output.decode('utf-8').strip())
+        map_path = '/tmp/perf-{0}.map'.format(p.pid)
+        with open(map_path) as ifstream:
+            lines = ifstream.read().splitlines()
+        os.remove(map_path)
+        for each in lines:
+            self.assertTrue(re.match('^[0-9a-f]+ [0-9a-f]+ viua:\\S+$', each), each)
+        # every function gets its own trampoline
+        self.assertEqual(['__entry', 'main/1', 'factorial/2'], [each.split(' ')[2][5:] for each in lines])
+        self.assertEqual(len(lines), len(set(each.split(' ')[0] for each in lines)))
+
 
 class ExternalModulesTests(unittest.TestCase):
     """Tests for C/C++ module importing, and calling external functions.
@@ -1359,6 +1687,42 @@ class ExternalModulesTests(unittest.TestCase):
         MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = (72736,)
         runTest(self, 'throwing.asm', 'OH NOES!', 0)
 
+    def testThrowingExceptionFromNonblockingFunction(self):
+        global MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES
+        # FIXME: Valgrind freaks out about dlopen() leaks, comment this line if you know what to do about it
+        # or maybe the leak originates in Viua code but I haven't found the leak
+        MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = (72736,)
+        runTest(self, 'throwing_nonblocking.asm', 'OH NOES!', 0)
+
+    def testTypedFunctions(self):
+        global MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES
+        # FIXME: Valgrind freaks out about dlopen() leaks, comment this line if you know what to do about it
+        # or maybe the leak originates in Viua code but I haven't found the leak
+        MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = (72736,)
+        runTest(self, 'typed.asm', [
+            '42',
+            '5.000000',
+            '12',
+            'HELLO WORLD!',
+            '[!, i, H]',
+            'invalid type of parameter 0 in call to typed::add/2: String',
+            'value returned by typed::add/2 out of range of Integer: 2147483648',
+        ], 0, output_processing_function=lambda o: o.strip().splitlines())
+
+    def testAsynchronousCallCompletedFromAnotherThread(self):
+        global MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES
+        # FIXME: Valgrind freaks out about dlopen() leaks, comment this line if you know what to do about it
+        # or maybe the leak originates in Viua code but I haven't found the leak
+        MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = (72736,)
+        runTest(self, 'async_echo.asm', 'Hello World!', 0)
+
+    def testAsynchronousCallFailedFromAnotherThread(self):
+        global MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES
+        # FIXME: Valgrind freaks out about dlopen() leaks, comment this line if you know what to do about it
+        # or maybe the leak originates in Viua code but I haven't found the leak
+        MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = (72736,)
+        runTest(self, 'async_fail.asm', 'OH NOES!', 0)
+
     def testManyHelloWorld(self):
         # expected output must be sorted because it is not defined in what order the messages will be printed if
         # there is more than one FFI or VP scheduler running
@@ -1565,6 +1929,16 @@ class StandardRuntimeLibraryModuleVector(unittest.TestCase):
         runTest(self, 'any_returns_false.asm', 'false')
 
 
+class StandardRuntimeLibraryModuleIO(unittest.TestCase):
+    PATH = './sample/standard_library/io'
+
+    def testReadParksProcessUntilPipeIsWritten(self):
+        runTest(self, 'pipe.asm', 'Hello World!')
+
+    def testUnixSocketEcho(self):
+        runTest(self, 'unix_echo.asm', 'Hello World!')
+
+
 class StandardRuntimeLibraryModuleFunctional(unittest.TestCase):
     PATH = './sample/standard_library/functional'
 
@@ -1574,6 +1948,9 @@ class StandardRuntimeLibraryModuleFunctional(unittest.TestCase):
     def testApplyThatReturnsAValue(self):
         runTest(self, 'apply_simple.asm', '42')
 
+    def testFilterKeepsElementsAcceptedByPredicate(self):
+        runTest(self, 'filter.asm', [2, 4], 0, lambda o: json.loads(o))
+
 
 class TypeStringTests(unittest.TestCase):
     PATH = './sample/types/String'